@@ -271,6 +271,17 @@ For help, run code with no arguments
    refactor to call prepare_IDSAMPLE_biasCor before applying cuts to 
    real data.
 
+ Oct 16 2026: 
+   nthread option also splits biasCor prep over threads:
+   makeMap_fitPar_biasCor, init_COVINT_biasCor, and the
+   storeDataBias loop over data events. See exec_thread_biasCor.
+
+ Oct 16 2026:
+   new input cache_fitres=1 writes binary columnar sidecar
+   [file].SNCACHE on first read of each TEXT file (data, biasCor, 
+   ccprior), and later reads map the sidecar instead of parsing text.
+   See READTABLE_CACHE in sntools_output_text.c
+
  ******************************************************/
 
 #include "sntools.h" 
@@ -1096,6 +1107,7 @@ struct INPUTS {
   char SNID_MUCOVDUMP[MXCHAR_VARNAME]; // dump MUERR info for this SNID
 
   int nthread ; // number of threads (default = 0 -> no threads)
+  int cache_fitres ; // 1-> read/write binary cache of FITRES tables
 
   int restore_sigz ; // 1-> restore original sigma_z(measure) x dmu/dz
   int restore_mucovscale_bug ; // Sep 14 2021 allow restoring bug
@@ -1230,6 +1242,30 @@ typedef struct {
 
 } thread_chi2sums_def ;
 
+// Oct 2026: define typedef for threads that prepare biasCor
+typedef struct {
+  int id_thread, nthread;
+  int imin, imax;      // range of biasCor rows, cells, or data events
+  int IDSAMPLE, ipar_LCFIT ;
+
+  // thread-local sums per biasCor cell (makeMap_fitPar_biasCor)
+  double *SUMBIAS, *SUMWGT, *sum, *sumsq ;
+  int    *NperCell ;
+  int    NEVT_SAMPLE, NEVT_USE, NMAP_USE ;
+
+  // thread-local sums for COVINT (init_COVINT_biasCor)
+  double *SUMCOV ;
+  int    *NEVT_COV ;
+  int    NBIASCOR_CUTS, NBIASCOR_IDEAL ;
+
+  // storeDataBias status per data event (prepare_biasCor)
+  int    *ISTORE ;
+
+} thread_biasCor_def ;
+
+#define INDEX_COVINT_THREAD(idsample,iz,ia,ib,ig) \
+  ((((idsample*NZMAX + iz)*Na + ia)*Nb + ib)*Ng + ig)
+
 
 // define fit results
 struct {
@@ -1637,6 +1673,13 @@ void mnpout_(const int* num, char chnam[], double* val, double* error,
 
 void *MNCHI2FUN(void *thread);
 
+void  exec_thread_biasCor(int NITEM, void *(*FUN)(void *), 
+			  thread_biasCor_def *thread_biasCor, char *callFun);
+void *makeMap_fitPar_biasCor_sums(void *thread);
+void *makeMap_fitPar_biasCor_cells(void *thread);
+void *init_COVINT_biasCor_sums(void *thread);
+void *storeDataBias_thread(void *thread);
+
 typedef void (mfcn)( int* npar, double grad[], double* fval,
 	 double xval[], int* iflag, void*);
 void mncomd_(mfcn *fcn, char *text, int *icondn, const int *opt, int len);
@@ -5140,6 +5183,7 @@ void set_defaults(void) {
   INPUTS.restore_mucovscale_bug = 0 ;
   INPUTS.restore_mucovadd_bug = 0 ;
   INPUTS.nthread           = 1 ; // 1 -> no thread
+  INPUTS.cache_fitres      = 0 ;
 
   INPUTS.cidlist_debug_biascor[0] = 0 ;
 
@@ -8903,6 +8947,7 @@ void prepare_biasCor(void) {
   // Feb 5 2020: if > 5 SIM_gammaDM bins, do NOT add another dimension
   // Jun 25 2020: if INPUTS.fitflag_sigmb=0, leave it at zero
   // Dec 21 2020: check option to NOT require valid biasCor 
+  // Oct 16 2026: use nthread option for storeDataBias loop
 
   int INDX, IDSAMPLE, SKIP, NSN_DATA, CUTMASK, ievt ;
   int  NBINm = INPUTS.nbin_logmass;
@@ -8922,7 +8967,7 @@ void prepare_biasCor(void) {
   bool  DOCOR_MU          = ( OPTMASK & MASK_BIASCOR_MU ) ;
   bool  REQUIRE_VALID_BIASCOR = (OPTMASK & MASK_BIASCOR_noCUT) == 0 ;
   char *STRING_PARLIST    = INFO_BIASCOR.STRING_PARLIST;
-  char txt_biasCor[40], *name  ;
+  char txt_biasCor[40] ;
   
   bool USEDIM_GAMMADM, USEDIM_LOGMASS;
   int NDIM_BIASCOR=0, ILCPAR_MIN, ILCPAR_MAX ;
@@ -9159,7 +9204,6 @@ void prepare_biasCor(void) {
     { fprintf(FP_STDOUT, "   * muCOVscale   at each alpha,beta,gammaDM \n"); }
 
 
-  int DUMPFLAG = 0 ;
   int ndump_nobiasCor = INPUTS.ndump_nobiasCor;
 
   /* xxxx mark delete Apr 20 2022 xxxxxxxxxx
@@ -9169,16 +9213,21 @@ void prepare_biasCor(void) {
   if ( ndump_nobiasCor>0 && ndump_nobiasCor < 10 ) { ndump_nobiasCor=10; }
   xxxxxxx end mark xxxxxx */
 
+  // Oct 2026: storeDataBias is split over threads; 
+  // then count & set cut bits below in data order.
+  int *ISTORE = (int*) malloc(NSN_DATA*sizeof(int)) ;
+  int  t ;
+  thread_biasCor_def thread_biasCor[MXTHREAD] ;
+  for(t=0; t < INPUTS.nthread; t++ ) { thread_biasCor[t].ISTORE = ISTORE; }
+  exec_thread_biasCor(NSN_DATA, storeDataBias_thread, thread_biasCor, fnam);
+
   for (n=0; n < NSN_DATA; ++n) {
 
     CUTMASK  = INFO_DATA.TABLEVAR.CUTMASK[n]; 
     IDSAMPLE = INFO_DATA.TABLEVAR.IDSAMPLE[n]; 
     if ( CUTMASK ) { continue ; }
 
-    name = INFO_DATA.TABLEVAR.name[n];
-    DUMPFLAG = ( strstr(INPUTS.cidlist_debug_biascor,name) != NULL );
-
-    istore = storeDataBias(n,DUMPFLAG);
+    istore = ISTORE[n];
     
     NUSE[IDSAMPLE]++ ; NUSE_TOT++ ;
     if ( istore == 0 && REQUIRE_VALID_BIASCOR )  { 
@@ -9188,6 +9237,7 @@ void prepare_biasCor(void) {
 	{ storeDataBias(n,1); } 
     }    
   }
+  free(ISTORE);
 
 
   for(IDSAMPLE=0; IDSAMPLE < NSAMPLE_BIASCOR; IDSAMPLE++ ) {
@@ -9232,6 +9282,102 @@ void prepare_biasCor(void) {
 } // end prepare_biasCor
 
 
+// =================================================================
+void exec_thread_biasCor(int NITEM, void *(*FUN)(void *), 
+			 thread_biasCor_def *thread_biasCor, char *callFun) {
+
+  // Created Oct 2026
+  // Split NITEM (biasCor rows, biasCor cells, or data events) into
+  // nthread contiguous ranges [imin,imax) and execute FUN for each 
+  // range. For nthread=1, FUN is called directly without pthread.
+  // Calling function loads thread_biasCor[t] with thread-local 
+  // pointers before calling here, and sums thread-local results
+  // afterwards.
+
+  int nthread = INPUTS.nthread ;
+  int NITEM_per_thread, t, rc, NERR ;
+#ifdef USE_THREAD
+  pthread_t thread[MXTHREAD];
+#endif
+  char fnam[] = "exec_thread_biasCor" ;
+
+  // ----------- BEGIN ------------
+
+  if ( nthread == 1 ) 
+    { NITEM_per_thread = NITEM ; }
+  else
+    { NITEM_per_thread = (int)( (float)NITEM/(float)nthread )  + 1 ; } 
+
+  for ( t = 0; t < nthread; t++ ) {
+    thread_biasCor[t].nthread   = nthread ;
+    thread_biasCor[t].id_thread = t ;
+    thread_biasCor[t].imin      = t     * NITEM_per_thread ;
+    thread_biasCor[t].imax      = (t+1) * NITEM_per_thread ;
+    if ( thread_biasCor[t].imin > NITEM ) { thread_biasCor[t].imin = NITEM; }
+    if ( thread_biasCor[t].imax > NITEM ) { thread_biasCor[t].imax = NITEM; }
+
+    if ( nthread == 1 ) 
+      { FUN(&thread_biasCor[t]); }
+#ifdef USE_THREAD
+    else 
+      { rc = pthread_create(&thread[t], NULL, FUN, &thread_biasCor[t]); }
+#endif
+  }
+
+#ifdef USE_THREAD
+  // for threads, wait for them all to finish
+  if ( nthread > 1 ) {
+    NERR = 0 ;
+    for ( t = 0; t < nthread; t++ ) { 
+      rc = pthread_join(thread[t], NULL); 
+      if ( rc != 0 ) {
+	NERR++; 
+	printf(" ERROR: thread return errcode=%d for t=%d\n", rc,t); }
+    }
+
+    if ( NERR > 0 ) {
+      sprintf(c1err,"%d thread return code errors", NERR);
+      sprintf(c2err,"called by %s", callFun );
+      errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err);  
+    }  
+  }
+#endif
+
+  return ;
+
+} // end exec_thread_biasCor
+
+
+// =================================================================
+void *storeDataBias_thread(void *thread) {
+
+  // Created Oct 2026
+  // Call storeDataBias for data events n = imin to imax-1, and
+  // store return status in ISTORE[n] (-1 for events failing cuts).
+  // Each data event writes only its own bias arrays, so there
+  // is no overlap between threads.
+
+  thread_biasCor_def *thread_biasCor = (thread_biasCor_def *)thread;
+  int  *ISTORE = thread_biasCor->ISTORE ;
+  int  n, DUMPFLAG ;
+  char *name ;
+
+  // ----------------- BEGIN -----------------
+
+  for(n=thread_biasCor->imin; n < thread_biasCor->imax; n++ ) {
+    ISTORE[n] = -1 ;
+    if ( INFO_DATA.TABLEVAR.CUTMASK[n] ) { continue ; }
+
+    name = INFO_DATA.TABLEVAR.name[n];
+    DUMPFLAG = ( strstr(INPUTS.cidlist_debug_biascor,name) != NULL );
+    ISTORE[n] = storeDataBias(n,DUMPFLAG);
+  }
+
+  return(NULL);
+
+} // end storeDataBias_thread
+
+
 // =====================================
 void print_biascor_options(void) {
 
@@ -9771,6 +9917,8 @@ void makeMap_fitPar_biasCor(int IDSAMPLE, int ipar_LCFIT) {
   //
   // Aug 26 2019: account for gammadm
   // Feb 24 2020: update for ipar_LCFIT = index_mu
+  // Oct 16 2026: use nthread option to split loop over biasCor rows
+  //              (thread-local sums) and loop over cells.
   //
   // - - - - - - - - - -
 
@@ -9781,15 +9929,13 @@ void makeMap_fitPar_biasCor(int IDSAMPLE, int ipar_LCFIT) {
   char *PARNAME      = BIASCOR_NAME_LCFIT[ipar_LCFIT] ;
   int debug_malloc = INPUTS.debug_malloc ;
 
-  int MEMD, NEVT_USE, NEVT_SAMPLE,  LDMP, N ;
-  int J1D, ia, ib, ig, iz, im, ix1, ic, ievt, isp ;
-  int J1DNBR_LIST[MXJ1DNBR], NJ1DNBR ;
+  int nthread = INPUTS.nthread ;
+  int MEMD, NEVT_USE, NEVT_SAMPLE, NMAP_TOT, NMAP_USE, LDMP, t ;
+  int J1D, ia, ib, ig, iz, im, ix1, ic ;
 
-  double fit_val, sim_val, biasVal, sim_gammadm ;
-  double WGT, VAL, ERR, RMS, SQRMS, XN, XNLIST, tmp1, tmp2 ;
+  double VAL, ERR ;
   double *SUMBIAS, *SUMWGT, *sum, *sumsq ;
-
-  float *ptr_fitpar, *ptr_simpar, *ptr_gammadm;
+  thread_biasCor_def thread_biasCor[MXTHREAD] ;
   char fnam[] = "makeMap_fitPar_biasCor";
 
   // ----------------- BEGIN -----------------
@@ -9806,10 +9952,6 @@ void makeMap_fitPar_biasCor(int IDSAMPLE, int ipar_LCFIT) {
   sum     = (double*) malloc(MEMD) ;
   sumsq   = (double*) malloc(MEMD) ;
 
-  ptr_fitpar  = INFO_BIASCOR.TABLEVAR.fitpar[ipar_LCFIT] ;
-  ptr_simpar  = INFO_BIASCOR.TABLEVAR.SIM_FITPAR[ipar_LCFIT] ;
-  ptr_gammadm = INFO_BIASCOR.TABLEVAR.SIM_GAMMADM ;
-
   // ------------------------------------------
   for( J1D=0; J1D < NCELL ; J1D++ ) {
     // init global arrays  
@@ -9824,17 +9966,158 @@ void makeMap_fitPar_biasCor(int IDSAMPLE, int ipar_LCFIT) {
     sum[J1D]     = sumsq[J1D]  = 0.0 ; 
   }
 
+  // thread 0 sums directly into local/global arrays;
+  // other threads sum into their own arrays.
+  for(t=0; t < nthread; t++ ) {
+    thread_biasCor[t].IDSAMPLE   = IDSAMPLE ;
+    thread_biasCor[t].ipar_LCFIT = ipar_LCFIT ;
+    if ( t == 0 ) {
+      thread_biasCor[t].SUMBIAS  = SUMBIAS ;
+      thread_biasCor[t].SUMWGT   = SUMWGT ;
+      thread_biasCor[t].sum      = sum ;
+      thread_biasCor[t].sumsq    = sumsq ;
+      thread_biasCor[t].NperCell = CELLINFO_BIASCOR[IDSAMPLE].NperCell ;
+    }
+    else {
+      thread_biasCor[t].SUMBIAS  = (double*) calloc(NCELL,sizeof(double));
+      thread_biasCor[t].SUMWGT   = (double*) calloc(NCELL,sizeof(double));
+      thread_biasCor[t].sum      = (double*) calloc(NCELL,sizeof(double));
+      thread_biasCor[t].sumsq    = (double*) calloc(NCELL,sizeof(double));
+      thread_biasCor[t].NperCell = (int   *) calloc(NCELL,sizeof(int));
+    }
+  }
 
   // -----------------------------------------------
   // -------- LOOP OVER BIASCOR SIM ROWS -----------
   // -----------------------------------------------
 
+  exec_thread_biasCor(NBIASCOR_CUTS, makeMap_fitPar_biasCor_sums, 
+		      thread_biasCor, fnam);
+
+  // sum thread-local arrays
   NEVT_SAMPLE = NEVT_USE = 0 ;
+  for(t=0; t < nthread; t++ ) {
+    NEVT_SAMPLE += thread_biasCor[t].NEVT_SAMPLE ;
+    NEVT_USE    += thread_biasCor[t].NEVT_USE ;
+    if ( t == 0 ) { continue; }
+    for(J1D=0; J1D < NCELL; J1D++ ) {
+      SUMBIAS[J1D] += thread_biasCor[t].SUMBIAS[J1D] ;
+      SUMWGT[J1D]  += thread_biasCor[t].SUMWGT[J1D] ;
+      sum[J1D]     += thread_biasCor[t].sum[J1D] ;
+      sumsq[J1D]   += thread_biasCor[t].sumsq[J1D] ;
+      CELLINFO_BIASCOR[IDSAMPLE].NperCell[J1D] += 
+	thread_biasCor[t].NperCell[J1D] ;
+    }
+    free(thread_biasCor[t].SUMBIAS);  free(thread_biasCor[t].SUMWGT);
+    free(thread_biasCor[t].sum);      free(thread_biasCor[t].sumsq);
+    free(thread_biasCor[t].NperCell);
+  }
+
+  // convert sums in each IZ,LCFIT bin into mean bias;
+  // each thread works on a different range of cells.
+  for(t=0; t < nthread; t++ ) {
+    thread_biasCor[t].SUMBIAS  = SUMBIAS ;
+    thread_biasCor[t].SUMWGT   = SUMWGT ;
+    thread_biasCor[t].sum      = sum ;
+    thread_biasCor[t].sumsq    = sumsq ;
+    thread_biasCor[t].NperCell = CELLINFO_BIASCOR[IDSAMPLE].NperCell ;
+  }
+
+  exec_thread_biasCor(NCELL, makeMap_fitPar_biasCor_cells, 
+		      thread_biasCor, fnam);
+
+  NMAP_TOT = NCELL ;
+  NMAP_USE = 0 ;
+  for(t=0; t < nthread; t++ ) { NMAP_USE += thread_biasCor[t].NMAP_USE; }
 
-  for(isp=0; isp < NBIASCOR_CUTS; isp++ ) {
+  // -----------------------------------------------
+  // print grid-cell stats on last parameter
+  // (since it's the same for each parameter)
+  if ( ipar_LCFIT == INFO_BIASCOR.ILCPAR_MAX ) {
+    fprintf(FP_STDOUT,
+	   "  BiasCor computed for %d of %d grid-cells with >=1 events.\n",
+	   NMAP_USE, NMAP_TOT ) ;
+    fprintf(FP_STDOUT,
+	   "  BiasCor sample: %d of %d pass cuts for IDSAMPLE=%d.\n",
+	   NEVT_USE, NEVT_SAMPLE, IDSAMPLE );
+
+    if ( NEVT_USE == 0 ) {
+      print_eventStats(EVENT_TYPE_BIASCOR);
+      sprintf(c1err,"No BiasCor events passed for %s", 
+	      SAMPLE_BIASCOR[IDSAMPLE].NAME );
+      sprintf(c2err,"Check BiasCor file" );
+      errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err);     
+    }
+
+    fflush(FP_STDOUT);
+  }
+  
+
+  // -----------------
+  // debug dump
+  LDMP = 0 ; 
+  if ( LDMP ) {
+    iz=7; im=0; ix1=5; ic=6; ia=0; ib=0;
+    J1D = CELLINFO_BIASCOR[IDSAMPLE].MAPCELL[ia][ib][ig][iz][im][ix1][ic] ;
+    VAL = INFO_BIASCOR.FITPARBIAS[IDSAMPLE][J1D].VAL[ipar_LCFIT];
+    ERR = INFO_BIASCOR.FITPARBIAS[IDSAMPLE][J1D].ERR[ipar_LCFIT];
+
+    printf(" xxx --------------------------------------- \n");
+    printf(" xxx %s-bias = %.3f +- %.3f for \n"
+	   " xxx \t z[%.3f:%.3f] x1[%.3f:%.3f] c[%.3f:%.3f]  N=%d\n"
+	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_LCFIT[ipar_LCFIT].varName
+	   ,VAL, ERR
+	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_z.lo[iz]
+	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_z.hi[iz]
+	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_LCFIT[INDEX_x1].lo[ix1]
+	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_LCFIT[INDEX_x1].hi[ix1]
+	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_LCFIT[INDEX_c].lo[ic]
+	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_LCFIT[INDEX_c].hi[ic]
+	   ,CELLINFO_BIASCOR[IDSAMPLE].NperCell[J1D] 	   );
+    fflush(stdout);
+    debugexit(fnam);
+  }
+  // ------------
+
+  fflush(FP_STDOUT);
+
+  print_debug_malloc(-1*debug_malloc,fnam);
+  free(SUMBIAS); free(SUMWGT); free(sum); free(sumsq);
+
+  return ;
+
+} //end makeMap_fitPar_biasCor
+
+// =================================================================
+void *makeMap_fitPar_biasCor_sums(void *thread) {
+
+  // Created Oct 2026 [code moved from makeMap_fitPar_biasCor]
+  // Sum bias in each biasCor cell for biasCor rows 
+  // isp = imin to imax-1. Sums are thread-local and are summed 
+  // over threads in makeMap_fitPar_biasCor.
+
+  thread_biasCor_def *thread_biasCor = (thread_biasCor_def *)thread;
+  int    IDSAMPLE    = thread_biasCor->IDSAMPLE ;
+  int    ipar_LCFIT  = thread_biasCor->ipar_LCFIT ;
+  double *SUMBIAS    = thread_biasCor->SUMBIAS ;
+  double *SUMWGT     = thread_biasCor->SUMWGT ;
+  double *sum        = thread_biasCor->sum ;
+  double *sumsq      = thread_biasCor->sumsq ;
+  int    *NperCell   = thread_biasCor->NperCell ;
+
+  float *ptr_fitpar  = INFO_BIASCOR.TABLEVAR.fitpar[ipar_LCFIT] ;
+  float *ptr_simpar  = INFO_BIASCOR.TABLEVAR.SIM_FITPAR[ipar_LCFIT] ;
+  float *ptr_gammadm = INFO_BIASCOR.TABLEVAR.SIM_GAMMADM ;
+
+  int    isp, ievt, J1D, NEVT_SAMPLE=0, NEVT_USE=0 ;
+  double fit_val, sim_val, biasVal, sim_gammadm, WGT ;
+  char fnam[] = "makeMap_fitPar_biasCor_sums" ;
+
+  // ----------------- BEGIN -----------------
+
+  for(isp=thread_biasCor->imin; isp < thread_biasCor->imax; isp++ ) {
 
     ievt = SAMPLE_BIASCOR[IDSAMPLE].IROW_CUTS[isp];
-    LDMP = ( ievt < -5 );
     NEVT_SAMPLE++ ;
 
     // get bias for ipar_LCFIT = mB,x1 or c
@@ -9861,28 +10144,52 @@ void makeMap_fitPar_biasCor(int IDSAMPLE, int ipar_LCFIT) {
 
     // -----------------
     NEVT_USE++ ;
-    CELLINFO_BIASCOR[IDSAMPLE].NperCell[J1D]++ ;
+    NperCell[J1D]++ ;
   }
 
-  // convert sums in each IZ,LCFIT bin into mean bias,
-  
-  int    NMAP_TOT = 0 ;
-  int    NMAP_USE = 0 ;
+  thread_biasCor->NEVT_SAMPLE = NEVT_SAMPLE ;
+  thread_biasCor->NEVT_USE    = NEVT_USE ;
+
+  return(NULL);
+
+} // end makeMap_fitPar_biasCor_sums
+
+
+// =================================================================
+void *makeMap_fitPar_biasCor_cells(void *thread) {
+
+  // Created Oct 2026 [code moved from makeMap_fitPar_biasCor]
+  // Convert sums into mean bias, error and RMS for cells 
+  // J1D = imin to imax-1, and store in global FITPARBIAS.
+
+  thread_biasCor_def *thread_biasCor = (thread_biasCor_def *)thread;
+  int    IDSAMPLE    = thread_biasCor->IDSAMPLE ;
+  int    ipar_LCFIT  = thread_biasCor->ipar_LCFIT ;
+  double *SUMBIAS    = thread_biasCor->SUMBIAS ;
+  double *SUMWGT     = thread_biasCor->SUMWGT ;
+  double *sum        = thread_biasCor->sum ;
+  double *sumsq      = thread_biasCor->sumsq ;
+  int    *NperCell   = thread_biasCor->NperCell ;
+  int    NCELL       = CELLINFO_BIASCOR[IDSAMPLE].NCELL ;
+
+  int    J1DNBR_LIST[MXJ1DNBR], NJ1DNBR ;
+  int    J1D, N, NMAP_USE = 0 ;
+  double VAL, ERR, RMS, SQRMS, XN, XNLIST, tmp1, tmp2 ;
   double sumsq_nbr, sum_nbr ;
   int    Nsum_nbr, J1D_nbr, inbr ;
-  int    NgetList = 0 ;
+  char fnam[] = "makeMap_fitPar_biasCor_cells" ;
+
+  // ----------------- BEGIN -----------------
 
-  for(J1D=0; J1D < NCELL; J1D++ ) {
+  for(J1D=thread_biasCor->imin; J1D < thread_biasCor->imax; J1D++ ) {
 
-    NMAP_TOT++ ;  
-    N   = CELLINFO_BIASCOR[IDSAMPLE].NperCell[J1D] ;
+    N   = NperCell[J1D] ;
     XN  = (double)N ;
 
     if ( N < 1 ) { continue ; }
 	
     NMAP_USE++ ;
 	
-    WGT = SUMWGT[J1D] ;               // WGT
     VAL = SUMBIAS[J1D]/SUMWGT[J1D] ;  // wgted bias value
 
     // if too few events in cell, sum 3x3 nbr grid to get
@@ -9896,7 +10203,6 @@ void makeMap_fitPar_biasCor(int IDSAMPLE, int ipar_LCFIT) {
 	sprintf(c2err,"J1D=%d", J1D);
 	errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err);     
       }
-      NgetList++ ;
     }
 
     sumsq_nbr = sum_nbr = 0.0 ;  Nsum_nbr=0;
@@ -9910,7 +10216,7 @@ void makeMap_fitPar_biasCor(int IDSAMPLE, int ipar_LCFIT) {
       }
       sumsq_nbr += sumsq[J1D_nbr] ;
       sum_nbr   += sum[J1D_nbr] ;
-      Nsum_nbr  += CELLINFO_BIASCOR[IDSAMPLE].NperCell[J1D_nbr] ;
+      Nsum_nbr  += NperCell[J1D_nbr] ;
     }
     XNLIST = (double)Nsum_nbr ;
 
@@ -9926,64 +10232,12 @@ void makeMap_fitPar_biasCor(int IDSAMPLE, int ipar_LCFIT) {
 
   } // end J1D loop
 
+  thread_biasCor->NMAP_USE = NMAP_USE ;
 
-  // -----------------------------------------------
-  // print grid-cell stats on last parameter
-  // (since it's the same for each parameter)
-  if ( ipar_LCFIT == INFO_BIASCOR.ILCPAR_MAX ) {
-    fprintf(FP_STDOUT,
-	   "  BiasCor computed for %d of %d grid-cells with >=1 events.\n",
-	   NMAP_USE, NMAP_TOT ) ;
-    fprintf(FP_STDOUT,
-	   "  BiasCor sample: %d of %d pass cuts for IDSAMPLE=%d.\n",
-	   NEVT_USE, NEVT_SAMPLE, IDSAMPLE );
-
-    if ( NEVT_USE == 0 ) {
-      print_eventStats(EVENT_TYPE_BIASCOR);
-      sprintf(c1err,"No BiasCor events passed for %s", 
-	      SAMPLE_BIASCOR[IDSAMPLE].NAME );
-      sprintf(c2err,"Check BiasCor file" );
-      errlog(FP_STDOUT, SEV_FATAL, fnam, c1err, c2err);     
-    }
-
-    fflush(FP_STDOUT);
-  }
-  
-
-  // -----------------
-  // debug dump
-  LDMP = 0 ; 
-  if ( LDMP ) {
-    iz=7; im=0; ix1=5; ic=6; ia=0; ib=0;
-    J1D = CELLINFO_BIASCOR[IDSAMPLE].MAPCELL[ia][ib][ig][iz][im][ix1][ic] ;
-    VAL = INFO_BIASCOR.FITPARBIAS[IDSAMPLE][J1D].VAL[ipar_LCFIT];
-    ERR = INFO_BIASCOR.FITPARBIAS[IDSAMPLE][J1D].ERR[ipar_LCFIT];
-
-    printf(" xxx --------------------------------------- \n");
-    printf(" xxx %s-bias = %.3f +- %.3f for \n"
-	   " xxx \t z[%.3f:%.3f] x1[%.3f:%.3f] c[%.3f:%.3f]  N=%d\n"
-	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_LCFIT[ipar_LCFIT].varName
-	   ,VAL, ERR
-	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_z.lo[iz]
-	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_z.hi[iz]
-	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_LCFIT[INDEX_x1].lo[ix1]
-	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_LCFIT[INDEX_x1].hi[ix1]
-	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_LCFIT[INDEX_c].lo[ic]
-	   ,CELLINFO_BIASCOR[IDSAMPLE].BININFO_LCFIT[INDEX_c].hi[ic]
-	   ,CELLINFO_BIASCOR[IDSAMPLE].NperCell[J1D] 	   );
-    fflush(stdout);
-    debugexit(fnam);
-  }
-  // ------------
-
-  fflush(FP_STDOUT);
+  return(NULL);
 
-  print_debug_malloc(-1*debug_malloc,fnam);
-  free(SUMBIAS); free(SUMWGT); free(sum); free(sumsq);
-
-  return ;
+} // end makeMap_fitPar_biasCor_cells
 
-} //end makeMap_fitPar_biasCor
 
 // =============================
 void get_J1DNBR_LIST(int IDSAMPLE, int J1D, int *NJ1DNBR, int *J1DNBR_LIST) {
@@ -11286,6 +11540,9 @@ void init_COVINT_biasCor(void) {
   // * For emprical method (IDEAL_COVINT=1), compute COV in bins of
   //   idsample,redshift,alpha,beta
   //
+  // Oct 16 2026: use nthread option to split loop over biasCor events
+  //              with thread-local sums (init_COVINT_biasCor_sums)
+  //
 
   int  DO_IDEAL_COVINT = ( INPUTS.opt_biasCor & MASK_BIASCOR_COVINT ) ;
   int  DO_COV00_ONLY   = ( DO_IDEAL_COVINT ==0 ) ;
@@ -11294,7 +11551,7 @@ void init_COVINT_biasCor(void) {
   int  Na       = INFO_BIASCOR.BININFO_SIM_ALPHA.nbin ;
   int  Nb       = INFO_BIASCOR.BININFO_SIM_BETA.nbin ;
   int  Ng       = INFO_BIASCOR.BININFO_SIM_GAMMADM.nbin ;
-  int  Nz, idsample, iz, ia, ib, ig, ievt, ipar, ipar2 ; 
+  int  Nz, idsample, iz, ia, ib, ig, ipar, ipar2 ; 
   double sigInt, COV ;
   char fnam[] = "init_COVINT_biasCor" ;
 
@@ -11344,10 +11601,132 @@ void init_COVINT_biasCor(void) {
   //   COV(x,y) = sum[(x-xtrue)*(y-ytrue) ] / N
 
 
+  int nthread = INPUTS.nthread ;
   int NBIASCOR_IDEAL=0, NBIASCOR_CUTS=0 ;
+  int NZMAX=0, NCOVBIN, icov, t ;
+  thread_biasCor_def thread_biasCor[MXTHREAD] ;
+
+  // thread-local sums use compact index for idsample,iz,ia,ib,ig
+  for(idsample=0; idsample < NSAMPLE; idsample++ ) {
+    Nz = CELLINFO_BIASCOR[idsample].BININFO_z.nbin ;
+    if ( Nz > NZMAX ) { NZMAX = Nz; }
+  }
+  NCOVBIN = NSAMPLE * NZMAX * Na * Nb * Ng ;
+
+  for(t=0; t < nthread; t++ ) {
+    thread_biasCor[t].NEVT_COV = (int   *)calloc(NCOVBIN,sizeof(int));
+    thread_biasCor[t].SUMCOV   = 
+      (double*)calloc(NCOVBIN*NLCPAR*NLCPAR,sizeof(double));
+  }
+
+  exec_thread_biasCor(NROW_TOT, init_COVINT_biasCor_sums,
+		      thread_biasCor, fnam);
+
+  // sum threads in fixed order
+  for(t=0; t < nthread; t++ ) {
+    NBIASCOR_CUTS  += thread_biasCor[t].NBIASCOR_CUTS ;
+    NBIASCOR_IDEAL += thread_biasCor[t].NBIASCOR_IDEAL ;
+
+    for(idsample=0; idsample < NSAMPLE; idsample++ ) {
+      for(iz=0; iz < NZMAX; iz++ ) {
+	for(ia=0; ia < Na; ia++ ) {
+	  for(ib=0; ib < Nb; ib++ ) {
+	    for(ig=0; ig < Ng; ig++ ) {
+	      icov = INDEX_COVINT_THREAD(idsample,iz,ia,ib,ig);
+	      if ( thread_biasCor[t].NEVT_COV[icov] == 0 ) { continue; }
+	      INFO_BIASCOR.NEVT_COVINT[idsample][iz][ia][ib][ig] += 
+		thread_biasCor[t].NEVT_COV[icov] ;
+	      for(ipar=0; ipar < NLCPAR; ipar++ ) {
+		for(ipar2=ipar; ipar2 < NLCPAR; ipar2++ ) {
+		  INFO_BIASCOR.COVINT[idsample][iz][ia][ib][ig].VAL[ipar][ipar2]
+		    += thread_biasCor[t].SUMCOV[icov*NLCPAR*NLCPAR + 
+						ipar*NLCPAR + ipar2] ;
+		  INFO_BIASCOR.COVINT[idsample][iz][ia][ib][ig].VAL[ipar2][ipar]
+		    = INFO_BIASCOR.COVINT[idsample][iz][ia][ib][ig].VAL[ipar][ipar2];
+		}
+	      }
+	    } // end ig
+	  } // end ib
+	} // end ia
+      } // end iz
+    } // end idsample
+
+    free(thread_biasCor[t].NEVT_COV);
+    free(thread_biasCor[t].SUMCOV);
+  } // end t
+
+
+  fprintf(FP_STDOUT, "\t %d of %d BiasCor events have IDEAL fit params. \n",
+	 NBIASCOR_IDEAL, NBIASCOR_CUTS);
+  fflush(FP_STDOUT) ;
+
+  // - - - - - - - - - - - - - - - - - 
+
+  // divide each sum-term by N, and load symmetric part of matrix
+  int N;
+  double XNINV;
+
+  for(idsample=0; idsample < NSAMPLE; idsample++ ) {
+    Nz       = CELLINFO_BIASCOR[idsample].BININFO_z.nbin ;
+    for(iz=0; iz < Nz; iz++ ) {
+      for(ia=0; ia < Na; ia++ ) {
+	for(ib=0; ib < Nb; ib++ ) {
+	  for(ig=0; ig < Ng; ig++ ) {
+	  
+	    N = INFO_BIASCOR.NEVT_COVINT[idsample][iz][ia][ib][ig]; 
+	    if ( N > 0 ) {
+	      XNINV = 1.0/(double)N;
+	      scale_COV(XNINV,INFO_BIASCOR.COVINT[idsample][iz][ia][ib][ig].VAL);
+	    }
+	    
+	    
+	    if ( iz < -4 ) { dump_COVINT_biasCor(idsample,iz,ia,ib,ig); }
+	  } // end ig
+	}
+      }
+    }
+  }
+
+  
+  write_COVINT_biasCor();
+
+
+  return ;
+
+} // end init_COVINT_biasCor
+
+
+// =================================================================
+void *init_COVINT_biasCor_sums(void *thread) {
+
+  // Created Oct 2026 [code moved from init_COVINT_biasCor]
+  // For biasCor rows ievt = imin to imax-1, sum 
+  //   (x-xtrue)*(y-ytrue) 
+  // in thread-local arrays using compact bin index from 
+  // INDEX_COVINT_THREAD; sums are added to global COVINT
+  // in init_COVINT_biasCor.
+
+  thread_biasCor_def *thread_biasCor = (thread_biasCor_def *)thread;
+  int    *NEVT_COV   = thread_biasCor->NEVT_COV ;
+  double *SUMCOV     = thread_biasCor->SUMCOV ;
+  int  NSAMPLE  = NSAMPLE_BIASCOR ;
+  int  Na       = INFO_BIASCOR.BININFO_SIM_ALPHA.nbin ;
+  int  Nb       = INFO_BIASCOR.BININFO_SIM_BETA.nbin ;
+  int  Ng       = INFO_BIASCOR.BININFO_SIM_GAMMADM.nbin ;
+  int  NZMAX    = 0 ;
+  int  NBIASCOR_IDEAL=0, NBIASCOR_CUTS=0 ;
+  int  Nz, idsample, iz, ia, ib, ig, ievt, ipar, ipar2, icov ;
   double tmpVal, tmpVal2, x0_IDEAL, mB_IDEAL ;
+  //  char fnam[] = "init_COVINT_biasCor_sums" ;
+
+  // ----------------- BEGIN -----------------
+
+  for(idsample=0; idsample < NSAMPLE; idsample++ ) {
+    Nz = CELLINFO_BIASCOR[idsample].BININFO_z.nbin ;
+    if ( Nz > NZMAX ) { NZMAX = Nz; }
+  }
 
-  for(ievt=0; ievt < NROW_TOT; ievt++ ) {
+  for(ievt=thread_biasCor->imin; ievt < thread_biasCor->imax; ievt++ ) {
 
     // apply selection
     if ( INFO_BIASCOR.TABLEVAR.CUTMASK[ievt] ) { continue; }
@@ -11368,17 +11747,19 @@ void init_COVINT_biasCor(void) {
       INFO_BIASCOR.TABLEVAR.SIM_FITPAR[INDEX_mB][ievt] ;
     if ( fabs(tmpVal) > 1.0 ) { continue ; }
 
-
     idsample = (int)INFO_BIASCOR.TABLEVAR.IDSAMPLE[ievt];
     ia       = (int)INFO_BIASCOR.IA[ievt] ; // true alpha index
     ib       = (int)INFO_BIASCOR.IB[ievt] ; // true beta index
     ig       = (int)INFO_BIASCOR.IG[ievt] ; // true gamma DM
-
-    // use true or meaured redshift ??? [7.01.2020]
     iz       = (int)INFO_BIASCOR.IZ[ievt] ; // true zcmb index
-    //    z        = (int)INFO_BIASCOR.TABLEVAR.SIM_ZCMB[ievt] ;
 
-    INFO_BIASCOR.NEVT_COVINT[idsample][iz][ia][ib][ig]++ ;
+    NBIASCOR_IDEAL++ ;
+
+    // z-bins beyond NZMAX are never used for COVINT
+    if ( iz < 0 || iz >= NZMAX ) { continue; }
+
+    icov = INDEX_COVINT_THREAD(idsample,iz,ia,ib,ig);
+    NEVT_COV[icov]++ ;
 
     for(ipar=0; ipar < NLCPAR; ipar++ ) {
       for(ipar2=ipar; ipar2 < NLCPAR; ipar2++ ) {
@@ -11391,64 +11772,19 @@ void init_COVINT_biasCor(void) {
 	  INFO_BIASCOR.TABLEVAR.fitpar_ideal[ipar2][ievt] -
 	  INFO_BIASCOR.TABLEVAR.SIM_FITPAR[ipar2][ievt] ;
 
-	/* xxxxxxxxxxxx
-	if ( ievt < 100 && ipar==0 && ipar2==0 ) {
-	  printf(" xxx diff[%d][%d] = %f, %f \n",
-		 ipar, ipar2, tmpVal, tmpVal2 );
-	}
-	xxxxxxxxxxx*/
-
-	INFO_BIASCOR.COVINT[idsample][iz][ia][ib][ig].VAL[ipar][ipar2] 
-	  += (tmpVal * tmpVal2) ;
-
-	INFO_BIASCOR.COVINT[idsample][iz][ia][ib][ig].VAL[ipar2][ipar] =
-	  INFO_BIASCOR.COVINT[idsample][iz][ia][ib][ig].VAL[ipar][ipar2] ;
+	SUMCOV[icov*NLCPAR*NLCPAR + ipar*NLCPAR + ipar2] += (tmpVal*tmpVal2);
       }
     }
 
-    NBIASCOR_IDEAL++ ;
-
   } // end ievt loop
 
+  thread_biasCor->NBIASCOR_CUTS  = NBIASCOR_CUTS ;
+  thread_biasCor->NBIASCOR_IDEAL = NBIASCOR_IDEAL ;
 
-  fprintf(FP_STDOUT, "\t %d of %d BiasCor events have IDEAL fit params. \n",
-	 NBIASCOR_IDEAL, NBIASCOR_CUTS);
-  fflush(FP_STDOUT) ;
-
-  // - - - - - - - - - - - - - - - - - 
-
-  // divide each sum-term by N, and load symmetric part of matrix
-  int N;
-  double XNINV;
-
-  for(idsample=0; idsample < NSAMPLE; idsample++ ) {
-    Nz       = CELLINFO_BIASCOR[idsample].BININFO_z.nbin ;
-    for(iz=0; iz < Nz; iz++ ) {
-      for(ia=0; ia < Na; ia++ ) {
-	for(ib=0; ib < Nb; ib++ ) {
-	  for(ig=0; ig < Ng; ig++ ) {
-	  
-	    N = INFO_BIASCOR.NEVT_COVINT[idsample][iz][ia][ib][ig]; 
-	    if ( N > 0 ) {
-	      XNINV = 1.0/(double)N;
-	      scale_COV(XNINV,INFO_BIASCOR.COVINT[idsample][iz][ia][ib][ig].VAL);
-	    }
-	    
-	    
-	    if ( iz < -4 ) { dump_COVINT_biasCor(idsample,iz,ia,ib,ig); }
-	  } // end ig
-	}
-      }
-    }
-  }
-
-  
-  write_COVINT_biasCor();
-
+  return(NULL);
 
-  return ;
+} // end init_COVINT_biasCor_sums
 
-} // end init_COVINT_biasCor
 
 
 // ======================================================
@@ -16305,6 +16641,9 @@ int ppar(char* item) {
   if ( uniqueOverlap(item,"nthread=")) 
     { sscanf(&item[8],"%d", &INPUTS.nthread); return(1); }
 
+  if ( uniqueOverlap(item,"cache_fitres=")) 
+    { sscanf(&item[13],"%d", &INPUTS.cache_fitres); return(1); }
+
   return(0);
   
 } // end ppar
@@ -18236,6 +18575,9 @@ void prep_input_driver(void) {
     }
   }
 
+  // Oct 2026: optional binary cache for reading FITRES tables
+  READTABLE_CACHE.USE = ( INPUTS.cache_fitres > 0 );
+
 
   return ;
 
@@ -21413,6 +21755,8 @@ void print_SALT2mu_HELP(void) {
     "# - - - - - SUBPROCESS options (for population fitter)  - - - - - ",
     "",
     "nthread=<n>                  # use pthread for multiple cores on same node",
+    "cache_fitres=1               # read/write binary [file].SNCACHE "
+    "to skip text parsing",
     "SALT2mu.exe SUBPROCESS_HELP  # SUBPROCESS help menu",
     "",
     "",
@@ -210,6 +210,9 @@ int init_genmag_SALT2(char *MODEL_VERSION, char *MODEL_EXTRAP_LATETIME,
   }
   DEBUG_SALT2 = ( OPTMASK & OPTMASK_SALT2_DEBUG );
 
+  // Oct 2026: check option for band-flux tables
+  init_FLUXTABLE_SALT2(OPTMASK);
+
   // summarize filter info
   filtdump_SEDMODEL();
 
@@ -2675,6 +2678,9 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
   //   + check ALLOW_NEGFLUX_SALT2 to allow or avoid negative spectral flux.
   //
   // May 31 2021: refactor to pass parList_SN and parList_HOST
+  // Oct 16 2026: check FLUXTABLE_SALT2 option for table lookup
+  // Oct 16 2026: for broadband filters, integrate with shared 
+  //              SEDKERNEL (vectorized) loop
 
 
   // strip of SN and HOST params
@@ -2706,6 +2712,11 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
     ,hc8 = (double)hc ;
 
   int  DO_SPECTROGRAPH = ( ifilt_obs == JFILT_SPECTROGRAPH ) ;
+  int  NBIN_KERNEL = 0, inode ;
+
+  // shared kernel requires per-bin flux to be linear in SED surfaces
+  bool USE_SEDKERNEL = ( OPT_SPEC == 0 && ALLOW_NEGFLUX_SALT2 && 
+			 !DO_SPECTROGRAPH );
 
   char *cfilt ;
   char fnam[] = "INTEG_zSED_SALT2" ;
@@ -2720,6 +2731,12 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
 
   Fnorm_SALT3 = 0.0 ; // for SALT3
 
+  // Oct 2026: check option for band-flux table lookup
+  if ( FLUXTABLE_SALT2.USE && OPT_SPEC == 0 ) {
+    if ( INTEG_FLUXTABLE_SALT2(ifilt_obs, z, Tobs, parList_SN, parList_HOST,
+			       Finteg, Finteg_errPar) ) { return; }
+  }
+
   ifilt     = IFILTMAP_SEDMODEL[ifilt_obs] ;
   NLAMFILT  = FILTER_SEDMODEL[ifilt].NLAM ;
   cfilt     = FILTER_SEDMODEL[ifilt].name ;
@@ -2894,6 +2911,33 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
       
       CCOR = CCOR_LAM0 + (CCOR_LAM1-CCOR_LAM0)*FRAC_INTERP_LAMSED ;
 
+      if ( USE_SEDKERNEL ) {
+	// Oct 2026: load SEDKERNEL buffers with day-interpolated SED 
+	// at both lambda nodes; integrate after ilamobs loop.
+	for(ised=0; ised<=1; ised++ ) {
+	  for(inode=0; inode < 2; inode++ ) {
+	    VAL0 = ptr_FLUXSED[ised][0][ilamsed+inode] ;
+	    VAL1 = ptr_FLUXSED[ised][1][ilamsed+inode] ;
+	    FSED[inode] = VAL0 + (VAL1-VAL0)*FRAC_INTERP_DAY ;
+	  }
+	  SEDKERNEL.FLUX0[ised][NBIN_KERNEL] = FSED[0] ;
+	  SEDKERNEL.FLUX1[ised][NBIN_KERNEL] = FSED[1] ;
+	}
+
+	FSMEAR = 1.0 ;
+	if ( ISTAT_GENSMEAR ) {
+	  arg     =  -0.4*GENSMEAR.MAGSMEAR_LIST[ilamobs] ; 
+	  FSMEAR  =  pow(TEN,arg)  ; 
+	}
+
+	FTMP = FSMEAR * CCOR * HOSTXT_FRAC * LAMSED * TRANS ;
+	SEDKERNEL.FRAC[NBIN_KERNEL]   = FRAC_INTERP_LAMSED ;
+	SEDKERNEL.WGT[0][NBIN_KERNEL] = FTMP * MWXT_FRAC ; // for flux
+	SEDKERNEL.WGT[1][NBIN_KERNEL] = FTMP ;             // for error
+	NBIN_KERNEL++ ;
+	continue ;
+      }
+
       // interpolate SED Fluxes to LAMSED
       for(ised=0; ised<=1; ised++ ) {
 	for ( iday=0; iday<nday; iday++ ) {
@@ -2969,6 +3013,21 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
 
   } // end ilamobs loop over obs filter
 
+  // - - - - - - - - - - 
+  // Oct 2026: integrate SEDKERNEL buffers with shared kernel
+  if ( USE_SEDKERNEL ) {
+    for(ised=0; ised < 2; ised++ ) {
+      Finteg_filter[ised] = 
+	integ_SEDKERNEL(NBIN_KERNEL, 
+			SEDKERNEL.FLUX0[ised], SEDKERNEL.FLUX1[ised],
+			SEDKERNEL.FRAC, SEDKERNEL.WGT[0] );
+      Finteg_forErr[ised] = 
+	integ_SEDKERNEL(NBIN_KERNEL, 
+			SEDKERNEL.FLUX0[ised], SEDKERNEL.FLUX1[ised],
+			SEDKERNEL.FRAC, SEDKERNEL.WGT[1] );
+    }
+  }
+
   // - - - - - - - - - - 
   // compute total flux in filter
   *Finteg  = x0 * ( Finteg_filter[0] + x1 * Finteg_filter[1] );
@@ -2993,6 +3052,328 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
 } // end of INTEG_zSED_SALT2
 
 
+// **********************************************
+void init_FLUXTABLE_SALT2(int OPTMASK) {
+
+  // Created Oct 2026
+  // Init optional tables of filter-integrated fluxes used to replace
+  // the brute-force integration in INTEG_zSED_SALT2.
+  // Tables are filled on first use for each band and z-bin
+  // (see fill_FLUXTABLE_SALT2). On re-init, previous tables are freed.
+  //
+  // OPTMASK & OPTMASK_SALT2_FLUXTABLE       -> use tables
+  // OPTMASK & OPTMASK_SALT2_FLUXTABLE_CHECK -> use tables and compare
+  //                                            each flux with exact integ.
+
+  int ifilt, iz ;
+
+  // ------------- BEGIN ------------
+
+  for(ifilt=0; ifilt < MXFILT_SEDMODEL; ifilt++ ) {
+    if ( FLUXTABLE_SALT2.ZBIN[ifilt] == NULL ) { continue; }
+    for(iz=0; iz < MXZBIN_FLUXTABLE_SALT2; iz++ ) {
+      if ( FLUXTABLE_SALT2.ZBIN[ifilt][iz].COEF != NULL ) 
+	{ free(FLUXTABLE_SALT2.ZBIN[ifilt][iz].COEF); }
+    }
+    free(FLUXTABLE_SALT2.ZBIN[ifilt]);
+    FLUXTABLE_SALT2.ZBIN[ifilt] = NULL ;
+  }
+
+  FLUXTABLE_SALT2.CHECK = ( OPTMASK & OPTMASK_SALT2_FLUXTABLE_CHECK ) > 0;
+  FLUXTABLE_SALT2.USE   = ( OPTMASK & OPTMASK_SALT2_FLUXTABLE ) > 0 ||
+    FLUXTABLE_SALT2.CHECK ;
+
+  FLUXTABLE_SALT2.DZBIN          = DZBIN_FLUXTABLE_SALT2 ;
+  FLUXTABLE_SALT2.NZBIN_FILLED   = 0 ;
+  FLUXTABLE_SALT2.NCALL_TABLE    = 0 ;
+  FLUXTABLE_SALT2.NCALL_EXACT    = 0 ;
+  FLUXTABLE_SALT2.NCALL_CHECK    = 0 ;
+  FLUXTABLE_SALT2.DMAG_CHECK_MAX = 0.0 ;
+  FLUXTABLE_SALT2.DMAG_CHECK_SUM = 0.0 ;
+
+  if ( FLUXTABLE_SALT2.USE ) {
+    printf("\t OPTMASK=%d -> use band-flux tables with dz=%.3f "
+	   "(CHECK=%d)\n", 
+	   OPTMASK, FLUXTABLE_SALT2.DZBIN, FLUXTABLE_SALT2.CHECK );
+    fflush(stdout);
+  }
+
+  return ;
+
+} // end init_FLUXTABLE_SALT2
+
+
+// **********************************************
+void fill_FLUXTABLE_SALT2(int ifilt, int iz) {
+
+  // Created Oct 2026
+  // Fill band-flux table for sparse filter index ifilt and z-bin iz.
+  // For each day on the SALT2 SED grid, store integral over filter bins
+  // of SED flux (M0 and M1) times 
+  //     exp(B) * [A^j/j!] * [(-M)^k/k!] * LAMSED * TRANS
+  // where colorCor(c) = exp(B + c*A) and MWXT = exp(-mwebv*M).
+  // Summing over j,k with c^j * mwebv^k then gives the same integrand
+  // as in INTEG_zSED_SALT2 (without host extinction and genSmear).
+  // Integrals are summed in double, then stored as float.
+
+  FLUXTABLE_ZBIN_SALT2_DEF *ZBIN = &FLUXTABLE_SALT2.ZBIN[ifilt][iz] ;
+  int    NDAY     = SALT2_TABLE.NDAY ;
+  int    NLAMFILT = FILTER_SEDMODEL[ifilt].NLAM ;
+  int    NC       = NCOLOR_FLUXTABLE_SALT2 ;
+  int    NM       = NMWXT_FLUXTABLE_SALT2 ;
+  int    NCOEF    = NCOEF_FLUXTABLE_SALT2 ;
+  int    NBASIS   = NC * NM ;
+  int    OPT_COLORLAW = MWXT_SEDMODEL.OPT_COLORLAW ;
+  double RV       = MWXT_SEDMODEL.RV ;
+  double z1       = 1.0 + FLUXTABLE_SALT2.DZBIN * (double)iz ;
+  double LN10     = log(10.0) ;
+
+  int    ilamobs, ilamsed, iday, ised, j, k, ib, icoef ;
+  double LAMOBS, LAMSED, TRANS, FRAC, A, B, M, W, CCOR0, CCOR1 ;
+  double VAL0, VAL1, FSED, APOW[NCOLOR_FLUXTABLE_SALT2] ;
+  double MPOW[NMWXT_FLUXTABLE_SALT2], BASIS[NCOEF_FLUXTABLE_SALT2] ;
+  double *COEF8, *ptr ;
+
+  // ------------- BEGIN ------------
+
+  COEF8 = (double*) calloc(NDAY*NCOEF, sizeof(double) );
+  ZBIN->AMAX = ZBIN->MMAX = ZBIN->FNORM = 0.0 ;
+
+  for ( ilamobs=0; ilamobs < NLAMFILT; ilamobs++ ) {
+
+    get_LAMTRANS_SEDMODEL(ifilt,ilamobs, &LAMOBS, &TRANS);
+    if ( TRANS < 1.0E-12 ) { continue ; }
+
+    LAMSED = LAMOBS / z1 ;
+    if ( LAMSED <= SALT2_TABLE.LAMMIN ) { continue ; }
+    if ( LAMSED >= SALT2_TABLE.LAMMAX ) { continue ; } 
+
+    ZBIN->FNORM += (TRANS * LAMOBS) ;
+
+    ilamsed = (int)((LAMSED - SALT2_TABLE.LAMMIN)/SALT2_TABLE.LAMSTEP) ;
+    FRAC    = (LAMSED - SALT2_TABLE.LAMSED[ilamsed])/SALT2_TABLE.LAMSTEP ;
+
+    // color law is exponential in c: get exponent slope A and offset B
+    CCOR0 = SALT2colorCor(LAMSED, 0.0);
+    CCOR1 = SALT2colorCor(LAMSED, 1.0);
+    B     = log(CCOR0) ;
+    A     = log(CCOR1) - B ;
+
+    // MW extinction per unit E(B-V)
+    M     = 0.4 * LN10 * GALextinct(RV, RV, LAMOBS, OPT_COLORLAW) ;
+
+    if ( fabs(A) > ZBIN->AMAX ) { ZBIN->AMAX = fabs(A); }
+    if ( M       > ZBIN->MMAX ) { ZBIN->MMAX = M ; }
+
+    W = exp(B) * LAMSED * TRANS ;
+    APOW[0] = MPOW[0] = 1.0 ;
+    for(j=1; j < NC; j++ ) { APOW[j] = APOW[j-1] * A / (double)j ; }
+    for(k=1; k < NM; k++ ) { MPOW[k] = MPOW[k-1] * (-M) / (double)k ; }
+    for(j=0; j < NC; j++ ) {
+      for(k=0; k < NM; k++ ) { BASIS[j*NM+k] = W * APOW[j] * MPOW[k]; }
+    }
+
+    for(iday=0; iday < NDAY; iday++ ) {
+      for(ised=0; ised < 2; ised++ ) {
+	VAL0 = SALT2_TABLE.SEDFLUX[ised][iday][ilamsed+0] ;
+	VAL1 = SALT2_TABLE.SEDFLUX[ised][iday][ilamsed+1] ;
+	FSED = VAL0 + (VAL1-VAL0)*FRAC ;
+	ptr  = &COEF8[iday*NCOEF + ised*NBASIS] ;
+	for(ib=0; ib < NBASIS; ib++ ) { ptr[ib] += FSED * BASIS[ib]; }
+      }
+    }
+
+  } // end ilamobs
+
+  ZBIN->COEF = (float*) malloc( NDAY*NCOEF*sizeof(float) );
+  for(icoef=0; icoef < NDAY*NCOEF; icoef++ ) 
+    { ZBIN->COEF[icoef] = (float)COEF8[icoef] ; }
+  free(COEF8);
+
+  FLUXTABLE_SALT2.NZBIN_FILLED++ ;
+
+  return ;
+
+} // end fill_FLUXTABLE_SALT2
+
+
+// **********************************************
+int INTEG_FLUXTABLE_SALT2(int ifilt_obs, double z, double Tobs, 
+			  double *parList_SN, double *parList_HOST,
+			  double *Finteg, double *Finteg_errPar ) {
+
+  // Created Oct 2026
+  // Table-lookup replacement for INTEG_zSED_SALT2 (OPT_SPEC=0).
+  // Bilinear interpolation in z and Trest of the band-flux table,
+  // followed by a dot product with powers of c and mwebv.
+  // Interpolation in Trest is exact since SEDs are linearly 
+  // interpolated in Trest; interpolation in z is approximate.
+  //
+  // Returns 1 if Finteg and Finteg_errPar are computed here.
+  // Returns 0 if the exact integral is needed: host extinction,
+  // genSmear, spectrograph, NONEGFLUX option, out-of-range z or Trest,
+  // or large color/MW terms where the Taylor basis is not accurate.
+
+  double x0       = parList_SN[0];
+  double x1       = parList_SN[1];
+  double c        = parList_SN[2];
+  double RV_host  = parList_HOST[0];
+  double AV_host  = parList_HOST[1];
+  double mwebv    = SEDMODEL_MWEBV_LAST ;
+
+  int    NC     = NCOLOR_FLUXTABLE_SALT2 ;
+  int    NM     = NMWXT_FLUXTABLE_SALT2 ;
+  int    NCOEF  = NCOEF_FLUXTABLE_SALT2 ;
+  int    NDAY   = SALT2_TABLE.NDAY ;
+  int    ifilt, iz, IDAY, jz, jd, ised, j, k ;
+  double XZ, FRAC_Z, Trest, FRAC_DAY, AMAX, MMAX, WGT, FTMP ;
+  double CPOW[NCOLOR_FLUXTABLE_SALT2], EPOW[NMWXT_FLUXTABLE_SALT2] ;
+  double Fsum[2], Ferr[2], FNORM, MODELNORM ;
+  float  *ptr ;
+  FLUXTABLE_ZBIN_SALT2_DEF *ZBIN ;
+  double hc8 = (double)hc ;
+
+  // ------------- BEGIN ------------
+
+  if ( ifilt_obs == JFILT_SPECTROGRAPH   ) { goto EXACT; }
+  if ( RV_host > 1.0E-9 && AV_host > 1.0E-9 ) { goto EXACT; }
+  if ( istat_genSmear()        ) { goto EXACT; }
+  if ( !ALLOW_NEGFLUX_SALT2    ) { goto EXACT; }
+  if ( mwebv < 0.0             ) { goto EXACT; }
+
+  ifilt  = IFILTMAP_SEDMODEL[ifilt_obs] ;
+
+  XZ     = z / FLUXTABLE_SALT2.DZBIN ;
+  iz     = (int)XZ ;
+  if ( iz < 0 || iz >= MXZBIN_FLUXTABLE_SALT2-1 ) { goto EXACT; }
+  FRAC_Z = XZ - (double)iz ;
+
+  Trest    = Tobs / (1.0 + z) ;
+  IDAY     = (int)( (Trest - SALT2_TABLE.DAY[0])/SALT2_TABLE.DAYSTEP ) ;
+  if ( IDAY < 0 || IDAY > NDAY-2 ) { goto EXACT; }
+  FRAC_DAY = (Trest - SALT2_TABLE.DAY[IDAY])/SALT2_TABLE.DAYSTEP ;
+
+  // fill z-bins on first use
+  if ( FLUXTABLE_SALT2.ZBIN[ifilt] == NULL ) {
+    FLUXTABLE_SALT2.ZBIN[ifilt] = (FLUXTABLE_ZBIN_SALT2_DEF*)
+      calloc(MXZBIN_FLUXTABLE_SALT2, sizeof(FLUXTABLE_ZBIN_SALT2_DEF));
+  }
+  ZBIN = &FLUXTABLE_SALT2.ZBIN[ifilt][iz] ;
+  for(jz=0; jz < 2; jz++ ) 
+    { if ( ZBIN[jz].COEF == NULL ) { fill_FLUXTABLE_SALT2(ifilt,iz+jz); } }
+
+  // check that truncated Taylor series is accurate
+  AMAX = MMAX = 0.0 ;
+  for(jz=0; jz < 2; jz++ ) {
+    if ( ZBIN[jz].AMAX > AMAX ) { AMAX = ZBIN[jz].AMAX; }
+    if ( ZBIN[jz].MMAX > MMAX ) { MMAX = ZBIN[jz].MMAX; }
+  }
+  if ( fabs(c)*AMAX > UMAX_COLOR_FLUXTABLE_SALT2 ) { goto EXACT; }
+  if ( mwebv  *MMAX > UMAX_MWXT_FLUXTABLE_SALT2  ) { goto EXACT; }
+
+  CPOW[0] = EPOW[0] = 1.0 ;
+  for(j=1; j < NC; j++ ) { CPOW[j] = CPOW[j-1] * c ; }
+  for(k=1; k < NM; k++ ) { EPOW[k] = EPOW[k-1] * mwebv ; }
+
+  Fsum[0] = Fsum[1] = Ferr[0] = Ferr[1] = 0.0 ;
+  FNORM   = (1.0-FRAC_Z)*ZBIN[0].FNORM + FRAC_Z*ZBIN[1].FNORM ;
+
+  for(jz=0; jz < 2; jz++ ) {
+    for(jd=0; jd < 2; jd++ ) {
+      WGT  = (jz ? FRAC_Z   : 1.0-FRAC_Z ) ;
+      WGT *= (jd ? FRAC_DAY : 1.0-FRAC_DAY ) ;
+      ptr  = &ZBIN[jz].COEF[(IDAY+jd)*NCOEF] ;
+      for(ised=0; ised < 2; ised++ ) {
+	for(j=0; j < NC; j++ ) {
+	  FTMP = 0.0 ;
+	  for(k=0; k < NM; k++ ) { FTMP += (double)ptr[k] * EPOW[k]; }
+	  Fsum[ised] += WGT * CPOW[j] * FTMP ;
+	  Ferr[ised] += WGT * CPOW[j] * (double)ptr[0] ; // no MWXT
+	  ptr += NM ;
+	}
+      }
+    }
+  }
+
+  MODELNORM = FILTER_SEDMODEL[ifilt].lamstep * SEDMODEL.FLUXSCALE / hc8 ;
+  *Finteg   = x0 * ( Fsum[0] + x1 * Fsum[1] ) * MODELNORM ;
+
+  *Finteg_errPar = 0.0 ;
+  if ( ISMODEL_SALT2 ) {
+    if ( Fsum[0] != 0.0 ) { *Finteg_errPar = Ferr[1] / Ferr[0] ; }
+  }
+  else if ( ISMODEL_SALT3 && FNORM > 0.0 ) {
+    *Finteg_errPar = ( Ferr[0] + x1 * Ferr[1] ) / FNORM ;
+  }
+
+  FLUXTABLE_SALT2.NCALL_TABLE++ ;
+
+  if ( FLUXTABLE_SALT2.CHECK ) {
+    check_FLUXTABLE_SALT2(ifilt_obs, z, Tobs, parList_SN, parList_HOST,
+			  *Finteg);
+  }
+
+  return(1);
+
+ EXACT:
+  FLUXTABLE_SALT2.NCALL_EXACT++ ;
+  return(0);
+
+} // end INTEG_FLUXTABLE_SALT2
+
+
+// **********************************************
+void check_FLUXTABLE_SALT2(int ifilt_obs, double z, double Tobs, 
+			   double *parList_SN, double *parList_HOST,
+			   double Finteg_table) {
+
+  // Created Oct 2026
+  // Validation option: compare band flux from table with exact integral,
+  // and print max |dmag| each time it increases, along with a summary
+  // every 10000 calls.
+
+  int    ifilt = IFILTMAP_SEDMODEL[ifilt_obs] ;
+  double Finteg, Finteg_errPar, Fspec[2], DMAG, AVG ;
+  long long NCALL ;
+
+  // ------------- BEGIN ------------
+
+  FLUXTABLE_SALT2.USE = false ;
+  INTEG_zSED_SALT2(0, ifilt_obs, z, Tobs, parList_SN, parList_HOST,
+		   &Finteg, &Finteg_errPar, Fspec);
+  FLUXTABLE_SALT2.USE = true ;
+
+  if ( Finteg <= 0.0 || Finteg_table <= 0.0 ) { return; }
+
+  DMAG  = fabs( 2.5*log10(Finteg_table/Finteg) );
+  FLUXTABLE_SALT2.NCALL_CHECK++ ;
+  FLUXTABLE_SALT2.DMAG_CHECK_SUM += DMAG ;
+  NCALL = FLUXTABLE_SALT2.NCALL_CHECK ;
+
+  if ( DMAG > FLUXTABLE_SALT2.DMAG_CHECK_MAX ) {
+    FLUXTABLE_SALT2.DMAG_CHECK_MAX = DMAG ;
+    printf("\t FLUXTABLE CHECK: new max|dmag|=%.5f for %s "
+	   "(z=%.4f Trest=%.2f c=%.3f mwebv=%.3f)\n",
+	   DMAG, FILTER_SEDMODEL[ifilt].name, z, Tobs/(1.0+z), 
+	   parList_SN[2], SEDMODEL_MWEBV_LAST );
+    fflush(stdout);
+  }
+
+  if ( (NCALL % 10000) == 0 ) {
+    AVG = FLUXTABLE_SALT2.DMAG_CHECK_SUM / (double)NCALL ;
+    printf("\t FLUXTABLE CHECK: %lld calls, max|dmag|=%.5f  "
+	   "<|dmag|>=%.6f  NCALL(table,exact)=%lld,%lld  NZBIN=%d\n",
+	   NCALL, FLUXTABLE_SALT2.DMAG_CHECK_MAX, AVG, 
+	   FLUXTABLE_SALT2.NCALL_TABLE, FLUXTABLE_SALT2.NCALL_EXACT,
+	   FLUXTABLE_SALT2.NZBIN_FILLED );
+    fflush(stdout);
+  }
+
+  return ;
+
+} // end check_FLUXTABLE_SALT2
+
+
 // **********************************************
 double SALT2x0calc(
 		   double alpha   // (I)
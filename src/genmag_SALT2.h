@@ -36,6 +36,8 @@
 #define OPTMASK_SALT2_DISABLE_WAVESHIFT   8  // disable WAVESHIFT keys
 #define OPTMASK_SALT2_NONEGFLUX          16  // flux<0 -> 0 (as in DC2)
 #define OPTMASK_SALT2_ABORT_LAMRANGE     64  // abort on bad model-LAMRANGE
+#define OPTMASK_SALT2_FLUXTABLE         128  // use band-flux tables (Oct 2026)
+#define OPTMASK_SALT2_FLUXTABLE_CHECK   256  // compare table with exact integ
 #define OPTMASK_SALT2_DEBUG     1024  // Refactor for developer only                                                                        
 
 int  DEBUG_SALT2;
@@ -211,6 +213,37 @@ struct SALT2_TABLE {
 
 
 
+// Oct 2026: optional tables of filter-integrated SED fluxes on a 
+// (z, Trest) grid. For each band, z-bin and day, store integrals of
+// M0 and M1 times a Taylor basis in color (c*A) and MW extinction 
+// (-mwebv*M), where colorCor = exp(B + c*A) and MWXT = exp(-mwebv*M).
+// Each z-bin is filled on first use.
+#define NCOLOR_FLUXTABLE_SALT2     9   // c^0 ... c^8
+#define NMWXT_FLUXTABLE_SALT2      5   // mwebv^0 ... mwebv^4
+#define NCOEF_FLUXTABLE_SALT2   (2*NCOLOR_FLUXTABLE_SALT2*NMWXT_FLUXTABLE_SALT2)
+#define MXZBIN_FLUXTABLE_SALT2   500   
+#define DZBIN_FLUXTABLE_SALT2   0.01   // z-bin size
+#define UMAX_COLOR_FLUXTABLE_SALT2  1.5 // use exact integral if |c*A|>UMAX
+#define UMAX_MWXT_FLUXTABLE_SALT2   0.5 // use exact integral if mwebv*M>UMAX
+
+typedef struct {
+  float  *COEF ;       // [iday][ised][icolor][imwxt]
+  double AMAX, MMAX ;  // max |A| and max M among filter bins 
+  double FNORM ;       // sum of TRANS*LAMOBS (for SALT3 errors)
+} FLUXTABLE_ZBIN_SALT2_DEF ;
+
+struct {
+  bool   USE, CHECK ;
+  double DZBIN ;
+  FLUXTABLE_ZBIN_SALT2_DEF *ZBIN[MXFILT_SEDMODEL] ; // [ifilt][iz]
+  int    NZBIN_FILLED ;
+
+  // stats
+  long long NCALL_TABLE, NCALL_EXACT, NCALL_CHECK ;
+  double DMAG_CHECK_MAX, DMAG_CHECK_SUM ;
+} FLUXTABLE_SALT2 ;
+
+
 // define structure for storing SALT2 spectrum and storing in table.
 
 
@@ -284,6 +317,15 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
 		      double *Finteg, double *Finteg_errPar, 
 		      double *Fspec );
 
+void init_FLUXTABLE_SALT2(int OPTMASK);
+void fill_FLUXTABLE_SALT2(int ifilt, int iz);
+int  INTEG_FLUXTABLE_SALT2(int ifilt_obs, double z, double Tobs, 
+			   double *parList_SN, double *parList_HOST,
+			   double *Finteg, double *Finteg_errPar );
+void check_FLUXTABLE_SALT2(int ifilt_obs, double z, double Tobs, 
+			   double *parList_SN, double *parList_HOST,
+			   double Finteg_table);
+
 int gencovar_SALT2(int MATSIZE, int *ifilt_obs, double *epobs, 
 		   double z, double *parList_SN, double *parList_HOST, 
 		   double mwebv, double *covar );
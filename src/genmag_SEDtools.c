@@ -786,15 +786,16 @@ void init_flux_SEDMODEL(int ifilt_obs, int ised) {
   //
   // Apr 30 2018: store MINDAY_ALL and MAXDAY_ALL
   // Nov 15 2020: protect ifilt for ifilt_obs==0
+  // Oct 16 2026: integrate with shared SEDKERNEL (vectorized) loop
 
-  int  ilampow, iep, ifilt, ilamfilt, iz ;
+  int  ilampow, iep, ifilt, ilamfilt, iz, ilamsed, NBIN ;
   int  NLAMFILT, NLAMSED, EPMIN, EPMAX, N, NZBIN, index ;
 
   double 
     lamsed, lamobs, lampow, trans, day, z, z1, logzdif
     ,LOGZMIN, LOGZMAX, LOGZBIN, FLUX, tmp, mag, mutmp, x0tmp
     ,LAMOBS_MIN, LAMOBS_MAX, LAMOBS_STEP, SEDMODELNORM
-    ,LAMTPOW[MXLAMPOW_SEDMODEL+1]
+    ,FLUXNODE[2], FRAC_LAM
     ,hc8, TDUM=-99.9
     ;
 
@@ -976,7 +977,9 @@ void init_flux_SEDMODEL(int ifilt_obs, int ised) {
     if ( LAMOBS_MIN/z1 < SEDMODEL.LAMMIN[ised] ) { continue ; }
     if ( LAMOBS_MAX/z1 > SEDMODEL.LAMMAX[ised] ) { continue ; }
 
-    // normalization for integrals
+    // load SEDKERNEL buffers with lambda-node index, interp fraction,
+    // and normalization for integrals (Oct 2026)
+    NBIN = 0 ;
     for ( ilamfilt=0; ilamfilt < NLAMFILT; ilamfilt++ ) {
 
       lamobs = FILTER_SEDMODEL[ifilt].lam[ilamfilt];      
@@ -988,28 +991,39 @@ void init_flux_SEDMODEL(int ifilt_obs, int ised) {
       if ( lamsed > SEDMODEL.LAMMAX[ised] ) { continue ; }
       
       if ( trans <= 0.0 ) { continue ; }
-  
+
+      // lambda node & interp-fraction are the same for all epochs
+      ilamsed = getFluxLamNodes_SEDMODEL(ised, EPMIN, TDUM, lamobs, z, fnam,
+					 FLUXNODE, &FRAC_LAM);
+      if ( ilamsed < 0 ) { continue ; }
+
+      SEDKERNEL.ILAM[NBIN] = ilamsed ;
+      SEDKERNEL.FRAC[NBIN] = FRAC_LAM ;
+
       lampow = 1.0 ; 
       // store powers of obs-lambda before looping over other indices
       for ( ilampow=0; ilampow <= NLAMPOW_SEDMODEL; ilampow++ ) {
-	LAMTPOW[ilampow] = (SEDMODELNORM * lamsed * trans * lampow) ;
+	SEDKERNEL.WGT[ilampow][NBIN] = (SEDMODELNORM*lamsed*trans*lampow) ;
 	lampow *= lamobs ;
       } 
+      NBIN++ ;
+    } // end ilam loop over SED-lambda bins in rest-frame
 
-      // loop over epochs, and compte flux
-      for ( iep=EPMIN ; iep <= EPMAX ; iep++ ) {
+    // loop over epochs, and compute flux integrals with shared kernel
+    for ( iep=EPMIN ; iep <= EPMAX ; iep++ ) {
 
-	// get flux at this epoch and obs-wavelength
-	FLUX = getFluxLam_SEDMODEL(ised, iep, TDUM, lamobs, z, fnam) ; 
+      gather_SEDKERNEL(NBIN, SEDKERNEL.ILAM, 
+		       &TEMP_SEDMODEL.FINEBIN_FLUX[NLAMSED*iep],
+		       SEDKERNEL.FLUX0[0], SEDKERNEL.FLUX1[0] );
+
+      for ( ilampow=0; ilampow <= NLAMPOW_SEDMODEL; ilampow++ ) {
+	tmp   = integ_SEDKERNEL(NBIN, SEDKERNEL.FLUX0[0], SEDKERNEL.FLUX1[0],
+				SEDKERNEL.FRAC, SEDKERNEL.WGT[ilampow] );
+	index = INDEX_SEDMODEL_FLUXTABLE(ifilt,iz,ilampow,iep,ised);
+	PTR_SEDMODEL_FLUXTABLE[index] += tmp ;
+      } 
+    }  // end iep loop over epochs
 
-	for ( ilampow=0; ilampow <= NLAMPOW_SEDMODEL; ilampow++ ) {
-	  tmp   = LAMTPOW[ilampow] * FLUX ;
-	  index = INDEX_SEDMODEL_FLUXTABLE(ifilt,iz,ilampow,iep,ised);
-	  PTR_SEDMODEL_FLUXTABLE[index] += tmp ;
-	} 
-	  
-      }  // end iep loop over epochs
-    } // end ilam loop over SED-lambda bins in rest-frame
   } // end of iz loop
 
 
@@ -1033,8 +1047,9 @@ void init_flux_SEDMODEL(int ifilt_obs, int ised) {
 
 
 // *********************************************
-double getFluxLam_SEDMODEL(int ISED, int IEP, double TOBS, double LAMOBS, 
-			   double z, char *funCall ) {
+int getFluxLamNodes_SEDMODEL(int ISED, int IEP, double TOBS, double LAMOBS, 
+			     double z, char *funCall, 
+			     double *FLUXNODE, double *FRAC_LAM ) {
 
   // Nov 2016
   // Return rest-frame SED Flam for inputs
@@ -1057,14 +1072,21 @@ double getFluxLam_SEDMODEL(int ISED, int IEP, double TOBS, double LAMOBS,
   //
   // Jan 19 2017: fix to work if just one DAY (i.e., one spectrum)
   //
+  // Oct 16 2026: 
+  //   Refactor as getFluxLamNodes_SEDMODEL that returns the 
+  //   day-interpolated flux at the two bounding lambda nodes
+  //   (FLUXNODE[0,1]) and the lambda-interp fraction (FRAC_LAM).
+  //   Function returns lower fine-bin lambda index, or -1 if outside
+  //   model range. Needed to load SEDKERNEL buffers; 
+  //   getFluxLam_SEDMODEL is now a wrapper.
+  //
 
-  double FLUX   = 0.0 ;
-  double FLUXTMP[2], fluxTmp[2];
+  double fluxTmp[2];
   double FRAC_INTERP_LAM, FRAC_INTERP_DAY ;
   double LAMDIF, LAMDIF2, LAMSED, TREST, z1 ;
   int    ilamsed, i, iep, jflux, ONEDAY ;
   int    NLAMSED = TEMP_SEDMODEL.N_FINEBIN ;
-  char   fnam[] = "getFluxLam_SEDMODEL" ;
+  char   fnam[] = "getFluxLamNodes_SEDMODEL" ;
 
   double DAYMIN  = TEMP_SEDMODEL.DAYMIN ;
   double DAYMAX  = TEMP_SEDMODEL.DAYMAX ;
@@ -1077,8 +1099,8 @@ double getFluxLam_SEDMODEL(int ISED, int IEP, double TOBS, double LAMOBS,
   z1 = 1.0 + z ;
   LAMSED = LAMOBS / z1 ;
   
-  if ( LAMSED < SEDMODEL.LAMMIN[ISED] ) { return(FLUX); }
-  if ( LAMSED > SEDMODEL.LAMMAX[ISED] ) { return(FLUX); }
+  if ( LAMSED < SEDMODEL.LAMMIN[ISED] ) { return(-1); }
+  if ( LAMSED > SEDMODEL.LAMMAX[ISED] ) { return(-1); }
 
   ONEDAY = ( NDAY == 1 ) ;
 
@@ -1088,8 +1110,8 @@ double getFluxLam_SEDMODEL(int ISED, int IEP, double TOBS, double LAMOBS,
     // compute iep from TOBS
     TREST = TOBS/z1 ;
 
-    if ( TREST < DAYMIN ) { return(FLUX); }
-    if ( TREST > DAYMAX ) { return(FLUX); }
+    if ( TREST < DAYMIN ) { return(-1); }
+    if ( TREST > DAYMAX ) { return(-1); }
 
     get_DAYBIN_SEDMODEL(ISED, TREST, &iep, &FRAC_INTERP_DAY);
 
@@ -1138,24 +1160,121 @@ double getFluxLam_SEDMODEL(int ISED, int IEP, double TOBS, double LAMOBS,
     jflux      = NLAMSED*(iep+0) + (ilamsed+i) ;
     fluxTmp[0] = TEMP_SEDMODEL.FINEBIN_FLUX[jflux];
     if ( IEP >= 0 || ONEDAY ) 
-      { FLUXTMP[i] = fluxTmp[0] ; } // no day-interpolation
+      { FLUXNODE[i] = fluxTmp[0] ; } // no day-interpolation
     else {
       // use day-interpolation
       jflux      = NLAMSED*(iep+1) + (ilamsed+i) ;
       fluxTmp[1] = TEMP_SEDMODEL.FINEBIN_FLUX[jflux];
-      FLUXTMP[i] = fluxTmp[0] + FRAC_INTERP_DAY*(fluxTmp[1]-fluxTmp[0]);
+      FLUXNODE[i] = fluxTmp[0] + FRAC_INTERP_DAY*(fluxTmp[1]-fluxTmp[0]);
     }
 
   }
 
+  *FRAC_LAM = FRAC_INTERP_LAM ;
+  return(ilamsed);
+
+} // end getFluxLamNodes_SEDMODEL
+
+
+// *********************************************
+double getFluxLam_SEDMODEL(int ISED, int IEP, double TOBS, double LAMOBS, 
+			   double z, char *funCall ) {
+
+  // Nov 2016
+  // Return rest-frame SED Flam for inputs (see getFluxLamNodes_SEDMODEL).
+  // Oct 16 2026: refactor as wrapper to getFluxLamNodes_SEDMODEL.
+
+  double FLUX = 0.0 ;
+  double FLUXNODE[2], FRAC_LAM ;
+  int    ilamsed ;
+
+  // ----------- BEGIN ------------
+
+  ilamsed = getFluxLamNodes_SEDMODEL(ISED, IEP, TOBS, LAMOBS, z, funCall,
+				     FLUXNODE, &FRAC_LAM);
+  if ( ilamsed < 0 ) { return(FLUX); }
+
   // interpolate in lambda space
-  FLUX  = FLUXTMP[0] + FRAC_INTERP_LAM*(FLUXTMP[1] - FLUXTMP[0]) ; 
+  FLUX  = FLUXNODE[0] + FRAC_LAM*(FLUXNODE[1] - FLUXNODE[0]) ; 
 
   return(FLUX);
 
 } // end getFluxLam_SEDMODEL
 
 
+// *********************************************
+ATTR_SEDKERNEL
+double integ_SEDKERNEL(int NBIN, double *FLUX0, double *FLUX1, 
+		       double *FRAC, double *WGT) {
+
+  // Created Oct 2026
+  // Shared spectral-integration kernel for SALT2, SEDMODEL flux
+  // tables and SEDMODEL spectra. Inputs are structure-of-arrays
+  // buffers with NBIN wavelength bins:
+  //   FLUX0,FLUX1 : SED flux at lower,upper lambda node
+  //   FRAC        : lambda-interp fraction between nodes
+  //   WGT         : weight per bin (trans, extinction, color, lambda ...)
+  //
+  // Returns  sum_i WGT[i] * ( FLUX0[i] + FRAC[i]*(FLUX1[i]-FLUX0[i]) )
+  //
+  // Partial sums are accumulated in NLANE_SEDKERNEL independent 
+  // lanes so that the compiler can vectorize the loop without
+  // re-association flags (e.g., -ffast-math). Vector-ISA choice
+  // is made at runtime via ATTR_SEDKERNEL.
+
+  double SUM[NLANE_SEDKERNEL] ;
+  double F, SUM_TOT ;
+  int    i, j ;
+  int    NBIN_LANE = NBIN - (NBIN % NLANE_SEDKERNEL) ;
+
+  // ----------- BEGIN ------------
+
+  for(j=0; j < NLANE_SEDKERNEL; j++ ) { SUM[j] = 0.0 ; }
+
+  for(i=0; i < NBIN_LANE; i += NLANE_SEDKERNEL ) {
+    for(j=0; j < NLANE_SEDKERNEL; j++ ) {
+      F       = FLUX0[i+j] + FRAC[i+j]*(FLUX1[i+j] - FLUX0[i+j]) ;
+      SUM[j] += WGT[i+j] * F ;
+    }
+  }
+
+  // remainder bins
+  for( ; i < NBIN; i++ ) {
+    F       = FLUX0[i] + FRAC[i]*(FLUX1[i] - FLUX0[i]) ;
+    SUM[0] += WGT[i] * F ;
+  }
+
+  SUM_TOT = 0.0 ;
+  for(j=0; j < NLANE_SEDKERNEL; j++ ) { SUM_TOT += SUM[j] ; }
+
+  return(SUM_TOT);
+
+} // end integ_SEDKERNEL
+
+
+// *********************************************
+ATTR_SEDKERNEL
+void gather_SEDKERNEL(int NBIN, int *ILAM, double *SEDFLUX,
+		      double *FLUX0, double *FLUX1) {
+
+  // Created Oct 2026
+  // Load contiguous SEDKERNEL flux buffers from SED array SEDFLUX
+  // using lower lambda-node index ILAM for each bin.
+
+  int i ;
+
+  // ----------- BEGIN ------------
+
+  for(i=0; i < NBIN; i++ ) {
+    FLUX0[i] = SEDFLUX[ILAM[i]+0] ;
+    FLUX1[i] = SEDFLUX[ILAM[i]+1] ;
+  }
+
+  return ;
+
+} // end gather_SEDKERNEL
+
+
 // *********************************************
 void init_FINEBIN_SEDMODEL(int ised) {
 
@@ -3256,6 +3375,7 @@ void getSpec_SEDMODEL(int ised,
   // Mar  6 2017: pass extinction arguments MWEBV,RV_host,AV_host
   // Dec 12 2018: replace x0 argument with MU; compute x0 below.
   // Mar 29 2019: SEDMODELNORM is separate for MAG and SPEC (hc factor)
+  // Oct 16 2026: integrate with shared SEDKERNEL (vectorized) loop
 
   double x0     = pow(TEN,-0.4*MU);
   double hc8    = (double)hc;
@@ -3265,9 +3385,9 @@ void getSpec_SEDMODEL(int ised,
 
   double LAMTMP_OBS, LAMTMP_REST, LAM0, LAM1, LAMAVG, lamBin, lam ;
   double ZP, MAG, FLUXGEN_forSPEC, FLUXGEN_forMAG;
-  double FTMP, MWXT_FRAC, z1, x0fac ;
+  double MWXT_FRAC, z1, x0fac, FLUXNODE[2], FRAC_LAM ;
   double SEDNORM_forSPEC, SEDNORM_forMAG;
-  int    ispec, NBLAM ;
+  int    ispec, NBLAM, NBIN, ilamsed ;
   int    NDMP_SKIP=0;
   int    LDMP  = ( fabs(Tobs) < -5.0 ) ; 
 
@@ -3310,16 +3430,37 @@ void getSpec_SEDMODEL(int ised,
     if ( NBLAM < 3 ) { NBLAM=3; }
     lamBin = (LAM1-LAM0)/(double)NBLAM ;
 
-    // sub loop in finer observer-lambda bins
-    FLUXGEN_forSPEC = FLUXGEN_forMAG = 0.0 ;
+    // sub loop in finer observer-lambda bins to load SEDKERNEL buffers
+    NBIN = 0 ;
     for(lam=LAM0; lam < LAM1-0.1 ; lam+=lamBin) {
       LAMTMP_OBS   = lam + lamBin/2.0 ;
       LAMTMP_REST  = LAMTMP_OBS/z1 ;
-      FTMP  = getFluxLam_SEDMODEL(ised, -9, Tobs, LAMTMP_OBS, z, fnam) ;
-      FLUXGEN_forMAG  += (FTMP * lamBin * LAMTMP_REST); 
-      FLUXGEN_forSPEC += (FTMP * lamBin );
+      ilamsed = getFluxLamNodes_SEDMODEL(ised, -9, Tobs, LAMTMP_OBS, z, fnam,
+					 FLUXNODE, &FRAC_LAM) ;
+      if ( ilamsed < 0 ) { continue ; }
+
+      if ( NBIN >= MXBIN_SEDKERNEL ) {
+	sprintf(c1err, "NBIN=%d exceeds bound for ispec=%d (LAM=%.1f-%.1f)",
+		NBIN, ispec, LAM0, LAM1 );
+	sprintf(c2err, "Check MXBIN_SEDKERNEL = %d", MXBIN_SEDKERNEL);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+      }
+
+      SEDKERNEL.FLUX0[0][NBIN] = FLUXNODE[0] ;
+      SEDKERNEL.FLUX1[0][NBIN] = FLUXNODE[1] ;
+      SEDKERNEL.FRAC[NBIN]     = FRAC_LAM ;
+      SEDKERNEL.WGT[0][NBIN]   = lamBin * LAMTMP_REST ; // for MAG
+      SEDKERNEL.WGT[1][NBIN]   = lamBin ;               // for SPEC
+      NBIN++ ;
     }
 
+    FLUXGEN_forMAG  = integ_SEDKERNEL(NBIN, 
+				      SEDKERNEL.FLUX0[0], SEDKERNEL.FLUX1[0],
+				      SEDKERNEL.FRAC, SEDKERNEL.WGT[0]);
+    FLUXGEN_forSPEC = integ_SEDKERNEL(NBIN, 
+				      SEDKERNEL.FLUX0[0], SEDKERNEL.FLUX1[0],
+				      SEDKERNEL.FRAC, SEDKERNEL.WGT[1]);
+
     MWXT_FRAC   = SEDMODEL_TABLE_MWXT_FRAC[IFILT][ispec] ;
     x0fac       = (x0 *MWXT_FRAC) ;
     FLUXGEN_forSPEC  *= (x0fac*SEDNORM_forSPEC) ;
@@ -55,6 +55,9 @@
 
  Aug 23 2019: MXBIN_LAMFILT_SEDMODEL -> 2400 (was 2000)
 
+ Oct 16 2026: define SEDKERNEL buffers and integ_SEDKERNEL for shared
+              (vectorized) spectral integration.
+
 ********************************************/
 
 // define bounds for filter and SED arrays
@@ -289,6 +292,35 @@ struct {
   double MINSLOPE_EXTRAPMAG_LATE;   // min mag/day slope for extrapolation
 } INPUTS_SEDMODEL;
 
+
+// Oct 2026: structure-of-arrays wavelength buffers for the shared
+// spectral-integration kernel (integ_SEDKERNEL) used by SALT2 
+// integrals, SEDMODEL flux tables and SEDMODEL spectra.
+// Each bin is an obs-frame wavelength sample; flux is linearly
+// interpolated between FLUX0 & FLUX1 and weighted by WGT 
+// (trans, extinction, color, lambda, bin size ...).
+#define MXBIN_SEDKERNEL   MXBIN_LAMFILT_SEDMODEL
+#define MXWGT_SEDKERNEL   (MXLAMPOW_SEDMODEL+1)
+#define NLANE_SEDKERNEL   8  // number of independent partial sums
+
+struct {
+  int    NBIN ;
+  int    ILAM[MXBIN_SEDKERNEL] ;      // lower SED lambda node per bin
+  double FRAC[MXBIN_SEDKERNEL] ;      // lambda-interp fraction per bin
+  double FLUX0[2][MXBIN_SEDKERNEL] ;  // SED flux at lower lambda node
+  double FLUX1[2][MXBIN_SEDKERNEL] ;  // SED flux at upper lambda node
+  double WGT[MXWGT_SEDKERNEL][MXBIN_SEDKERNEL] ; // weight per bin
+} SEDKERNEL ;
+
+// gcc on x86_64: build vectorized AVX512/AVX2 clones of the kernel
+// and pick one at runtime (ifunc); otherwise just the scalar loop.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && !defined(__APPLE__)
+#define ATTR_SEDKERNEL \
+  __attribute__((target_clones("avx512f","avx2","default"),optimize("O3")))
+#else
+#define ATTR_SEDKERNEL
+#endif
+
 // ==============================================
 // function declarations
 
@@ -331,6 +363,14 @@ double get_magerr_SEDMODEL(int ISED, int ifilt_obs,
 
 double getFluxLam_SEDMODEL(int ISED, int IEP, double TOBS, double LAMOBS,
                            double z, char *funCall );
+int    getFluxLamNodes_SEDMODEL(int ISED, int IEP, double TOBS, 
+				double LAMOBS, double z, char *funCall,
+				double *FLUXNODE, double *FRAC_LAM);
+
+double integ_SEDKERNEL(int NBIN, double *FLUX0, double *FLUX1, 
+		       double *FRAC, double *WGT);
+void   gather_SEDKERNEL(int NBIN, int *ILAM, double *SEDFLUX,
+			double *FLUX0, double *FLUX1);
 
 void get_DAYRANGE_SEDMODEL(int ISED, double *DAYMIN, double *DAYMAX);
 
@@ -56,6 +56,9 @@
  Mar 02 2022: fix bug so that UVLAM_EXTRAP works when reading binary file
               or original text files.
 
+ Oct 16 2026: flux table from binary file can be placed in shared memory
+              so that concurrent jobs on a node share one copy.
+
 *************************************/
 
 #include  <stdio.h> 
@@ -589,6 +592,8 @@ void read_SIMSED_TABBINARY(FILE *fp, char *binFile) {
   // and using the same table for smaller z-ranges.
   //
   // Mar 24 2021: improve error messaging with CTAG.
+  // Oct 16 2026: optional shared-memory flux table (SHARED_TABLES key);
+  //              only the first job on a node reads the table.
   //
 
   int NERR, idim, IZSIZE_RD, IZSIZE_ACTUAL;
@@ -702,11 +707,24 @@ void read_SIMSED_TABBINARY(FILE *fp, char *binFile) {
   }
 
   // ------------
+  // check option to share flux table among jobs on same node
+  bool IS_OWNER ;
+  float *PTR_SHARED = (float*)
+    malloc_shared_table("SIMSED_FLUXTABLE", binFile, 
+			(size_t)ISIZE_SEDMODEL_FLUXTABLE, &IS_OWNER);
+  if ( PTR_SHARED != NULL ) {
+    free(PTR_SEDMODEL_FLUXTABLE);
+    PTR_SEDMODEL_FLUXTABLE = PTR_SHARED ;
+    if ( !IS_OWNER ) { return; } // already filled by another job
+  }
+
   // read entire flux table
   printf("\t Read entire flux table ... "); fflush(stdout);
   fread(PTR_SEDMODEL_FLUXTABLE, ISIZE_SEDMODEL_FLUXTABLE, 1, fp);
   printf("Done reading. \n"); fflush(stdout);
 
+  if ( PTR_SHARED != NULL ) { ready_shared_table(PTR_SHARED); }
+
   return ;
 
 
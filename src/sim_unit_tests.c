@@ -24,6 +24,10 @@ void test_igm(void);
 void test_ran(void);
 void test_PARSE_WORDS(void);
 void test_zcmb_dLmag_invert(void);
+void test_SEDKERNEL(void);
+void test_fluxNoise_batch(void);
+void test_genSmear_PROJ(void);
+void test_interp_GRIDMAP(void);
 
 char TEST_REFAC[]  = "REFAC";
 char TEST_LEGACY[] = "LEGACY";
@@ -555,3 +559,374 @@ void test_igm(void) {
 } // end test_igm 
 
 
+// ***********************
+void test_SEDKERNEL(void) {
+
+  // Created Oct 2026
+  // Micro-benchmark for shared spectral-integration kernel
+  // (integ_SEDKERNEL) with buffer sizes and number of kernel calls
+  // typical of each model/call site. Print CPU time for the scalar
+  // loop order used before the kernel and for the kernel, and the 
+  // max relative difference of the sums summed over all calls; 
+  // kernel sums in NLANE_SEDKERNEL lanes, so expect round-off only.
+
+#define NMODEL_TEST_SEDKERNEL 3
+  char   *MODEL_LIST[NMODEL_TEST_SEDKERNEL] = 
+    { "SALT2(INTEG_zSED)", "SEDMODEL(init_flux)", "GENSPEC(getSpec)" } ;
+  int    NBIN_LIST[NMODEL_TEST_SEDKERNEL]   = { 600, 600, 12 } ;
+  int    NWGT_LIST[NMODEL_TEST_SEDKERNEL]   = { 4, MXWGT_SEDKERNEL, 2 };
+  int    NCALL_LIST[NMODEL_TEST_SEDKERNEL]  = { 200000, 200000, 5000000 };
+
+  int    imodel, i, icall, iwgt, NBIN, NWGT, NCALL ;
+  double SUM_KERNEL[MXWGT_SEDKERNEL], SUM_SCALAR[MXWGT_SEDKERNEL] ;
+  double F, t_kernel, t_scalar, dif, difmax ;
+  clock_t t0 ;
+  char fnam[] = "test_SEDKERNEL" ;
+
+  // --------------- BEGIN --------------
+
+  print_banner(fnam);
+
+  for(imodel=0; imodel < NMODEL_TEST_SEDKERNEL; imodel++ ) {
+    NBIN  = NBIN_LIST[imodel] ;
+    NWGT  = NWGT_LIST[imodel] ;
+    NCALL = NCALL_LIST[imodel] / NWGT ;
+
+    // fill buffers with smooth SED-like values
+    for(i=0; i < NBIN; i++ ) {
+      SEDKERNEL.FLUX0[0][i] = 1.0 + 0.5*sin(0.01*(double)i) ;
+      SEDKERNEL.FLUX1[0][i] = 1.0 + 0.5*sin(0.01*(double)(i+1)) ;
+      SEDKERNEL.FRAC[i]     = 0.001*(double)(i%1000) ;
+      for(iwgt=0; iwgt < NWGT; iwgt++ ) 
+	{ SEDKERNEL.WGT[iwgt][i] = 1.0/(double)(i+iwgt+1); }
+    }
+
+    for(iwgt=0; iwgt < NWGT; iwgt++ ) 
+      { SUM_SCALAR[iwgt] = SUM_KERNEL[iwgt] = 0.0 ; }
+
+    // scalar loop 
+    t0 = clock();
+    for(icall=0; icall < NCALL; icall++ ) {
+      for(iwgt=0; iwgt < NWGT; iwgt++ ) {
+	for(i=0; i < NBIN; i++ ) {
+	  F = SEDKERNEL.FLUX0[0][i] + 
+	    SEDKERNEL.FRAC[i]*(SEDKERNEL.FLUX1[0][i]-SEDKERNEL.FLUX0[0][i]);
+	  SUM_SCALAR[iwgt] += SEDKERNEL.WGT[iwgt][i] * F ;
+	}
+      }
+    }
+    t_scalar = (double)(clock()-t0) / (double)CLOCKS_PER_SEC ;
+
+    // shared kernel
+    t0 = clock();
+    for(icall=0; icall < NCALL; icall++ ) {
+      for(iwgt=0; iwgt < NWGT; iwgt++ ) {
+	SUM_KERNEL[iwgt] += 
+	  integ_SEDKERNEL(NBIN, SEDKERNEL.FLUX0[0], SEDKERNEL.FLUX1[0],
+			  SEDKERNEL.FRAC, SEDKERNEL.WGT[iwgt]);
+      }
+    }
+    t_kernel = (double)(clock()-t0) / (double)CLOCKS_PER_SEC ;
+
+    difmax = 0.0 ;
+    for(iwgt=0; iwgt < NWGT; iwgt++ ) {
+      dif = fabs(SUM_KERNEL[iwgt] - SUM_SCALAR[iwgt]) / SUM_SCALAR[iwgt];
+      if ( dif > difmax ) { difmax = dif; }
+    }
+
+    printf("  %-22s NBIN=%4d NWGT=%d: CPU(scalar,kernel) = %6.3f,%6.3f sec"
+	   " (speedup=%.2f)  maxRelDif=%.1le\n",
+	   MODEL_LIST[imodel], NBIN, NWGT, t_scalar, t_kernel,
+	   t_scalar/(t_kernel+1.0E-9), difmax );
+    fflush(stdout);
+  }
+
+  return ;
+
+} // end test_SEDKERNEL
+
+
+// ***********************
+void test_fluxNoise_batch(void) {
+
+  // Created Oct 2026
+  // Test batch flux-noise calculation (gen_fluxNoise_calc_batch) :
+  // run GENFLUX_DRIVER on a synthetic event with the batch and 
+  // legacy per-epoch calculations using the same randoms, and print
+  // each epoch where fluxes or errors differ (expect none).
+  // Call after randoms are initialized.
+
+#define NEP_TEST_FLUXNOISE 60
+  char   BANDLIST[] = "griz" ;
+  int    NBAND = strlen(BANDLIST);
+  int    NSTORE_ORIG = GENRAN_INFO.NSTORE_RAN[1] ;
+  int    DEBUG_ORIG  = INPUTS.DEBUG_FLAG ;
+  int    ipass, ep, ifilt, ifilt_obs, NDIF=0, NOBS=0 ;
+  double FLUX[2][NEP_TEST_FLUXNOISE+1], FLUXERR[2][NEP_TEST_FLUXNOISE+1];
+  double SNR[2][NEP_TEST_FLUXNOISE+1];
+  char fnam[] = "test_fluxNoise_batch" ;
+
+  // --------------- BEGIN --------------
+
+  print_banner(fnam);
+
+  GENLC.NFILTDEF_SIMLIB = NBAND ;
+  for(ifilt=0; ifilt < NBAND; ifilt++ ) {
+    char band[2] ;   sprintf(band, "%c", BANDLIST[ifilt] );
+    ifilt_obs = INTFILTER(band);
+    GENLC.IFILTMAP_SIMLIB[ifilt]          = ifilt_obs ;
+    GENLC.DOFILT[ifilt_obs]               = 1 ;
+    GENLC.genmag_obs_template[ifilt_obs]  = 99.0 ;
+  }
+
+  // synthetic cadence; every 7th epoch is not generated
+  GENLC.NEPOCH         = NEP_TEST_FLUXNOISE ;
+  GENLC.REDSHIFT_HELIO = GENLC.REDSHIFT_CMB = 0.3 ;
+  for(ep=1; ep <= NEP_TEST_FLUXNOISE; ep++ ) {
+    ifilt_obs = GENLC.IFILTMAP_SIMLIB[ep % NBAND] ;
+    GENLC.IFILT_OBS[ep]    = ifilt_obs ;
+    GENLC.OBSFLAG_GEN[ep]  = ( ep % 7 != 0 );
+    GENLC.genmag_obs[ep]   = 21.0 + 0.05*(double)ep ;
+    GENLC.magsmear8[ep]    = 0.0 ;
+    sprintf(GENLC.FIELDNAME[ep], "TEST");
+    if ( GENLC.OBSFLAG_GEN[ep] ) { NOBS++ ; }
+
+    SIMLIB_OBS_GEN.MJD[ep]         = 60000.0 + 2.0*(double)ep ;
+    SIMLIB_OBS_GEN.ZPTADU[ep]      = 31.0 + 0.01*(double)(ep%9) ;
+    SIMLIB_OBS_GEN.ZPTERR[ep]      = 0.005 ;
+    SIMLIB_OBS_GEN.CCDGAIN[ep]     = 1.0 + 0.1*(double)(ep%3) ;
+    SIMLIB_OBS_GEN.SKYSIG[ep]      = 50.0 + (double)(ep%11) ;
+    SIMLIB_OBS_GEN.READNOISE[ep]   = 5.0 ;
+    SIMLIB_OBS_GEN.PSFSIG1[ep]     = 2.0 + 0.1*(double)(ep%5) ;
+    SIMLIB_OBS_GEN.PSFSIG2[ep]     = 0.0 ;
+    SIMLIB_OBS_GEN.PSFRATIO[ep]    = 0.0 ;
+    SIMLIB_OBS_GEN.PIXSIZE[ep]     = 0.27 ;
+    SIMLIB_OBS_GEN.NEXPOSE[ep]     = 1 ;
+    SIMLIB_OBS_GEN.NEA[ep]         = 
+      4.0*TWOPI*SIMLIB_OBS_GEN.PSFSIG1[ep]*SIMLIB_OBS_GEN.PSFSIG1[ep];
+    SIMLIB_OBS_GEN.TEMPLATE_SKYSIG[ep]    = 0.0 ;
+    SIMLIB_OBS_GEN.TEMPLATE_READNOISE[ep] = 0.0 ;
+    SIMLIB_OBS_GEN.TEMPLATE_ZPT[ep]       = 0.0 ;
+  }
+
+  // ipass=0 -> batch, ipass=1 -> legacy per-epoch; same randoms
+  for(ipass=0; ipass < 2; ipass++ ) {
+    GENRAN_INFO.NSTORE_RAN[1] = NSTORE_ORIG ;
+    INPUTS.DEBUG_FLAG = ( ipass == 0 ? 0 : DEBUG_FLAG_FLUXNOISE_EPOCH ) ;
+    GENLC.SNRMAX_GLOBAL = 0.0 ;
+    GENFLUX_DRIVER(); // includes gen_fluxNoise_randoms
+    for(ep=1; ep <= NEP_TEST_FLUXNOISE; ep++ ) {
+      FLUX[ipass][ep]    = GENLC.flux[ep] ;
+      FLUXERR[ipass][ep] = GENLC.fluxerr_data[ep] ;
+      SNR[ipass][ep]     = GENLC.SNR_CALC[ep] ;
+    }
+  }
+  INPUTS.DEBUG_FLAG = DEBUG_ORIG ;
+
+  for(ep=1; ep <= NEP_TEST_FLUXNOISE; ep++ ) {
+    if ( FLUX[0][ep]    != FLUX[1][ep]    ||
+	 FLUXERR[0][ep] != FLUXERR[1][ep] ||
+	 SNR[0][ep]     != SNR[1][ep]  ) {
+      NDIF++ ;
+      printf("  DIFF ep=%3d  FLUX=%le/%le  FLUXERR=%le/%le \n",
+	     ep, FLUX[0][ep], FLUX[1][ep], FLUXERR[0][ep], FLUXERR[1][ep]);
+    }
+  }
+
+  printf("  %d of %d generated epochs differ (batch vs. per-epoch)\n",
+	 NDIF, NOBS );
+  fflush(stdout);
+
+  return ;
+
+} // end test_fluxNoise_batch
+
+
+// ***********************
+void test_genSmear_PROJ(void) {
+
+  // Created Oct 2026
+  // Benchmark intrinsic-scatter model from GENMAG_SMEAR_MODELNAME:
+  // compare events/sec for direct node interpolation and tabulated
+  // projection (GENSMEAR_PROJ, GENMAG_SMEAR_MSKOPT += 64) using the
+  // same randoms. Also print max |magSmear| difference and number
+  // of values differing by more than TOL_TEST_GENSMEAR (table has
+  // 1 A bins, so agreement is not exact). 
+  // Run once per GENMAG_SMEAR_MODELNAME. Call after init_modelSmear.
+
+#define NEVT_TEST_GENSMEAR   2000
+#define NFILT_TEST_GENSMEAR     6
+#define NLAM_TEST_GENSMEAR    150
+#define TOL_TEST_GENSMEAR     1.0E-4  // mag
+  int    NSTORE_ORIG = GENRAN_INFO.NSTORE_RAN[2] ;
+  int    USE_ORIG    = GENSMEAR_PROJ.USE ;
+  int    NSTORE      = NEVT_TEST_GENSMEAR*NFILT_TEST_GENSMEAR*NLAM_TEST_GENSMEAR;
+  int    ipass, ievt, ifilt, ilam, istore, NDIF=0 ;
+  double parList[4] = { 0.0, 0.0, 0.0, 10.0 } ;
+  double Lam[NLAM_TEST_GENSMEAR], z, LAMOBS, dif, difmax=0.0 ;
+  double t_pass[2], *MAGSMEAR[2] ;
+  clock_t t0 ;
+  char *PASSNAME[2] = { "direct", "table" } ;
+  char fnam[] = "test_genSmear_PROJ" ;
+
+  // --------------- BEGIN --------------
+
+  print_banner(fnam);
+
+  if ( !istat_genSmear() ) {
+    printf("  No GENMAG_SMEAR_MODELNAME -> nothing to test.\n");
+    return ;
+  }
+
+  for(ipass=0; ipass < 2; ipass++ ) {
+    MAGSMEAR[ipass] = (double*) malloc(NSTORE*sizeof(double));
+    GENSMEAR_PROJ.USE         = ipass ;
+    GENRAN_INFO.NSTORE_RAN[2] = NSTORE_ORIG ;
+    istore = 0 ;
+    t0 = clock();
+
+    for(ievt=0; ievt < NEVT_TEST_GENSMEAR; ievt++ ) {
+      z = 0.05 + 1.2*(double)ievt/(double)NEVT_TEST_GENSMEAR ;
+      SETSNPAR_genSmear(0.0, 0.0, z);
+      load_genSmear_randoms(ievt+1, -3.0, 3.0, -999.0);
+
+      // obs-frame filters from 3500 to 10000 A, 10 A bins
+      for(ifilt=0; ifilt < NFILT_TEST_GENSMEAR; ifilt++ ) {
+	for(ilam=0; ilam < NLAM_TEST_GENSMEAR; ilam++ ) {
+	  LAMOBS    = 3500.0 + 1100.0*(double)ifilt + 10.0*(double)ilam ;
+	  Lam[ilam] = LAMOBS/(1.0+z) ;
+	}
+	get_genSmear(parList, NLAM_TEST_GENSMEAR, Lam, 
+		     &MAGSMEAR[ipass][istore] );
+	istore += NLAM_TEST_GENSMEAR ;
+      }
+    }
+    t_pass[ipass] = (double)(clock()-t0) / (double)CLOCKS_PER_SEC ;
+  }
+  GENSMEAR_PROJ.USE = USE_ORIG ;
+
+  for(istore=0; istore < NSTORE; istore++ ) {
+    dif = fabs(MAGSMEAR[1][istore] - MAGSMEAR[0][istore]);
+    if ( dif > difmax            ) { difmax = dif; }
+    if ( dif > TOL_TEST_GENSMEAR ) { NDIF++ ; }
+  }
+
+  for(ipass=0; ipass < 2; ipass++ ) {
+    printf("  %-8s : %8.0f events/sec  (%d events x %d filters)\n",
+	   PASSNAME[ipass], 
+	   (double)NEVT_TEST_GENSMEAR/(t_pass[ipass]+1.0E-9),
+	   NEVT_TEST_GENSMEAR, NFILT_TEST_GENSMEAR);
+  }
+  printf("  max |magSmear(table) - magSmear(direct)| = %.2le "
+	 "(%d of %d differ by > %.1le)\n", 
+	 difmax, NDIF, NSTORE, TOL_TEST_GENSMEAR );
+  fflush(stdout);
+
+  free(MAGSMEAR[0]);  free(MAGSMEAR[1]);
+  return ;
+
+} // end test_genSmear_PROJ
+
+
+// ***********************
+void test_interp_GRIDMAP(void) {
+
+  // Created Oct 2026
+  // Benchmark interp_GRIDMAP on synthetic uniform maps with NDIM=1-4
+  // and NFUN=2: compare CPU time for legacy interpolation (OPT_FAST=0)
+  // and fast path via interp_GRIDMAP_LIST at points inside and 
+  // outside the map. Also print max difference and number of values
+  // differing by more than TOL_TEST_GRIDMAP (expect zero).
+
+#define NFUN_TEST_GRIDMAP  2
+#define NPT_TEST_GRIDMAP   2000000
+#define TOL_TEST_GRIDMAP   1.0E-10
+  int    NBIN_LIST[MXDIM_GRIDMAP_FAST] = { 200, 50, 20, 10 } ;
+  int    NDIM, MAPSIZE, idim, ifun, i, ipt, NPT, ibin, STRIDE, irow ;
+  int    NDIF ;
+  double *GRIDVAL[MXDIM_GRIDMAP_FAST], *GRIDFUN[NFUN_TEST_GRIDMAP] ;
+  double *DATA, *FUN_LEGACY, *FUN_FAST, t_legacy, t_fast, dif, difmax ;
+  double VALBIN = 0.37, VALMIN = -1.0, SUM, XRAN ;
+  int    IDMAP_TEST = MXMAP_1DINDEX - 1 ; // avoid ID of real maps
+  clock_t t0 ;
+  GRIDMAP gridmap ;
+  char fnam[] = "test_interp_GRIDMAP" ;
+
+  // --------------- BEGIN --------------
+
+  print_banner(fnam);
+
+  for(NDIM=1; NDIM <= MXDIM_GRIDMAP_FAST; NDIM++ ) {
+
+    MAPSIZE = 1 ;
+    for(idim=0; idim < NDIM; idim++ ) { MAPSIZE *= NBIN_LIST[idim]; }
+
+    for(idim=0; idim < NDIM; idim++ ) 
+      { GRIDVAL[idim] = (double*) malloc(MAPSIZE*sizeof(double)); }
+    for(ifun=0; ifun < NFUN_TEST_GRIDMAP; ifun++ ) 
+      { GRIDFUN[ifun] = (double*) malloc(MAPSIZE*sizeof(double)); }
+
+    // map rows with last dimension varying fastest 
+    for(irow=0; irow < MAPSIZE; irow++ ) {
+      STRIDE = MAPSIZE;  SUM = 0.0 ;
+      for(idim=0; idim < NDIM; idim++ ) {
+	STRIDE /= NBIN_LIST[idim] ;
+	ibin    = (irow/STRIDE) % NBIN_LIST[idim] ;
+	GRIDVAL[idim][irow] = VALMIN + VALBIN*(double)ibin ;
+	SUM += sin( (double)(idim+1) * GRIDVAL[idim][irow] );
+      }
+      GRIDFUN[0][irow] = SUM ;
+      GRIDFUN[1][irow] = SUM*SUM ;
+    }
+
+    init_interp_GRIDMAP(IDMAP_TEST, "TEST", MAPSIZE, 
+			NDIM, NFUN_TEST_GRIDMAP, 1,
+			GRIDVAL, GRIDFUN, &gridmap );
+
+    // random points, including some outside map to test extrapolation
+    NPT        = NPT_TEST_GRIDMAP / (1<<NDIM) ;
+    DATA       = (double*) malloc(NPT*NDIM*sizeof(double));
+    FUN_LEGACY = (double*) malloc(NPT*NFUN_TEST_GRIDMAP*sizeof(double));
+    FUN_FAST   = (double*) malloc(NPT*NFUN_TEST_GRIDMAP*sizeof(double));
+    for(i=0; i < NPT*NDIM; i++ ) {
+      idim    = i % NDIM ;
+      XRAN    = fmod(0.6180339887*(double)(i+1), 1.0); // quasi-random
+      DATA[i] = VALMIN - 0.2 + 
+	(VALBIN*(double)(NBIN_LIST[idim]-1) + 0.4) * XRAN ;
+    }
+
+    gridmap.OPT_FAST = 0 ;
+    t0 = clock();
+    for(ipt=0; ipt < NPT; ipt++ ) {
+      interp_GRIDMAP(&gridmap, &DATA[ipt*NDIM], 
+		     &FUN_LEGACY[ipt*NFUN_TEST_GRIDMAP] );
+    }
+    t_legacy = (double)(clock()-t0) / (double)CLOCKS_PER_SEC ;
+
+    init_interp_GRIDMAP_FAST(&gridmap);
+    t0 = clock();
+    interp_GRIDMAP_LIST(&gridmap, NPT, DATA, FUN_FAST, NULL);
+    t_fast = (double)(clock()-t0) / (double)CLOCKS_PER_SEC ;
+
+    difmax = 0.0 ;  NDIF = 0 ;
+    for(i=0; i < NPT*NFUN_TEST_GRIDMAP; i++ ) {
+      dif = fabs(FUN_FAST[i] - FUN_LEGACY[i]);
+      if ( dif > difmax ) { difmax = dif; }
+      if ( dif > TOL_TEST_GRIDMAP ) { NDIF++ ; }
+    }
+
+    printf("  NDIM=%d MAPSIZE=%7d NPT=%7d: CPU(legacy,fast) = %6.3f,%6.3f sec"
+	   " (speedup=%.2f)  maxDif=%.1le  NDIF=%d\n",
+	   NDIM, MAPSIZE, NPT, t_legacy, t_fast, 
+	   t_legacy/(t_fast+1.0E-9), difmax, NDIF );
+    fflush(stdout);
+
+    malloc_GRIDMAP(-1, &gridmap, NFUN_TEST_GRIDMAP, NDIM, MAPSIZE);
+    for(idim=0; idim < NDIM; idim++ ) { free(GRIDVAL[idim]); }
+    for(ifun=0; ifun < NFUN_TEST_GRIDMAP; ifun++ ) { free(GRIDFUN[ifun]); }
+    free(DATA); free(FUN_LEGACY); free(FUN_FAST);
+  }
+
+  return ;
+
+} // end test_interp_GRIDMAP
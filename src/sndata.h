@@ -68,6 +68,7 @@
 #define WRITE_MASK_COMPACT      64  // suppress non-essential PHOT output
 #define WRITE_MASK_SPECTRA     128  // write spectra (Oct 14 2021)
 #define WRITE_MASK_SPECTRA_LEGACY 4096  // legacy format with LAMINDEX
+#define WRITE_MASK_THREAD_FITS    8192  // FITS writes on I/O thread (Oct 2026)
 
 #define OPT_ZPTSIG_TRUN  1   // option to use ZPTSIG from template
 #define OPT_ZPTSIG_SRUN  2   // idem for search run
@@ -60,6 +60,9 @@
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_sort.h>
 #include <sys/stat.h>
+#include <sys/mman.h>   // Oct 2026: binary SIMLIB
+#include <fcntl.h>
+#include <sys/wait.h>
 
 // include C code
 #include "SNcadenceFoM.c"
@@ -71,7 +74,7 @@
 // ******************************************
 int main(int argc, char **argv) {
 
-  int ilc, istat, i  ;
+  int ilc, ilc_min, istat, i  ;
   // define local structures
   SIMFILE_AUX_DEF SIMFILE_AUX ;
   char fnam[] = "main"; 
@@ -103,13 +106,19 @@ int main(int argc, char **argv) {
   init_simvar();
 
   //  test_igm(); // xxxx
+  //  test_SEDKERNEL(); // benchmark shared SED-integration kernel
 
   // read user input file for directions
   get_user_input();
 
+  // option to share large read-only tables among jobs on same node
+  SHARED_TABLE_INFO.USE = INPUTS.SHARED_TABLES ;
+
   // init random number generator, and store first random.
-  if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID  ) 
-    { init_random_seed(INPUTS.ISEED, INPUTS.NSTREAM_RAN); }
+  if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID  ) { 
+    init_random_cbrng(INPUTS.CBRNG_RAN);
+    init_random_seed(INPUTS.ISEED, INPUTS.NSTREAM_RAN); 
+  }
 
   // prepare user input after init_random_seed to allow 
   // random systematic shifts.
@@ -174,6 +183,9 @@ int main(int argc, char **argv) {
 		    INPUTS.FLUXERRMODEL_REDCOV,
 		    INPUTS.FLUXERRMAP_IGNORE_DATAERR);
 
+  //  test_fluxNoise_batch(); // batch vs. per-epoch flux noise
+  //  test_interp_GRIDMAP(); // benchmark fast GRIDMAP interpolation
+
 
   // init anomalous host-subtraction noise
   INIT_NOISEMODEL_HOST_LEGACY(INPUTS.HOSTNOISE_FILE);
@@ -216,6 +228,7 @@ int main(int argc, char **argv) {
   // - - - - 
   init_genmodel();
   init_modelSmear(); 
+  //  test_genSmear_PROJ(); // benchmark tabulated genSmear projection
   init_genSpec();     // July 2016: prepare optional spectra
 
   // check options to rewrite hostlib and quit
@@ -234,6 +247,8 @@ int main(int argc, char **argv) {
 
   if ( INPUTS.INIT_ONLY ==2 ) { debugexit("main: QUIT AFTER FULL INIT"); }
 
+  init_EARLY_REJECT(); // Oct 2026
+
   set_TIMERS(1);
 
   // =================================================
@@ -242,9 +257,13 @@ int main(int argc, char **argv) {
   print_banner( " Begin Generating Lightcurves. " );
   fflush(stdout);
 
+  // check option to fork workers (NTHREAD); for each worker, 
+  // ilc_min is the first event and INPUTS.NGEN is reset to the last.
+  // The parent returns ilc_min > NGEN after merging worker output.
+  ilc_min = fork_simWorkers(&SIMFILE_AUX);
 
   // - - - - - 
-  for ( ilc = 1; ilc <= INPUTS.NGEN ; ilc++ ) {
+  for ( ilc = ilc_min; ilc <= INPUTS.NGEN ; ilc++ ) {
 
     NGENLC_TOT++;
 
@@ -256,10 +275,14 @@ int main(int argc, char **argv) {
 
     if ( INPUTS.TRACE_MAIN  ) { dmp_trace_main("02", ilc) ; }
 
-    if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID ) 
-      { fill_RANLISTs(); }      // init list of random numbers for each SN    
+    if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID ) { 
+      set_random_event(ilc);  // for counter-based randoms
+      fill_RANLISTs();        // init list of random numbers for each SN    
+    }
 
+    set_TIMERS_STAGE(1,ISTAGE_TIMER_EVENT);
     gen_event_driver(ilc); 
+    set_TIMERS_STAGE(2,ISTAGE_TIMER_EVENT);
 
     if ( GENLC.STOPGEN_FLAG ) { NGENLC_TOT--;  goto ENDLOOP ; }
 
@@ -307,24 +330,36 @@ int main(int argc, char **argv) {
 
 
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("07", ilc) ; }
+    set_TIMERS_STAGE(1,ISTAGE_TIMER_GENMAG);
     GENMAG_DRIVER();   // July 2016
+    set_TIMERS_STAGE(2,ISTAGE_TIMER_GENMAG);
 
     if ( GENMAG_CUT() == 0  ) {
       gen_event_reject(&ilc, &SIMFILE_AUX, "GENMAG");
       goto GENEFF;
     }
 
+    // Oct 2026: optional pre-cuts (subset of CUTWIN) before GENFLUX
+    if ( apply_EARLY_REJECT() == 0 ) {
+      gen_event_reject(&ilc, &SIMFILE_AUX, "CUTWIN");
+      goto GENEFF;
+    }
+
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("08", ilc) ; }
 
     // generate spectra before broadband fluxes in case TEXPOSE
     // is computed from requested SNR; TEXPOSE is then used for
     // synthetic bands.
+    set_TIMERS_STAGE(1,ISTAGE_TIMER_GENSPEC);
     GENSPEC_DRIVER(); 
+    set_TIMERS_STAGE(2,ISTAGE_TIMER_GENSPEC);
 
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("09", ilc) ; }
 
     // convert generated mags into observed fluxes
+    set_TIMERS_STAGE(1,ISTAGE_TIMER_GENFLUX);
     GENFLUX_DRIVER(); 
+    set_TIMERS_STAGE(2,ISTAGE_TIMER_GENFLUX);
 
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("10", ilc) ; }
 
@@ -342,11 +377,13 @@ int main(int argc, char **argv) {
     if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID  ) {
       MJD_DETECT_DEF MJD_DETECT;
       LOAD_SEARCHEFF_DATA();
+      set_TIMERS_STAGE(1,ISTAGE_TIMER_SEARCHEFF);
       GENLC.SEARCHEFF_MASK = 
 	gen_SEARCHEFF(GENLC.CID                 // (I) ID for dump/abort
 		      ,&GENLC.SEARCHEFF_SPEC     // (O)
 		      ,&GENLC.SEARCHEFF_zHOST    // (O) Mar 2018
 		      ,&MJD_DETECT   );          // (O) Oct 2021
+      set_TIMERS_STAGE(2,ISTAGE_TIMER_SEARCHEFF);
 
       GENLC.MJD_TRIGGER        = (float)MJD_DETECT.TRIGGER ;
       GENLC.MJD_DETECT_FIRST   = (float)MJD_DETECT.FIRST ;
@@ -375,6 +412,7 @@ int main(int argc, char **argv) {
       gen_event_reject(&ilc, &SIMFILE_AUX, "CUTWIN");
       goto GENEFF;
     }
+    timer_EARLY_REJECT(2); // stop timer after cuts
 
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("12", ilc) ; }
 
@@ -391,7 +429,9 @@ int main(int argc, char **argv) {
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("13", ilc) ; }
 
     // update SNDATA files & auxiliary files
+    set_TIMERS_STAGE(1,ISTAGE_TIMER_OUTPUT);
     update_simFiles(&SIMFILE_AUX);
+    set_TIMERS_STAGE(2,ISTAGE_TIMER_OUTPUT);
 
     GENLC.ACCEPTFLAG = 1 ;  // Added Dec 2015
 
@@ -399,6 +439,7 @@ int main(int argc, char **argv) {
 
   GENEFF:
 
+    timer_EARLY_REJECT(2); // stop timer for rejected event
     if ( INPUTS.NGENTOT_LC > 0 ) { screen_update(); }
 
     GENLC.STOPGEN_FLAG = geneff_calc();  // calc generation effic & error  
@@ -413,6 +454,9 @@ int main(int argc, char **argv) {
 
   set_TIMERS(2);
 
+  // forked worker sends stats to parent and exits here
+  if ( SIMWORKER.ID_WORKER >= 0 ) { end_simWorker(&SIMFILE_AUX); }
+
   // print final statistics on generated lightcurves.
 
   simEnd(&SIMFILE_AUX);
@@ -514,6 +558,12 @@ void simEnd(SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
   END_FLUXERRMODEL();
 
+  summary_SKYINDEX_HOSTLIB(); // Oct 2026
+  summary_SIMLIB_CACHE();     // Oct 2026
+  summary_CHOLESKY_CACHE_FLUXNOISE(); // Oct 2026
+  summary_genSmear_CACHE();   // Oct 2026
+  summary_EARLY_REJECT();     // Oct 2026
+
   end_simFiles(SIMFILE_AUX);
 
   if ( NAVWARP_OVERFLOW[0] > 0 ) 
@@ -539,6 +589,469 @@ void simEnd(SIMFILE_AUX_DEF *SIMFILE_AUX) {
 } // end of simEnd
 
 
+// ***************************
+void prep_simWorkers(void) {
+
+  // Created Oct 2026
+  // Check NTHREAD input to generate events with forked workers.
+  // Abort for options that are not compatible with workers, e.g.,
+  // options that carry state from one event to the next, or
+  // generation modes that do not use the ilc loop.
+
+  int  NTHREAD = INPUTS.NTHREAD ;
+  char fnam[] = "prep_simWorkers" ;
+
+  // ----------- BEGIN ------------
+
+  SIMWORKER.NWORKER = 1 ;
+  if ( NTHREAD <= 1 ) { return; }
+
+  if ( NTHREAD > MXWORKER_SIM ) {
+    sprintf(c1err,"NTHREAD=%d exceeds bound MXWORKER_SIM=%d",
+	    NTHREAD, MXWORKER_SIM);
+    sprintf(c2err,"Reduce NTHREAD, or increase MXWORKER_SIM");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  c2err[0] = 0 ;
+  if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENRANDOM ) 
+    { sprintf(c2err,"GENSOURCE=%s (must be RANDOM)", INPUTS.GENSOURCE); }
+  else if ( !WRFLAG_FITS ) 
+    { sprintf(c2err,"FORMAT_MASK=%d (must be FITS)", INPUTS.FORMAT_MASK); }
+  else if ( INDEX_GENMODEL == MODEL_LCLIB ) 
+    { sprintf(c2err,"GENMODEL=LCLIB"); }
+  else if ( !IGNOREFILE(INPUTS.STRONGLENS_FILE) ) 
+    { sprintf(c2err,"STRONGLENS_FILE"); }
+  else if ( INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_USEONCE ) 
+    { sprintf(c2err,"HOSTLIB_MSKOPT += %d (USEONCE)", 
+	      HOSTLIB_MSKOPT_USEONCE ); }
+
+  if ( strlen(c2err) > 0 ) {
+    sprintf(c1err,"NTHREAD=%d is not compatible with", NTHREAD);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  SIMWORKER.NWORKER = NTHREAD ;
+  printf("\t Generate events with %d forked workers.\n", NTHREAD);
+  fflush(stdout);
+
+  return ;
+
+} // end prep_simWorkers
+
+
+// ***************************
+int fork_simWorkers(SIMFILE_AUX_DEF *SIMFILE_AUX) {
+
+  // Created Oct 2026
+  // For NTHREAD>1, split the ilc range into NWORKER contiguous ranges
+  // and fork one worker per range. All of the init (HOSTLIB, SIMLIB
+  // header, model tables, SEARCHEFF maps ...) is done before the fork,
+  // so that workers share init memory (copy-on-write), and each worker
+  // has a private copy of the per-event globals (GENLC, etc ...).
+  // Threads are not used because the event generation is driven by
+  // global structs that cannot be safely shared.
+  //
+  // Since CID = CIDOFF + ilc, CIDs are unique among workers.
+  //
+  // Function returns first ilc to generate in this process.
+  // In the worker, return start of ilc range.
+  // In the parent, wait for workers, merge stats and output lists,
+  // and return NGEN+1 so that parent skips the event loop.
+
+  int   NWORKER = SIMWORKER.NWORKER ;
+  int   NGEN    = INPUTS.NGEN ;
+  int   MEMSTATS = sizeof(SIMWORKER_STATS_DEF);
+  int   t, ilc_min, ilc_max, fd[2], NREAD, NBYTE, status, NERR=0 ;
+  int   FD_READ[MXWORKER_SIM];
+  pid_t pid ;
+  char  *ptr ;
+  SIMWORKER_STATS_DEF *STATS ;
+  char fnam[] = "fork_simWorkers" ;
+
+  // ----------- BEGIN ------------
+
+  if ( NWORKER <= 1 ) { return(1); }
+
+  sprintf(BANNER,"%s: fork %d workers to generate %d events", 
+	  fnam, NWORKER, NGEN);
+  print_banner(BANNER);
+
+  for(t=0; t < NWORKER; t++ ) {
+    ilc_min = 1 + (int)( ((long long)t     * NGEN) / NWORKER );
+    ilc_max =     (int)( ((long long)(t+1) * NGEN) / NWORKER );
+    SIMWORKER.ILC_RANGE[t][0] = ilc_min ;
+    SIMWORKER.ILC_RANGE[t][1] = ilc_max ;
+    printf("\t worker %2d : ilc = %8d to %8d \n", t, ilc_min, ilc_max);
+  }
+
+  // flush buffers so that workers do not write duplicate contents
+  fflush(stdout);
+  fflush(SIMFILE_AUX->FP_LIST);
+  fflush(SIMFILE_AUX->FP_README);
+  if ( INPUTS.NVAR_SIMGEN_DUMP > 0 ) { fflush(SIMFILE_AUX->FP_DUMP); }
+
+  STATS = (SIMWORKER_STATS_DEF*) malloc(NWORKER*MEMSTATS);
+
+  for(t=0; t < NWORKER; t++ ) {
+
+    if ( pipe(fd) != 0 ) {
+      sprintf(c1err,"Unable to create pipe for worker %d", t);
+      sprintf(c2err,"Check system limit on open files.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+
+    pid = fork();
+    if ( pid < 0 ) {
+      sprintf(c1err,"Unable to fork worker %d of %d", t, NWORKER);
+      sprintf(c2err,"Try smaller NTHREAD.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+
+    if ( pid == 0 ) {
+      // worker process
+      close(fd[0]);
+      free(STATS);
+      SIMWORKER.ID_WORKER = t ;
+      SIMWORKER.FD_PIPE   = fd[1] ;
+      init_simWorker(SIMFILE_AUX);
+      return(SIMWORKER.ILC_RANGE[t][0]) ;
+    }
+
+    // parent process
+    close(fd[1]);
+    FD_READ[t]       = fd[0] ;
+    SIMWORKER.PID[t] = pid ;
+  }
+
+  // - - - - - 
+  // parent: read stats from each worker in worker order so that
+  // merged output does not depend on which worker finishes first.
+  for(t=0; t < NWORKER; t++ ) {
+    ptr = (char*)&STATS[t];  NREAD = 0 ;
+    while ( NREAD < MEMSTATS ) {
+      NBYTE = read(FD_READ[t], &ptr[NREAD], MEMSTATS-NREAD);
+      if ( NBYTE <= 0 ) { break; }
+      NREAD += NBYTE ;
+    }
+    close(FD_READ[t]);
+
+    waitpid(SIMWORKER.PID[t], &status, 0);
+    if ( NREAD != MEMSTATS || !WIFEXITED(status) || 
+	 WEXITSTATUS(status) != 0 ) {
+      printf(" ERROR: worker %d (pid=%d) failed with status=%d\n",
+	     t, (int)SIMWORKER.PID[t], status );
+      fflush(stdout);
+      NERR++ ;
+    }
+  }
+
+  if ( NERR > 0 ) {
+    sprintf(c1err,"%d of %d workers failed.", NERR, NWORKER);
+    sprintf(c2err,"Check worker errors above.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  merge_simWorkers(SIMFILE_AUX, STATS);
+  free(STATS);
+
+  return(NGEN+1) ;
+
+} // end fork_simWorkers
+
+
+// ***************************
+void init_simWorker(SIMFILE_AUX_DEF *SIMFILE_AUX) {
+
+  // Created Oct 2026
+  // Init forked worker:
+  //  + re-seed randoms with seed derived from RANSEED and worker id
+  //  + set NGEN (and NGEN_LC or NGENTOT_LC) for this worker
+  //  + re-open SIMLIB so that file offset is not shared
+  //  + open separate FITS files and SIMGEN_DUMP file for this worker
+
+  int  ID_WORKER   = SIMWORKER.ID_WORKER ;
+  int  ilc_min     = SIMWORKER.ILC_RANGE[ID_WORKER][0];
+  int  ilc_max     = SIMWORKER.ILC_RANGE[ID_WORKER][1];
+  int  NGEN_WORKER = ilc_max - ilc_min + 1 ;
+  unsigned int ISEED ;
+  char prefix[MXPATHLEN] ;
+  SIMWORKER_STATS_DEF *STATS = &SIMWORKER.STATS ;
+  char fnam[] = "init_simWorker" ;
+
+  // ----------- BEGIN ------------
+
+  // each worker gets a different, but reproducible, seed.
+  // Counter-based randoms are keyed on ilc, so the same seed is kept
+  // and the per-event randoms for a given ilc do not depend on NTHREAD.
+  // However, generated events are NOT identical for different NTHREAD
+  // because each worker starts SIMLIB at a different LIBID using 
+  // randoms drawn before its first event, and the SIMLIB sequence 
+  // is not keyed on ilc.
+  if ( INPUTS.CBRNG_RAN ) {
+    ISEED = INPUTS.ISEED ;
+    set_random_event(-1-ID_WORKER);
+  }
+  else
+    { ISEED = INPUTS.ISEED + 1000003*(unsigned int)(ID_WORKER+1) ; }
+  init_random_seed(ISEED, INPUTS.NSTREAM_RAN);
+
+  INPUTS.NGEN = ilc_max ;
+  if ( INPUTS.NGEN_LC    > 0 ) { INPUTS.NGEN_LC    = NGEN_WORKER; }
+  if ( INPUTS.NGENTOT_LC > 0 ) { INPUTS.NGENTOT_LC = NGEN_WORKER; }
+
+  SIMLIB_reopen_simWorker();
+
+  sprintf(prefix,"%s_W%2.2d", INPUTS.GENPREFIX, ID_WORKER);
+  WR_SNFITSIO_INIT(PATH_SNDATA_SIM
+		   , INPUTS.GENVERSION
+		   , prefix
+		   , INPUTS.WRITE_MASK
+		   , INPUTS.NSUBSAMPLE_MARK
+		   , STATS->HEADFILE); // <== return arg for list file
+
+  // inherited DUMP file was flushed before fork; 
+  // close it here and write a separate DUMP file for this worker.
+  STATS->DUMPFILE[0] = 0 ;
+  if ( INPUTS.NVAR_SIMGEN_DUMP > 0 ) {
+    fclose(SIMFILE_AUX->FP_DUMP);
+    sprintf(STATS->DUMPFILE,"%s_W%2.2d", SIMFILE_AUX->DUMP, ID_WORKER);
+    if ( (SIMFILE_AUX->FP_DUMP = fopen(STATS->DUMPFILE, "wt")) == NULL ) {
+      sprintf(c1err,"Cannot open worker SIMGEN dump file :" );
+      sprintf(c2err," '%s' ", STATS->DUMPFILE );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+  }
+
+  printf("\t worker %2d: ISEED=%u  NGEN=%d  (pid=%d)\n",
+	 ID_WORKER, ISEED, NGEN_WORKER, (int)getpid() );
+  fflush(stdout);
+
+  return ;
+
+} // end init_simWorker
+
+
+// ***************************
+void SIMLIB_reopen_simWorker(void) {
+
+  // Created Oct 2026
+  // Re-open SIMLIB in forked worker. The inherited fp_SIMLIB shares
+  // the file offset (or gunzip pipe) with the other workers, so it is
+  // abandoned (not closed) and a new file pointer is moved past the
+  // global header. For default start (no IDSTART, IDLOCK, MAXRANSTART),
+  // each worker is treated as a batch sub-job so that workers start
+  // at different LIBIDs.
+
+  int  ID_WORKER    = SIMWORKER.ID_WORKER ;
+  int  NWORKER      = SIMWORKER.NWORKER ;
+  int  JOBID_ORIG   = INPUTS.JOBID ;
+  int  NJOBTOT_ORIG = INPUTS.NJOBTOT ;
+  bool FOUND_BEGIN  = false ;
+  char c_get[200];
+  char fnam[] = "SIMLIB_reopen_simWorker" ;
+
+  // ----------- BEGIN ------------
+
+  if ( SIMLIB_BINARY.USE ) 
+    { fp_SIMLIB = fopen_SIMLIB_BINARY(); }
+  else {
+    fp_SIMLIB = open_TEXTgz(INPUTS.SIMLIB_OPENFILE, "rt", 
+			    &INPUTS.SIMLIB_GZIPFLAG );
+  }
+  if ( fp_SIMLIB == NULL ) {
+    sprintf(c1err,"Worker %d cannot re-open SIMLIB", ID_WORKER);
+    sprintf(c2err,"%s", INPUTS.SIMLIB_OPENFILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  while( (fscanf(fp_SIMLIB, "%s", c_get)) != EOF) {
+    if ( strcmp(c_get,"BEGIN") == 0 ) { FOUND_BEGIN = true; break; }
+  }
+  if ( !FOUND_BEGIN ) {
+    sprintf(c1err,"Worker %d cannot find BEGIN key in SIMLIB", ID_WORKER);
+    sprintf(c2err,"%s", INPUTS.SIMLIB_OPENFILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  GENLC.SIMLIB_ID = 0 ;
+  SIMLIB_HEADER.LIBID = 0 ;
+
+  if ( INPUTS.SIMLIB_IDSTART <= 0 && INPUTS.SIMLIB_IDLOCK < 0 &&
+       INPUTS.SIMLIB_MAXRANSTART <= 0 ) {
+    if ( JOBID_ORIG   < 1 ) { JOBID_ORIG   = 1; }
+    if ( NJOBTOT_ORIG < 1 ) { NJOBTOT_ORIG = 1; }
+    INPUTS.JOBID   = (JOBID_ORIG-1)*NWORKER + ID_WORKER + 1 ;
+    INPUTS.NJOBTOT = NJOBTOT_ORIG * NWORKER ;
+  }
+
+  SIMLIB_findStart();
+
+  // restore JOBID and NJOBTOT for gzip logic and README
+  INPUTS.JOBID   = JOBID_ORIG ;
+  INPUTS.NJOBTOT = NJOBTOT_ORIG ;
+
+  return ;
+
+} // end SIMLIB_reopen_simWorker
+
+
+// ***************************
+void end_simWorker(SIMFILE_AUX_DEF *SIMFILE_AUX) {
+
+  // Created Oct 2026
+  // Called by forked worker after its ilc range is done:
+  // close output files, send stats to parent, and exit.
+  // Use _exit to avoid flushing stdio buffers inherited from parent.
+
+  SIMWORKER_STATS_DEF *STATS = &SIMWORKER.STATS ;
+  int  OPTMASK = 0, i, NBYTE, NWR=0 ;
+  int  MEMSTATS = sizeof(SIMWORKER_STATS_DEF);
+  char *ptr = (char*)STATS ;
+
+  // ----------- BEGIN ------------
+
+  if ( INPUTS.NVAR_SIMGEN_DUMP > 0 ) 
+    { fclose(SIMFILE_AUX->FP_DUMP); }
+
+  if ( INPUTS.JOBID > 0 ) { OPTMASK += OPTMASK_SNFITSIO_END_GZIP; }
+  WR_SNFITSIO_END(OPTMASK);
+
+  STATS->NGENLC_TOT      = NGENLC_TOT ;
+  STATS->NGENLC_WRITE    = NGENLC_WRITE ;
+  STATS->NGENSPEC_TOT    = NGENSPEC_TOT ;
+  STATS->NGENSPEC_WRITE  = NGENSPEC_WRITE ;
+  STATS->NGENFLUX_DRIVER = NGENFLUX_DRIVER ;
+  STATS->NGEN_ALLSKIP    = NGEN_ALLSKIP ;
+  STATS->NTYPE_PHOT_WRONGHOST = GENLC.NTYPE_PHOT_WRONGHOST ;
+
+  STATS->NGEN_REJECT_GENRANGE  = NGEN_REJECT.GENRANGE ;
+  STATS->NGEN_REJECT_GENMAG    = NGEN_REJECT.GENMAG ;
+  STATS->NGEN_REJECT_HOSTLIB   = NGEN_REJECT.HOSTLIB ;
+  STATS->NGEN_REJECT_SEARCHEFF = NGEN_REJECT.SEARCHEFF ;
+  STATS->NGEN_REJECT_CUTWIN    = NGEN_REJECT.CUTWIN ;
+  STATS->NGEN_REJECT_NEPOCH    = NGEN_REJECT.NEPOCH ;
+  STATS->NGEN_REJECT_GENPAR_SELECT = NGEN_REJECT.GENPAR_SELECT_FILE ;
+
+  for(i=0; i < MXIDSURVEY; i++ ) {
+    STATS->NGENLC_TOT_SUBSURVEY[i]   = NGENLC_TOT_SUBSURVEY[i];
+    STATS->NGENLC_WRITE_SUBSURVEY[i] = NGENLC_WRITE_SUBSURVEY[i];
+  }
+  for(i=0; i < 10; i++ ) {
+    STATS->NGENLC_HOSTMATCH[i]  = WRITE_HOSTMATCH.NGENLC[i];
+    STATS->NGENLC_NO_HOST[i]    = WRITE_HOSTMATCH.NGENLC_NO_HOST[i];
+    STATS->NGENLC_MULTI_HOST[i] = WRITE_HOSTMATCH.NGENLC_MULTI_HOST[i];
+  }
+  for(i=0; i < NSTAGE_TIMER; i++ ) {
+    STATS->NCALL_STAGE[i] = TIMERS_STAGE.NCALL[i];
+    STATS->TSUM_STAGE[i]  = TIMERS_STAGE.TSUM[i];
+  }
+
+  printf("\t worker %2d done: NGENLC_TOT=%d  NGENLC_WRITE=%d \n",
+	 SIMWORKER.ID_WORKER, NGENLC_TOT, NGENLC_WRITE );
+  fflush(stdout);
+
+  while ( NWR < MEMSTATS ) {
+    NBYTE = write(SIMWORKER.FD_PIPE, &ptr[NWR], MEMSTATS-NWR);
+    if ( NBYTE <= 0 ) { _exit(1); }
+    NWR += NBYTE ;
+  }
+  close(SIMWORKER.FD_PIPE);
+
+  _exit(0);
+
+} // end end_simWorker
+
+
+// ***************************
+void merge_simWorkers(SIMFILE_AUX_DEF *SIMFILE_AUX, 
+		      SIMWORKER_STATS_DEF *STATS) {
+
+  // Created Oct 2026
+  // Parent merges worker stats and outputs in worker order:
+  //  + sum counters used for screen summary and README
+  //  + write each worker HEAD file to LIST file
+  //  + append each worker SIMGEN_DUMP table to DUMP file
+  //    (skip comment lines for workers after the first)
+  //  + compute generation efficiency.
+
+  int  NWORKER = SIMWORKER.NWORKER ;
+  int  t, i ;
+  FILE *fp ;
+  char LINE[MXPATHLEN*4];
+  char fnam[] = "merge_simWorkers" ;
+
+  // ----------- BEGIN ------------
+
+  print_banner(fnam);
+
+  for(t=0; t < NWORKER; t++ ) {
+    NGENLC_TOT      += STATS[t].NGENLC_TOT ;
+    NGENLC_WRITE    += STATS[t].NGENLC_WRITE ;
+    NGENSPEC_TOT    += STATS[t].NGENSPEC_TOT ;
+    NGENSPEC_WRITE  += STATS[t].NGENSPEC_WRITE ;
+    NGENFLUX_DRIVER += STATS[t].NGENFLUX_DRIVER ;
+    NGEN_ALLSKIP    += STATS[t].NGEN_ALLSKIP ;
+    GENLC.NTYPE_PHOT_WRONGHOST += STATS[t].NTYPE_PHOT_WRONGHOST ;
+
+    NGEN_REJECT.GENRANGE  += STATS[t].NGEN_REJECT_GENRANGE ;
+    NGEN_REJECT.GENMAG    += STATS[t].NGEN_REJECT_GENMAG ;
+    NGEN_REJECT.HOSTLIB   += STATS[t].NGEN_REJECT_HOSTLIB ;
+    NGEN_REJECT.SEARCHEFF += STATS[t].NGEN_REJECT_SEARCHEFF ;
+    NGEN_REJECT.CUTWIN    += STATS[t].NGEN_REJECT_CUTWIN ;
+    NGEN_REJECT.NEPOCH    += STATS[t].NGEN_REJECT_NEPOCH ;
+    NGEN_REJECT.GENPAR_SELECT_FILE += STATS[t].NGEN_REJECT_GENPAR_SELECT;
+
+    for(i=0; i < MXIDSURVEY; i++ ) {
+      NGENLC_TOT_SUBSURVEY[i]   += STATS[t].NGENLC_TOT_SUBSURVEY[i];
+      NGENLC_WRITE_SUBSURVEY[i] += STATS[t].NGENLC_WRITE_SUBSURVEY[i];
+    }
+    for(i=0; i < 10; i++ ) {
+      WRITE_HOSTMATCH.NGENLC[i]            += STATS[t].NGENLC_HOSTMATCH[i];
+      WRITE_HOSTMATCH.NGENLC_NO_HOST[i]    += STATS[t].NGENLC_NO_HOST[i];
+      WRITE_HOSTMATCH.NGENLC_MULTI_HOST[i] += STATS[t].NGENLC_MULTI_HOST[i];
+    }
+    for(i=0; i < NSTAGE_TIMER; i++ ) {
+      TIMERS_STAGE.NCALL[i] += STATS[t].NCALL_STAGE[i];
+      TIMERS_STAGE.TSUM[i]  += STATS[t].TSUM_STAGE[i];
+    }
+
+    fprintf(SIMFILE_AUX->FP_LIST, "%s\n", STATS[t].HEADFILE );
+
+    printf("\t worker %2d: NGENLC_TOT=%8d  NGENLC_WRITE=%8d  %s\n",
+	   t, STATS[t].NGENLC_TOT, STATS[t].NGENLC_WRITE, 
+	   STATS[t].HEADFILE );
+  }
+
+  // - - - - - 
+  // append worker SIMGEN_DUMP tables
+  if ( INPUTS.NVAR_SIMGEN_DUMP > 0 ) {
+    for(t=0; t < NWORKER; t++ ) {
+      fp = fopen(STATS[t].DUMPFILE, "rt");
+      if ( fp == NULL ) {
+	sprintf(c1err,"Cannot open SIMGEN dump file from worker %d", t);
+	sprintf(c2err,"%s", STATS[t].DUMPFILE);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+      }
+      while ( fgets(LINE, sizeof(LINE), fp) != NULL ) {
+	if ( t > 0 && LINE[0] == '#' ) { continue; }
+	fputs(LINE, SIMFILE_AUX->FP_DUMP);
+      }
+      fclose(fp);
+      remove(STATS[t].DUMPFILE);
+    }
+  }
+
+  fflush(stdout);
+
+  // compute generation efficiency from merged counters
+  geneff_calc();
+
+  return ;
+
+} // end merge_simWorkers
+
+
 // *************************
 int LUPDGEN(int N) {
   // May 27, 2009
@@ -687,6 +1200,8 @@ void set_user_defaults(void) {
   INPUTS.ISEED       = 1 ;
 
   INPUTS.RANLIST_START_GENSMEAR = 1 ;
+  INPUTS.CBRNG_RAN = 0 ;  // default is RANSTORE lists
+  INPUTS.SHARED_TABLES = 0 ; // default is private tables per job
 
 #ifdef ONE_RANDOM_STREAM
   INPUTS.NSTREAM_RAN = 1 ; // for Mac (7.30.2020
@@ -710,6 +1225,7 @@ void set_user_defaults(void) {
   
   INPUTS.JOBID      = 0;         // for batch only
   INPUTS.NJOBTOT    = 0;         // for batch only
+  INPUTS.NTHREAD    = 1;         // 1 -> no forked workers
   INPUTS.NSUBSAMPLE_MARK = 0 ;
 
   // Mar 2020: use updated cosmoparameters defined in sntools.h
@@ -1037,6 +1553,7 @@ void set_user_defaults(void) {
   INPUTS.SIMLIB_NREPEAT  =  1 ;
   INPUTS.NSKIP_SIMLIB    =  0 ;
   INPUTS.SIMLIB_MINSEASON = 0.0 ;
+  INPUTS.SIMLIB_CACHE_MXMB = 200 ; // Oct 2026
 
   INPUTS.SIMLIB_CADENCEFOM_ANGSEP     = 0.0 ; // (deg); default is all calc.
   INPUTS.SIMLIB_CADENCEFOM_PARLIST[0] = 0.0 ; // 1st param and parList flag
@@ -1163,6 +1680,7 @@ void set_user_defaults(void) {
   // ------
   INPUTS.APPLY_CUTWIN_OPT = 0;
   INPUTS.NCUTWIN_TOT = 0 ;
+  INPUTS.EARLY_REJECT_NEVT_TRAIN = 0 ; // Oct 2026: 0 -> disable
 
   INPUTS_SEARCHEFF.FIX_EFF_PIPELINE = -9.0 ;
   INPUTS_SEARCHEFF.FUNEFF_DEBUG     = 0 ; // 1->100% eff, 2-> hackFun
@@ -1870,6 +2388,15 @@ int parse_input_key_driver(char **WORDS, int keySource ) {
   else if ( keyMatchSim(1,"RANLIST_START_GENSMEAR", WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%d", &INPUTS.RANLIST_START_GENSMEAR );
   }
+  else if ( keyMatchSim(1,"CBRNG_RAN", WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.CBRNG_RAN );
+  }
+  else if ( keyMatchSim(1,"SHARED_TABLES", WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.SHARED_TABLES );
+  }
+  else if ( keyMatchSim(1,"NTHREAD", WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.NTHREAD );
+  }
   // - - - - DNDZ stuff - - - - 
   else if ( ISKEY_RATE ) {
     N += parse_input_RATEPAR(WORDS, keySource, "NOMINAL",
@@ -3264,6 +3791,9 @@ int parse_input_SIMLIB(char **WORDS, int keySource ) {
   else if ( keyMatchSim(1, "SIMLIB_MINSEASON",  WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%le", &INPUTS.SIMLIB_MINSEASON );
   }
+  else if ( keyMatchSim(1, "SIMLIB_CACHE_MXMB",  WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.SIMLIB_CACHE_MXMB );
+  }
   else if ( keyMatchSim(1, "SIMLIB_DUMP",  WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%d", &INPUTS.SIMLIB_DUMP );
   }
@@ -3327,6 +3857,7 @@ int parse_input_HOSTLIB(char **WORDS, int keySource ) {
   // Jul 01 2021: read forgotten INPUTS.HOSTLIB_MAXDDLR
   // Jul 16 2021: fix override logic by setting INPUTS.HOSTLIB_USE=1
   //               only if it is not already set.
+  // Oct 16 2026: add +HOSTBINARY
 
   int  j, ITMP, N=0, nread, MSKOPT_OLD ;
   char *ptr_str ,ctmp[60];
@@ -3371,6 +3902,8 @@ int parse_input_HOSTLIB(char **WORDS, int keySource ) {
       { INPUTS.HOSTLIB_MSKOPT += HOSTLIB_MSKOPT_PLUSMAGS; }
     if ( (MSKOPT_OLD & HOSTLIB_MSKOPT_PLUSNBR)>0 ) 
       { INPUTS.HOSTLIB_MSKOPT += HOSTLIB_MSKOPT_PLUSNBR; }
+    if ( (MSKOPT_OLD & HOSTLIB_MSKOPT_WRITEBIN)>0 ) 
+      { INPUTS.HOSTLIB_MSKOPT += HOSTLIB_MSKOPT_WRITEBIN; }
 
     setbit_HOSTLIB_MSKOPT(HOSTLIB_MSKOPT_USE) ;
   }
@@ -3390,6 +3923,13 @@ int parse_input_HOSTLIB(char **WORDS, int keySource ) {
     INPUTS.HOSTLIB_USE = 2; // set rewrite flag
     sprintf(INPUTS.HOSTLIB_PLUS_COMMAND,"%s", WORDS[0]);
   }
+  else if ( keyMatchSim( 1, "+HOSTBINARY", WORDS[0], keySource ) ) {
+    INPUTS.HOSTLIB_MSKOPT += HOSTLIB_MSKOPT_WRITEBIN ; // binary HOSTLIB
+    N += FLAG_NWD_ZERO; // flag that key has no argument
+    setbit_HOSTLIB_MSKOPT(HOSTLIB_MSKOPT_USE) ;
+    INPUTS.HOSTLIB_USE = 2; // set rewrite flag
+    sprintf(INPUTS.HOSTLIB_PLUS_COMMAND,"%s", WORDS[0]);
+  }
   else if ( keyMatchSim( 1, "SEPNBR_MAX", WORDS[0], keySource ) ) {
     N++; sscanf(WORDS[N], "%le", &HOSTLIB_NBR_WRITE.SEPNBR_MAX );
   }
@@ -3624,6 +4164,10 @@ int  parse_input_CUTWIN(char **WORDS, int keySource ) {
    N++;  sscanf(WORDS[N], "%d", &INPUTS.APPLY_CUTWIN_OPT );
    return(N) ;
  }
+ else if ( keyMatchSim(1, "EARLY_REJECT_NEVT_TRAIN", WORDS[0],keySource)) {
+   N++;  sscanf(WORDS[N], "%d", &INPUTS.EARLY_REJECT_NEVT_TRAIN );
+   return(N) ;
+ }
  else if ( keyMatchSim(1, "EPCUTWIN_LAMREST", WORDS[0],keySource)) {
    N++;  sscanf(WORDS[N], "%f", &INPUTS.EPCUTWIN_LAMREST[0] );
    N++;  sscanf(WORDS[N], "%f", &INPUTS.EPCUTWIN_LAMREST[1] );
@@ -5721,6 +6265,7 @@ void prep_user_input(void) {
   Oct 16 2020: call prep_user_cosmology()
   Feb 21 2021: abort on FORMAT_MASK +=1, or legacy VERBOSE 
   oct 14 2021: set spectra bit of WRITE_MASK if spectrograph is used.
+  Oct 16 2026: check WRFLAG_THREAD_FITS
 
   *******************/
 
@@ -6405,6 +6950,7 @@ void prep_user_input(void) {
   WRFLAG_FITS      = 0 ;
   WRFLAG_FILTERS   = 0 ;
   WRFLAG_COMPACT   = 0 ;
+  WRFLAG_THREAD_FITS = 0 ;
 
   // check for whether to write FULL, TERSE, FITS, etc ,
   // EXCEPT for the GRID-GEN option (for psnid ...), 
@@ -6417,9 +6963,12 @@ void prep_user_input(void) {
     WRFLAG_FITS      = ( INPUTS.FORMAT_MASK  & WRMASK_FITS      ) ;
     WRFLAG_FILTERS   = ( INPUTS.FORMAT_MASK  & WRMASK_FILTERS   ) ;
     WRFLAG_COMPACT   = ( INPUTS.FORMAT_MASK  & WRMASK_COMPACT   ) ;
+    WRFLAG_THREAD_FITS = ( INPUTS.FORMAT_MASK & WRMASK_THREAD_FITS ) ;
   }
   if ( WRFLAG_BLINDTEST ) { INPUTS.WRITE_MASK  = WRITE_MASK_LCMERGE ; }
   if ( WRFLAG_COMPACT   ) { INPUTS.WRITE_MASK += WRITE_MASK_COMPACT ; }
+  if ( WRFLAG_THREAD_FITS && WRFLAG_FITS ) 
+    { INPUTS.WRITE_MASK += WRITE_MASK_THREAD_FITS ; }
   if ( INPUTS.MAGMONITOR_SNR) { 
     SNDATA.MAGMONITOR_SNR = INPUTS.MAGMONITOR_SNR ;
     sprintf(SNDATA.VARNAME_SNRMON, "SIM_SNRMAG%2.2d", SNDATA.MAGMONITOR_SNR);
@@ -6572,6 +7121,8 @@ void prep_user_input(void) {
     INPUTS.RESTORE_FLUXERR_BUGS = true ;
     printf("\t Restore bugs for DES3YR analysis.\n");
   }
+
+  prep_simWorkers(); // Oct 2026
     
 
   printf("\n");
@@ -8126,6 +8677,10 @@ void init_simvar(void) {
 
   NGENFLUX_DRIVER = 0 ;
 
+  SIMWORKER.NWORKER   =  1 ;  // Oct 2026: no forked workers
+  SIMWORKER.ID_WORKER = -1 ;  // -1 -> parent process
+  SIMWORKER.FD_PIPE   = -1 ;
+
   NGEN_REJECT.GENRANGE  = 0;
   NGEN_REJECT.GENMAG    = 0;
   NGEN_REJECT.HOSTLIB   = 0;
@@ -9073,6 +9628,9 @@ void rewrite_HOSTLIB_DRIVER(void) {
   if ( (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_APPEND )>0 ) 
     { rewrite_HOSTLIB_plusAppend(INPUTS.HOSTLIB_APPEND_FILE); }
 
+  if ( (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_WRITEBIN )>0 ) 
+    { rewrite_HOSTLIB_BINARY(); } // Oct 2026
+
 } // end rewrite_HOSTLIB_DRIVER
 
 // *****************************************************
@@ -10869,7 +11427,9 @@ void gen_event_driver(int ilc) {
     // read entry from libray after generated PEAKMJD and redshift ;
     // see comment above.
 
+    set_TIMERS_STAGE(1,ISTAGE_TIMER_SIMLIB);
     SIMLIB_READ_DRIVER();
+    set_TIMERS_STAGE(2,ISTAGE_TIMER_SIMLIB);
 
     GENLC.CID   = GENLC.CIDOFF + ilc ; 
 
@@ -10905,7 +11465,9 @@ void gen_event_driver(int ilc) {
     // Note that SNHOST_DRIVER can change GENLC.REDSHIFT_CMB 
     // and DLMAG to match that of the HOST
     // Similarly, GENLC.REDSHIFT_HOST is changed to be the true zhost
+    set_TIMERS_STAGE(1,ISTAGE_TIMER_HOSTLIB);
     GEN_SNHOST_DRIVER(zHOST, GENLC.PEAKMJD); 
+    set_TIMERS_STAGE(2,ISTAGE_TIMER_HOSTLIB);
 
     // Jun 12 2020 
     //  if no SN par in WGTMAP, generate SN params after picking host
@@ -12645,12 +13207,19 @@ void set_TIMERS(int flag) {
   // flag=0 -> start
   // flag=1 -> end of init
   // flat=2 -> end of job
+  //
+  // Oct 16 2026: flag=0 also resets TIMERS_STAGE
 
+  int istage;
   char fnam[] = "set_TIMERS" ;
   // ---------- BEGIN -----------
 
   if ( flag == 0 ) {
     TIMERS.t_start = time(NULL);
+    for(istage=0; istage < NSTAGE_TIMER; istage++ ) {
+      TIMERS_STAGE.NCALL[istage] = 0 ;
+      TIMERS_STAGE.TSUM[istage]  = 0.0 ;
+    }
   }
   else if ( flag == 1 ) {
     TIMERS.t_end_init    = time(NULL); // Mar 15 2020
@@ -12669,6 +13238,35 @@ void set_TIMERS(int flag) {
   return;
 } // end set_TIMERS
 
+
+// ***********************************************
+void set_TIMERS_STAGE(int flag, int istage) {
+
+  // Created Oct 16 2026
+  // flag=1 -> start timer for istage
+  // flag=2 -> stop timer; increment call count and time sum.
+  // Uses monotonic wall clock (vDSO, no syscall) so that overhead is
+  // negligible compared to each driver.
+
+  struct timespec t1, *t0 = &TIMERS_STAGE.T0[istage] ;
+
+  // ---------- BEGIN -----------
+
+  if ( flag == 1 ) {
+    clock_gettime(CLOCK_MONOTONIC, t0);
+  }
+  else {
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    TIMERS_STAGE.TSUM[istage] += 
+      (double)(t1.tv_sec - t0->tv_sec) + 
+      1.0E-9 * (double)(t1.tv_nsec - t0->tv_nsec) ;
+    TIMERS_STAGE.NCALL[istage]++ ;
+  }
+
+  return;
+
+} // end set_TIMERS_STAGE
+
 // ***********************************************
 void wr_SIMGEN_YAML(SIMFILE_AUX_DEF *SIMFILE_AUX) {
   
@@ -12691,6 +13289,16 @@ void wr_SIMGEN_YAML(SIMFILE_AUX_DEF *SIMFILE_AUX) {
   fprintf(fp, "NGENSPEC_WRITE:  %d\n",    NGENSPEC_WRITE );
   fprintf(fp, "CPU_MINUTES:     %.2f\n",  t_gen/60.0     );
   fprintf(fp, "ABORT_IF_ZERO:   %d\n",    NGENLC_WRITE   );
+
+  // Oct 2026: wall time per driver stage
+  int  istage;
+  char key[40];
+  fprintf(fp, "WALL_STAGE_SUMMARY:   # [NCALL, WALL_SEC] for each stage\n");
+  for(istage=0; istage < NSTAGE_TIMER; istage++ ) {
+    sprintf(key, "%s:", STAGENAME_TIMER[istage]);
+    fprintf(fp, "  %-12s [%lld, %.3f]\n", 
+	    key, TIMERS_STAGE.NCALL[istage], TIMERS_STAGE.TSUM[istage] );
+  }
   
   // write a few extras when creating binary flux table for SIMSED model
   if ( SIMSED_BINARY_INFO.WRFLAG_FLUX ) {
@@ -14414,8 +15022,11 @@ void gen_redshift_LCLIB(void) {
 
   GENLC.REDSHIFT_HELIO = ZHEL_TRUE ;
   GENLC.REDSHIFT_CMB   = ZCMB_TRUE ;
-  if ( LCLIB_INFO.IPAR_REDSHIFT > 0  ) 
-    { GEN_SNHOST_DRIVER(ZHEL_TRUE, GENLC.PEAKMJD); }
+  if ( LCLIB_INFO.IPAR_REDSHIFT > 0  ) {
+    set_TIMERS_STAGE(1,ISTAGE_TIMER_HOSTLIB);
+    GEN_SNHOST_DRIVER(ZHEL_TRUE, GENLC.PEAKMJD); 
+    set_TIMERS_STAGE(2,ISTAGE_TIMER_HOSTLIB);
+  }
   else
     { SNHOSTGAL.ZPHOT = SNHOSTGAL.ZPHOT_ERR  = 0.0 ; }
 
@@ -15341,8 +15952,9 @@ void SIMLIB_INIT_DRIVER(void) {
   // Jan 31 2021: 
   //   for INIT_ONLY flag, return after initGlobalHeader in case
   //   the global header has rate info such as SOLID_ANGLE.
+  // Oct 16 2026: check SIMLIB_MSKOPT_WRITEBIN; init SIMLIB_CACHE
   
-  //  char fnam[] = "SIMLIB_INIT_DRIVER" ;
+  char fnam[] = "SIMLIB_INIT_DRIVER" ;
 
   // --------------- BEGIN --------------
 
@@ -15354,6 +15966,19 @@ void SIMLIB_INIT_DRIVER(void) {
 
   SIMLIB_prepGlobalHeader();   
 
+  // Oct 2026: check option to convert text SIMLIB into binary and quit
+  if ( (INPUTS.SIMLIB_MSKOPT & SIMLIB_MSKOPT_WRITEBIN) > 0 ) 
+    { SIMLIB_write_BINARY(); }
+
+  if ( SIMLIB_BINARY.USE && 
+       SIMLIB_BINARY.HEAD->NEA_PSF_UNIT != SIMLIB_GLOBAL_HEADER.NEA_PSF_UNIT){
+    sprintf(c1err,"PSF_UNIT in header does not match binary SIMLIB");
+    sprintf(c2err,"Re-create binary SIMLIB '%s'", SIMLIB_BINARY.FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  init_SIMLIB_CACHE(); // Oct 2026
+
   if ( INPUTS.INIT_ONLY == 1 ) { return; } 
 
   SIMLIB_findStart();    // find first LIBID to start reading
@@ -15419,6 +16044,7 @@ void SIMLIB_readGlobalHeader_TEXT(void) {
   //
   // Sep 3 2020: check REQUIRE_DOCANA
   // Nov 12 2021: read optional FIELD
+  // Oct 16 2026: check for binary SIMLIB
 
   char PATH_DEFAULT[2*MXPATHLEN];
   char *OPENFILE      = INPUTS.SIMLIB_OPENFILE;
@@ -15436,8 +16062,19 @@ void SIMLIB_readGlobalHeader_TEXT(void) {
   // xxx  OPENMASK = OPENMASK_VERBOSE + OPENMASK_IGNORE_DOCANA;
 
   sprintf(PATH_DEFAULT, "%s %s/simlib",  PATH_USER_INPUT, PATH_SNDATA_ROOT );
-  fp_SIMLIB = snana_openTextFile(OPENMASK, PATH_DEFAULT, INPUTS.SIMLIB_FILE, 
-				 OPENFILE, &INPUTS.SIMLIB_GZIPFLAG );
+
+  if ( open_SIMLIB_BINARY(PATH_DEFAULT) ) {
+    // Oct 2026: binary SIMLIB; read text part with same code below
+    sprintf(OPENFILE, "%s", SIMLIB_BINARY.FILENAME);
+    INPUTS.SIMLIB_GZIPFLAG = 0 ;
+    fp_SIMLIB = fopen_SIMLIB_BINARY();
+    if ( !check_openFile_docana(REQUIRE_DOCANA, fp_SIMLIB, OPENFILE) )
+      { rewind(fp_SIMLIB); }
+  }
+  else {
+    fp_SIMLIB = snana_openTextFile(OPENMASK, PATH_DEFAULT, INPUTS.SIMLIB_FILE,
+				   OPENFILE, &INPUTS.SIMLIB_GZIPFLAG );
+  }
   
   if ( fp_SIMLIB == NULL ) {
     abort_openTextFile("SIMLIB_FILE", PATH_DEFAULT, INPUTS.SIMLIB_FILE, fnam);
@@ -15865,6 +16502,8 @@ void SIMLIB_findStart(void) {
   //
   // Dec 09 2020: return immediately if QUIT_REWIND option is set to
   //     read SIMLIB once and stop. See SIMLIB_MSKOPT += 4.
+  //
+  // Oct 16 2026: for binary SIMLIB, seek directly to start LIBID.
 
   int IDSTART  = INPUTS.SIMLIB_IDSTART ;
   int IDLOCK   = INPUTS.SIMLIB_IDLOCK ;
@@ -15958,12 +16597,18 @@ void SIMLIB_findStart(void) {
   fflush(stdout);
 
   
-  // skip fixed number of LIBIDs
-  while ( NREAD < NSKIP_LIBID ) {
-    fgets(LINE, 40, fp_SIMLIB) ;
-    if ( strstr(LINE,"END_LIBID:") != NULL ) { NREAD++; }
+  if ( SIMLIB_BINARY.USE ) {
+    // jump directly to LIBID using index in binary SIMLIB
+    seek_SIMLIB_BINARY(NSKIP_LIBID, IDSEEK);
+  }
+  else {
+    // skip fixed number of LIBIDs
+    while ( NREAD < NSKIP_LIBID ) {
+      fgets(LINE, 40, fp_SIMLIB) ;
+      if ( strstr(LINE,"END_LIBID:") != NULL ) { NREAD++; }
+    }
   }
-  
+
 
   // search for specific LIBID
   while ( IDSEEK > SIMLIB_HEADER.LIBID ) {   
@@ -16334,6 +16979,8 @@ void  SIMLIB_readNextCadence_TEXT(void) {
   //
   // Nov 29 2022: fix bug setting FIELD per epoch with overlaps.
   //              See field and FIELD_LIST.
+  //
+  // Oct 16 2026: for binary SIMLIB, 'S:' values are already parsed.
 
 #define MXWDLIST_SIMLIB 20  // max number of words per line to read
 
@@ -16564,6 +17211,12 @@ void  SIMLIB_readNextCadence_TEXT(void) {
 
 	SIMLIB_OBS_RAW.OPTLINE[ISTORE] = OPTLINE ;
 
+	if ( SIMLIB_BINARY.USE ) { 
+	  // values were parsed when binary SIMLIB was written
+	  load_obs_SIMLIB_BINARY(WDLIST[IWD+1], ISTORE);  
+	  goto LOADED_OBS ;
+	}
+
 	IWD++; sscanf(WDLIST[IWD], "%le", &SIMLIB_OBS_RAW.MJD[ISTORE]);
 
 	IWD++; sscanf(WDLIST[IWD], "%s", ctmp );
@@ -16594,6 +17247,8 @@ void  SIMLIB_readNextCadence_TEXT(void) {
 
 	IWD++; sscanf(WDLIST[IWD], "%le", &SIMLIB_OBS_RAW.ZPTERR[ISTORE]   );  
 	IWD++; sscanf(WDLIST[IWD], "%le", &SIMLIB_OBS_RAW.MAG[ISTORE]      );
+
+      LOADED_OBS:
 	iwd = NWD; 
 
 	if ( INPUTS.FORCEVAL_PSF > 0.001 )  // Sep 2020
@@ -16713,63 +17368,501 @@ void  SIMLIB_readNextCadence_TEXT(void) {
 } // end SIMLIB_readNextCadence_TEXT
 
 
-// ==============================================
-void SIMLIB_randomize_skyCoords(void) {
+// ==================================================
+int open_SIMLIB_BINARY(char *PATH_LIST) {
+
+  // Created Oct 16 2026
+  // If SIMLIB_FILE is binary (written with SIMLIB_MSKOPT += 1024),
+  // mmap the file and return 1; else return 0. Search path is the
+  // current directory, then PATH_LIST.
+  // The file is mapped read-only so that all jobs on a node share
+  // the same pages. Text part of binary SIMLIB is opened by
+  // fopen_SIMLIB_BINARY.
+
+  int  ipath, NPATH, fd, NRD ;
+  long long NOBS, SIZE_EXPECT ;
+  struct stat statbuf ;
+  char *PATH[4], sepKey[] = " ", FILENAME[MXPATHLEN], MAGIC[32] ;
+  char *MAP, *ptrINT ;
+  SIMLIB_BINARY_HEAD_DEF *HEAD ;
+  char fnam[] = "open_SIMLIB_BINARY" ;
 
-  // Created Aug 24 2018
-  //
-  // Check option to randomly shift 
-  //   SIMLIB_HEADER.RA 
-  //   SIMLIB_HEADER.DEC
-  // To avoid fixed set of RA,DEC from SIMLIB.
-  //
-  // Initial function is just a do-nothing shell;
-  // waiting to get C function that picks randonly
-  // within healPix area.
+  // ----------- BEGIN ----------
 
-  //  char fnam[] = "SIMLIB_randomize_skyCoords" ;
+  SIMLIB_BINARY.USE = false ;
+
+  sprintf(FILENAME, "%s", INPUTS.SIMLIB_FILE);
+  fd = open(FILENAME, O_RDONLY);
+  if ( fd < 0 ) {
+    for(ipath=0; ipath < 4; ipath++ )
+      { PATH[ipath] = (char*) malloc(MXPATHLEN*sizeof(char) ); }
+    splitString(PATH_LIST, sepKey, 4, &NPATH, PATH );
+    for(ipath=0; ipath < NPATH && fd < 0; ipath++ ) {
+      sprintf(FILENAME, "%s/%s", PATH[ipath], INPUTS.SIMLIB_FILE);
+      fd = open(FILENAME, O_RDONLY);
+    }
+    for(ipath=0; ipath < 4; ipath++ )  { free(PATH[ipath]); }
+  }
+  if ( fd < 0 ) { return(0); } // let text-open give error message
+
+  memset(MAGIC, 0, sizeof(MAGIC));
+  NRD = read(fd, MAGIC, sizeof(MAGIC)-1) ;
+  if ( NRD <= 0 || strcmp(MAGIC,MAGIC_SIMLIB_BINARY) != 0 ) 
+    { close(fd);  return(0); }
+
+  fstat(fd, &statbuf);
+  SIMLIB_BINARY.MAPSIZE = (size_t)statbuf.st_size ;
+  MAP = (char*)mmap(NULL, SIMLIB_BINARY.MAPSIZE, PROT_READ, MAP_PRIVATE,
+		    fd, 0);
+  close(fd);
+  if ( MAP == MAP_FAILED ) {
+    sprintf(c1err,"Could not mmap binary SIMLIB (%.1f MB)",
+	    (double)SIMLIB_BINARY.MAPSIZE/1.0E6 );
+    sprintf(c2err,"'%s'", FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
 
-  // --------------- BEGIN -------------
+  HEAD = (SIMLIB_BINARY_HEAD_DEF*)MAP ;
+  NOBS = HEAD->NOBS ;
+  SIZE_EXPECT = HEAD->OFFSET_OBS + 
+    NOBS * (NVAR_OBS_SIMLIB_BINARY*sizeof(double) + 3*sizeof(int) + 4);
+  if ( SIZE_EXPECT > (long long)SIMLIB_BINARY.MAPSIZE ||
+       HEAD->OFFSET_TEXT + HEAD->LEN_TEXT > HEAD->OFFSET_LIB ) {
+    sprintf(c1err,"Binary SIMLIB is truncated (%lld < %lld bytes)",
+	    (long long)SIMLIB_BINARY.MAPSIZE, SIZE_EXPECT );
+    sprintf(c2err,"'%s'", FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
 
-  return ;
+  SIMLIB_BINARY.USE       = true ;
+  SIMLIB_BINARY.MAP       = MAP ;
+  SIMLIB_BINARY.HEAD      = HEAD ;
+  SIMLIB_BINARY.LIB       = (SIMLIB_BINARY_LIB_DEF*)(MAP + HEAD->OFFSET_LIB);
+  SIMLIB_BINARY.MJD       = (double*)(MAP + HEAD->OFFSET_OBS) ;
+  SIMLIB_BINARY.CCDGAIN   = SIMLIB_BINARY.MJD       + NOBS ;
+  SIMLIB_BINARY.READNOISE = SIMLIB_BINARY.CCDGAIN   + NOBS ;
+  SIMLIB_BINARY.SKYSIG    = SIMLIB_BINARY.READNOISE + NOBS ;
+  SIMLIB_BINARY.PSFSIG1   = SIMLIB_BINARY.SKYSIG    + NOBS ;
+  SIMLIB_BINARY.PSFSIG2   = SIMLIB_BINARY.PSFSIG1   + NOBS ;
+  SIMLIB_BINARY.PSFRATIO  = SIMLIB_BINARY.PSFSIG2   + NOBS ;
+  SIMLIB_BINARY.NEA       = SIMLIB_BINARY.PSFRATIO  + NOBS ;
+  SIMLIB_BINARY.ZPTADU    = SIMLIB_BINARY.NEA       + NOBS ;
+  SIMLIB_BINARY.ZPTERR    = SIMLIB_BINARY.ZPTADU    + NOBS ;
+  SIMLIB_BINARY.MAG       = SIMLIB_BINARY.ZPTERR    + NOBS ;
+  ptrINT = (char*)(SIMLIB_BINARY.MAG + NOBS) ;
+  SIMLIB_BINARY.IDEXPT     = (int*)ptrINT ;
+  SIMLIB_BINARY.NEXPOSE    = SIMLIB_BINARY.IDEXPT  + NOBS ;
+  SIMLIB_BINARY.INDEX_SORT = SIMLIB_BINARY.NEXPOSE + NOBS ;
+  SIMLIB_BINARY.BAND       = (char*)(SIMLIB_BINARY.INDEX_SORT + NOBS) ;
+  sprintf(SIMLIB_BINARY.FILENAME, "%s", FILENAME);
+
+  printf("\t mmap binary SIMLIB: %d LIBIDs, %lld obs (%.1f MB)\n",
+	 HEAD->NLIBID, NOBS, (double)SIMLIB_BINARY.MAPSIZE/1.0E6);
+  fflush(stdout);
 
-} // end SIMLIB_randomize_skyCoords
+  return(1);
 
+} // end open_SIMLIB_BINARY
 
-// ==============================================
-int keep_SIMLIB_HEADER(void) {
+// ==================================================
+FILE *fopen_SIMLIB_BINARY(void) {
 
-  // Created Aug 2017
-  // Return ACCEPT_FLAG if SIMLIB_HEADER values pass cuts.
-  // Return REJECT_FLAG if SIMLIB_HEADER fails cuts, or REWIND flag is set
-  //
-  // Nov 28 2019: few checks for SIMLIB model.
-  // May 30 2020: increment SIMLIB_HEADER.NFOUND_GENCUTS after all cuts.
+  // Created Oct 16 2026
+  // Return read-stream to text part of mmapped binary SIMLIB.
+  SIMLIB_BINARY_HEAD_DEF *HEAD = SIMLIB_BINARY.HEAD ;
+  return fmemopen(SIMLIB_BINARY.MAP + HEAD->OFFSET_TEXT, 
+		  (size_t)HEAD->LEN_TEXT, "r");
 
-  int  ID      = SIMLIB_HEADER.LIBID ;
-  int  NOBS    = SIMLIB_HEADER.NOBS ;
-  int  IDLOCK  = GENLC.SIMLIB_IDLOCK ;
-  int  NSKIP   = INPUTS.NSKIP_SIMLIB ;
-  int  NWRAP   = SIMLIB_HEADER.NWRAP ;
-  double  zCMB = GENLC.REDSHIFT_CMB ;
-  bool  ISMODEL_SIMLIB = ( INDEX_GENMODEL == MODEL_SIMLIB );
-  bool  ISMODEL_SALT2  = ( INDEX_GENMODEL == MODEL_SALT2  );
-  double z_min     = SIMLIB_HEADER.GENRANGE_REDSHIFT[0];
-  double pkmjd_min = SIMLIB_HEADER.GENGAUSS_PEAKMJD.RANGE[0];
+} // end fopen_SIMLIB_BINARY
 
-  int  iskip, icheck ;
-  double *ptrGen ;
-  char fnam[] = "keep_SIMLIB_HEADER" ;
-  int LTRACE  = 0; // (SIMLIB_HEADER.LIBID == 4 );
+// ==================================================
+int seek_SIMLIB_BINARY(int NSKIP_LIBID, int IDSEEK) {
 
-  // ----------- BEGIN ---------------
+  // Created Oct 16 2026
+  // Move fp_SIMLIB to start of a LIBID using index in binary SIMLIB:
+  //  NSKIP_LIBID > 0 -> skip this many LIBIDs (same as fgets loop
+  //                      in SIMLIB_findStart, without reading text)
+  //  IDSEEK >= 0     -> first LIBID in file with LIBID >= IDSEEK
+  // Function returns index of LIB record, or -1 if there is no seek.
 
-  if(LTRACE) {
-    printf(" xxx %s: ----------- LIBID=%d  NOBS_RAW=%d ------------ \n", 
-	   fnam, SIMLIB_HEADER.LIBID, NOBS );
-  }
+  int NLIBID = SIMLIB_BINARY.HEAD->NLIBID ;
+  int ilib   = -1 ;
+  //  char fnam[] = "seek_SIMLIB_BINARY" ;
 
-  // for SIMLIB model, make sure required REDSHIFT and PEAKMJD
+  // ----------- BEGIN ----------
+
+  if ( NLIBID <= 0 ) { return(ilib); }
+
+  if ( NSKIP_LIBID > 0 ) 
+    { ilib = NSKIP_LIBID % NLIBID ; }
+  else if ( IDSEEK >= 0 ) {
+    for(ilib=0; ilib < NLIBID; ilib++ ) 
+      { if ( SIMLIB_BINARY.LIB[ilib].LIBID >= IDSEEK ) { break; } }
+    if ( ilib == NLIBID ) { ilib = -1; } // let READ_DRIVER wrap & abort
+  }
+
+  if ( ilib >= 0 ) 
+    { fseek(fp_SIMLIB, (long)SIMLIB_BINARY.LIB[ilib].OFFSET, SEEK_SET); }
+
+  return(ilib);
+
+} // end seek_SIMLIB_BINARY
+
+// ==================================================
+int ilib_SIMLIB_BINARY(long long IOBS) {
+
+  // Created Oct 16 2026
+  // Return index of LIB record containing obs index IOBS 
+  // (binary search), or -1 if not found.
+
+  int NLIBID = SIMLIB_BINARY.HEAD->NLIBID ;
+  int ilo = 0, ihi = NLIBID-1, imid ;
+  SIMLIB_BINARY_LIB_DEF *LIB = SIMLIB_BINARY.LIB ;
+
+  // ----------- BEGIN ----------
+
+  if ( NLIBID <= 0 || IOBS < LIB[0].IOBS ) { return(-1); }
+
+  while ( ilo < ihi ) {
+    imid = (ilo + ihi + 1) / 2 ;
+    if ( LIB[imid].IOBS <= IOBS ) { ilo = imid; } else { ihi = imid-1; }
+  }
+
+  if ( IOBS >= LIB[ilo].IOBS + LIB[ilo].NOBS ) { return(-1); }
+  return(ilo);
+
+} // end ilib_SIMLIB_BINARY
+
+// ==================================================
+void load_obs_SIMLIB_BINARY(char *cIOBS, int ISTORE) {
+
+  // Created Oct 16 2026
+  // For binary SIMLIB, 'S:' line is "S: #IOBS"; copy pre-parsed 
+  // values for IOBS into SIMLIB_OBS_RAW[ISTORE]. Same PSF/NEA logic
+  // as for text SIMLIB.
+
+  long long IOBS = -9 ;
+  char fnam[] = "load_obs_SIMLIB_BINARY" ;
+
+  // ----------- BEGIN ----------
+
+  if ( cIOBS[0] == '#' ) { sscanf(&cIOBS[1], "%lld", &IOBS); }
+  if ( IOBS < 0 || IOBS >= SIMLIB_BINARY.HEAD->NOBS ) {
+    sprintf(c1err,"Invalid obs index '%s' for LIBID=%d", 
+	    cIOBS, SIMLIB_HEADER.LIBID );
+    sprintf(c2err,"Check binary SIMLIB '%s'", SIMLIB_BINARY.FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  SIMLIB_BINARY.IOBS_RAW[ISTORE] = IOBS ;
+
+  SIMLIB_OBS_RAW.MJD[ISTORE]       = SIMLIB_BINARY.MJD[IOBS] ;
+  SIMLIB_OBS_RAW.IDEXPT[ISTORE]    = SIMLIB_BINARY.IDEXPT[IOBS] ;
+  SIMLIB_OBS_RAW.NEXPOSE[ISTORE]   = SIMLIB_BINARY.NEXPOSE[IOBS] ;
+  sprintf(SIMLIB_OBS_RAW.BAND[ISTORE], "%s", &SIMLIB_BINARY.BAND[4*IOBS]);
+  SIMLIB_OBS_RAW.CCDGAIN[ISTORE]   = SIMLIB_BINARY.CCDGAIN[IOBS] ;
+  SIMLIB_OBS_RAW.READNOISE[ISTORE] = SIMLIB_BINARY.READNOISE[IOBS] ;
+  SIMLIB_OBS_RAW.SKYSIG[ISTORE]    = SIMLIB_BINARY.SKYSIG[IOBS] ;
+
+  if ( SIMLIB_GLOBAL_HEADER.NEA_PSF_UNIT ) 
+    { SIMLIB_OBS_RAW.NEA[ISTORE] = SIMLIB_BINARY.NEA[IOBS] ; }
+  else {
+    SIMLIB_OBS_RAW.PSFSIG1[ISTORE]  = SIMLIB_BINARY.PSFSIG1[IOBS] ;
+    SIMLIB_OBS_RAW.PSFSIG2[ISTORE]  = SIMLIB_BINARY.PSFSIG2[IOBS] ;
+    SIMLIB_OBS_RAW.PSFRATIO[ISTORE] = SIMLIB_BINARY.PSFRATIO[IOBS] ;
+  }
+
+  SIMLIB_OBS_RAW.ZPTADU[ISTORE]    = SIMLIB_BINARY.ZPTADU[IOBS] ;
+  SIMLIB_OBS_RAW.ZPTERR[ISTORE]    = SIMLIB_BINARY.ZPTERR[IOBS] ;
+  SIMLIB_OBS_RAW.MAG[ISTORE]       = SIMLIB_BINARY.MAG[IOBS] ;
+
+  return ;
+
+} // end load_obs_SIMLIB_BINARY
+
+// ==================================================
+void SIMLIB_write_BINARY(void) {
+
+  // Created Oct 16 2026
+  // Write binary version of SIMLIB_FILE (SIMLIB_MSKOPT += 1024) 
+  // and quit. Output is written in current directory with name
+  // [SIMLIB_FILE].BIN (without .gz); see SIMLIB_BINARY_HEAD_DEF 
+  // for format. Each 'S:' line is parsed here exactly as in
+  // SIMLIB_readNextCadence_TEXT, and for each LIBID without APPEND 
+  // or SPECTROGRAPH keys the MJD-sort is stored so that the sim 
+  // can skip SIMLIB_sortbyMJD.
+
+  int  NEA_PSF_UNIT = SIMLIB_GLOBAL_HEADER.NEA_PSF_UNIT ;
+  int  MEMOBS = 0, MEMLIB = 0, NLIBID = 0, NWD, iwd, ivar, gzipFlag ;
+  bool IN_LIBID = false, ISKEY_S ;
+  long long NOBS = 0, iobs, IOBS0, OFFSET ;
+  size_t    LENBUF = 0 ;
+  ssize_t   LENLINE ;
+  double   *VAL[NVAR_OBS_SIMLIB_BINARY], *MJD_SORT, MJD, MJD_LAST ;
+  int      *IDEXPT = NULL, *NEXPOSE = NULL, *INDEX_SORT = NULL ;
+  char     *BAND = NULL, *LINE = NULL, *ptrSuffix ;
+  char      WDLIST[MXWDLIST_SIMLIB][200], *ptrWDLIST[MXWDLIST_SIMLIB];
+  char      cline[400], SLINE[40], sepKey[] = " " ;
+  char      SLIB_TMP[MXPATHLEN], DUMPATH[MXPATHLEN], SLIB_NEW[MXPATHLEN];
+  char      SLIB_NEW_TMP[MXPATHLEN+20], zero[8] = { 0,0,0,0,0,0,0,0 } ;
+  SIMLIB_BINARY_HEAD_DEF HEAD ;
+  SIMLIB_BINARY_LIB_DEF *LIB = NULL ;
+  FILE *FP_ORIG, *FP_NEW ;
+  char fnam[] = "SIMLIB_write_BINARY" ;
+
+  // ----------- BEGIN ----------
+
+  print_banner(fnam);
+
+  if ( SIMLIB_BINARY.USE ) {
+    sprintf(c1err,"SIMLIB_FILE is already binary");
+    sprintf(c2err,"Check SIMLIB_FILE='%s'", INPUTS.SIMLIB_FILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  for(iwd=0; iwd < MXWDLIST_SIMLIB; iwd++ ) { ptrWDLIST[iwd] = WDLIST[iwd]; }
+  for(ivar=0; ivar < NVAR_OBS_SIMLIB_BINARY; ivar++ ) { VAL[ivar] = NULL; }
+
+  FP_ORIG = open_TEXTgz(INPUTS.SIMLIB_OPENFILE, "rt", &gzipFlag );
+  if ( !FP_ORIG ) {
+    sprintf(c1err,"Could not re-open SIMLIB_FILE");
+    sprintf(c2err,"'%s' ", INPUTS.SIMLIB_OPENFILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  // output file name: remove path and .gz, add suffix;
+  // write tmp file and rename so that other jobs never see partial file.
+  sprintf(SLIB_TMP,"%s", INPUTS.SIMLIB_FILE );
+  ptrSuffix = strstr(SLIB_TMP,".gz");
+  if ( ptrSuffix != NULL && strlen(ptrSuffix) == 3 ) { *ptrSuffix = 0; }
+  strcat(SLIB_TMP, SUFFIX_SIMLIB_BINARY);
+  extract_MODELNAME(SLIB_TMP, DUMPATH, SLIB_NEW);
+  sprintf(SLIB_NEW_TMP, "%s.tmp%d", SLIB_NEW, (int)getpid() );
+
+  FP_NEW = fopen(SLIB_NEW_TMP, "wb");
+  if ( !FP_NEW ) {
+    sprintf(c1err,"Could not open binary SIMLIB");
+    sprintf(c2err,"'%s' ", SLIB_NEW_TMP);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+#define ALIGN8_SIMLIB_BINARY(X) ( ((X)+7) & ~7LL )
+  memset(&HEAD, 0, sizeof(HEAD));
+  fwrite(&HEAD, sizeof(HEAD), 1, FP_NEW);  // header placeholder
+  HEAD.OFFSET_TEXT = ALIGN8_SIMLIB_BINARY((long long)sizeof(HEAD));
+  while ( ftell(FP_NEW) < HEAD.OFFSET_TEXT ) { fwrite(zero,1,1,FP_NEW); }
+
+  // - - - - - - - - - - - - 
+  // copy text, replacing 'S:' lines, and parse 'S:' lines
+  while ( (LENLINE = getline(&LINE, &LENBUF, FP_ORIG)) > 0 ) {
+
+    OFFSET = ftell(FP_NEW) - HEAD.OFFSET_TEXT ;
+
+    NWD = 0 ;  ISKEY_S = false ;
+    if ( !commentchar(LINE) && LENLINE < 380 ) { // 380 as in reader
+      sprintf(cline, "%s", LINE);
+      if ( (ptrSuffix=strchr(cline,'\n')) != NULL ) { *ptrSuffix = 0; }
+      splitString2(cline, sepKey, MXWDLIST_SIMLIB, &NWD, ptrWDLIST);
+      if ( NWD > MXWDLIST_SIMLIB ) { NWD = MXWDLIST_SIMLIB; }
+      ISKEY_S = ( NWD > 0 && strcmp(WDLIST[0],"S:") == 0 );
+    }
+
+    for(iwd=0; iwd < NWD; iwd++ ) {
+      if ( strcmp(WDLIST[iwd],"LIBID:") == 0 ) {
+	if ( NLIBID == MEMLIB ) {
+	  MEMLIB += 1000 ;
+	  LIB = (SIMLIB_BINARY_LIB_DEF*)
+	    realloc(LIB, MEMLIB*sizeof(SIMLIB_BINARY_LIB_DEF));
+	}
+	memset(&LIB[NLIBID], 0, sizeof(SIMLIB_BINARY_LIB_DEF));
+	if ( NWD > iwd+1 ) { sscanf(WDLIST[iwd+1], "%d", &LIB[NLIBID].LIBID); }
+	LIB[NLIBID].OFFSET = OFFSET ;
+	LIB[NLIBID].IOBS   = NOBS ;
+	LIB[NLIBID].SORTED = 1 ;
+	NLIBID++ ;  IN_LIBID = true ;
+      }
+      else if ( strcmp(WDLIST[iwd],"END_LIBID:") == 0 ) 
+	{ IN_LIBID = false; }
+      else if ( IN_LIBID && (strcmp(WDLIST[iwd],"APPEND:") == 0 ||
+			     strcmp(WDLIST[iwd],"SPECTROGRAPH:") == 0) )
+	{ LIB[NLIBID-1].SORTED = 0 ; }
+    }
+
+    if ( !ISKEY_S ) { fwrite(LINE, 1, LENLINE, FP_NEW);  continue; }
+
+    // - - - - 'S:' line - - - - 
+    if ( NOBS == MEMOBS ) {
+      MEMOBS += 100000 ;
+      for(ivar=0; ivar < NVAR_OBS_SIMLIB_BINARY; ivar++ ) 
+	{ VAL[ivar] = (double*)realloc(VAL[ivar], MEMOBS*sizeof(double)); }
+      IDEXPT  = (int *)realloc(IDEXPT,  MEMOBS*sizeof(int) );
+      NEXPOSE = (int *)realloc(NEXPOSE, MEMOBS*sizeof(int) );
+      BAND    = (char*)realloc(BAND,  4*MEMOBS*sizeof(char) );
+    }
+    for(ivar=0; ivar < NVAR_OBS_SIMLIB_BINARY; ivar++ ) 
+      { VAL[ivar][NOBS] = 0.0; }
+
+    // same order as SIMLIB_readNextCadence_TEXT
+    iwd = 0 ;
+    iwd++ ; sscanf(WDLIST[iwd], "%le", &VAL[0][NOBS] );   // MJD
+    iwd++ ; parse_SIMLIB_IDplusNEXPOSE(WDLIST[iwd], &IDEXPT[NOBS], 
+				       &NEXPOSE[NOBS] );
+    iwd++ ; 
+    if ( strlen(WDLIST[iwd]) > 3 ) {
+      sprintf(c1err,"Invalid band '%s' for LIBID=%d", 
+	      WDLIST[iwd], LIB[NLIBID-1].LIBID );
+      sprintf(c2err,"Band must have <= 3 chars.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+    sprintf(&BAND[4*NOBS], "%s", WDLIST[iwd]);
+    iwd++ ; sscanf(WDLIST[iwd], "%le", &VAL[1][NOBS] );   // CCDGAIN
+    iwd++ ; sscanf(WDLIST[iwd], "%le", &VAL[2][NOBS] );   // READNOISE
+    iwd++ ; sscanf(WDLIST[iwd], "%le", &VAL[3][NOBS] );   // SKYSIG
+    if ( NEA_PSF_UNIT ) 
+      { iwd++ ; sscanf(WDLIST[iwd], "%le", &VAL[7][NOBS] ); } // NEA
+    else {
+      iwd++ ; sscanf(WDLIST[iwd], "%le", &VAL[4][NOBS] );   // PSFSIG1
+      iwd++ ; sscanf(WDLIST[iwd], "%le", &VAL[5][NOBS] );   // PSFSIG2
+      iwd++ ; sscanf(WDLIST[iwd], "%le", &VAL[6][NOBS] );   // PSFRATIO
+      checkval_D("PSF1(write_BINARY)", 1, &VAL[4][NOBS], 0.0, 30.0 ) ;
+    }
+    iwd++ ; sscanf(WDLIST[iwd], "%le", &VAL[8][NOBS] );   // ZPTADU
+    checkval_D("ZPT(write_BINARY)", 1, &VAL[8][NOBS], 5.0, 50.0 ) ;
+    iwd++ ; sscanf(WDLIST[iwd], "%le", &VAL[9][NOBS] );   // ZPTERR
+    iwd++ ; sscanf(WDLIST[iwd], "%le", &VAL[10][NOBS] );  // MAG
+
+    sprintf(SLINE, "S: #%lld\n", NOBS);
+    fwrite(SLINE, 1, strlen(SLINE), FP_NEW);
+
+    if ( IN_LIBID ) { LIB[NLIBID-1].NOBS++ ; }
+    NOBS++ ;
+  } // end getline loop
+
+  if(gzipFlag ) { pclose(FP_ORIG); }  else { fclose(FP_ORIG); }
+  free(LINE);
+
+  HEAD.LEN_TEXT = ftell(FP_NEW) - HEAD.OFFSET_TEXT ;
+
+  // - - - - - - - - - - - - 
+  // MJD-sort for each LIBID, using duplicate-MJD logic from
+  // SIMLIB_prepMJD_forSORT so that sort matches SIMLIB_sortbyMJD.
+  INDEX_SORT = (int   *)malloc( (NOBS+1)*sizeof(int) );
+  MJD_SORT   = (double*)malloc( (NOBS+1)*sizeof(double) );
+  for(iobs=0; iobs < NOBS; iobs++ ) { INDEX_SORT[iobs] = -9 ; }
+
+  for(iwd=0; iwd < NLIBID; iwd++ ) {
+    if ( LIB[iwd].NOBS == 0 || LIB[iwd].NOBS > MXOBS_SIMLIB ) 
+      { LIB[iwd].SORTED = 0; }
+    if ( !LIB[iwd].SORTED ) { continue; }
+    IOBS0 = LIB[iwd].IOBS ;  MJD_LAST = -9.0 ;
+    for(iobs=0; iobs < LIB[iwd].NOBS; iobs++ ) {
+      MJD = VAL[0][IOBS0+iobs] ;
+      MJD_SORT[iobs] = MJD ;
+      if ( fabs(MJD-MJD_LAST) < 0.0001 ) 
+	{ MJD_SORT[iobs] = MJD_SORT[iobs-1] + 0.00001 ; }
+      MJD_LAST = MJD ;
+    }
+    sortDouble( LIB[iwd].NOBS, MJD_SORT, +1, &INDEX_SORT[IOBS0] );
+  }
+
+  // - - - - - - - - - - - - 
+  // write LIB index and obs arrays
+  HEAD.OFFSET_LIB = ALIGN8_SIMLIB_BINARY(HEAD.OFFSET_TEXT + HEAD.LEN_TEXT);
+  HEAD.OFFSET_OBS = HEAD.OFFSET_LIB + 
+    (long long)NLIBID*sizeof(SIMLIB_BINARY_LIB_DEF) ;
+
+  while ( ftell(FP_NEW) < HEAD.OFFSET_LIB ) { fwrite(zero,1,1,FP_NEW); }
+  fwrite(LIB, sizeof(SIMLIB_BINARY_LIB_DEF), NLIBID, FP_NEW);
+
+  for(ivar=0; ivar < NVAR_OBS_SIMLIB_BINARY; ivar++ ) 
+    { fwrite(VAL[ivar], sizeof(double), NOBS, FP_NEW); }
+  fwrite(IDEXPT,     sizeof(int), NOBS, FP_NEW);
+  fwrite(NEXPOSE,    sizeof(int), NOBS, FP_NEW);
+  fwrite(INDEX_SORT, sizeof(int), NOBS, FP_NEW);
+  fwrite(BAND,       sizeof(char), 4*NOBS, FP_NEW);
+
+  sprintf(HEAD.MAGIC, "%s", MAGIC_SIMLIB_BINARY);
+  HEAD.NLIBID       = NLIBID ;
+  HEAD.NEA_PSF_UNIT = NEA_PSF_UNIT ;
+  HEAD.NOBS         = NOBS ;
+  fseek(FP_NEW, 0, SEEK_SET);
+  fwrite(&HEAD, sizeof(HEAD), 1, FP_NEW);
+
+  if ( fclose(FP_NEW) != 0 || rename(SLIB_NEW_TMP,SLIB_NEW) != 0 ) {
+    sprintf(c1err,"Failed writing binary SIMLIB");
+    sprintf(c2err,"'%s' ", SLIB_NEW);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  printf("\n  Created '%s' \n", SLIB_NEW);
+  printf("  Wrote %d LIBIDs and %lld obs (%.1f MB)\n", 
+	 NLIBID, NOBS, 
+	 (double)(HEAD.OFFSET_OBS + NOBS*(NVAR_OBS_SIMLIB_BINARY*8+16))/1.0E6);
+  printf("  Use this file as SIMLIB_FILE for fast SIMLIB reading.\n");
+  fflush(stdout);
+
+  exit(0);
+
+} // end SIMLIB_write_BINARY
+
+
+// ==============================================
+void SIMLIB_randomize_skyCoords(void) {
+
+  // Created Aug 24 2018
+  //
+  // Check option to randomly shift 
+  //   SIMLIB_HEADER.RA 
+  //   SIMLIB_HEADER.DEC
+  // To avoid fixed set of RA,DEC from SIMLIB.
+  //
+  // Initial function is just a do-nothing shell;
+  // waiting to get C function that picks randonly
+  // within healPix area.
+
+  //  char fnam[] = "SIMLIB_randomize_skyCoords" ;
+
+  // --------------- BEGIN -------------
+
+  return ;
+
+} // end SIMLIB_randomize_skyCoords
+
+
+// ==============================================
+int keep_SIMLIB_HEADER(void) {
+
+  // Created Aug 2017
+  // Return ACCEPT_FLAG if SIMLIB_HEADER values pass cuts.
+  // Return REJECT_FLAG if SIMLIB_HEADER fails cuts, or REWIND flag is set
+  //
+  // Nov 28 2019: few checks for SIMLIB model.
+  // May 30 2020: increment SIMLIB_HEADER.NFOUND_GENCUTS after all cuts.
+
+  int  ID      = SIMLIB_HEADER.LIBID ;
+  int  NOBS    = SIMLIB_HEADER.NOBS ;
+  int  IDLOCK  = GENLC.SIMLIB_IDLOCK ;
+  int  NSKIP   = INPUTS.NSKIP_SIMLIB ;
+  int  NWRAP   = SIMLIB_HEADER.NWRAP ;
+  double  zCMB = GENLC.REDSHIFT_CMB ;
+  bool  ISMODEL_SIMLIB = ( INDEX_GENMODEL == MODEL_SIMLIB );
+  bool  ISMODEL_SALT2  = ( INDEX_GENMODEL == MODEL_SALT2  );
+  double z_min     = SIMLIB_HEADER.GENRANGE_REDSHIFT[0];
+  double pkmjd_min = SIMLIB_HEADER.GENGAUSS_PEAKMJD.RANGE[0];
+
+  int  iskip, icheck ;
+  double *ptrGen ;
+  char fnam[] = "keep_SIMLIB_HEADER" ;
+  int LTRACE  = 0; // (SIMLIB_HEADER.LIBID == 4 );
+
+  // ----------- BEGIN ---------------
+
+  if(LTRACE) {
+    printf(" xxx %s: ----------- LIBID=%d  NOBS_RAW=%d ------------ \n", 
+	   fnam, SIMLIB_HEADER.LIBID, NOBS );
+  }
+
+  // for SIMLIB model, make sure required REDSHIFT and PEAKMJD
   // are in the header.
   if ( ISMODEL_SIMLIB ) {
     if ( pkmjd_min < 1000.0 ) {
@@ -17154,9 +18247,11 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
   // Dec 08 2020: increase max PSF limit fro 9.9 to 20 (for LSST)
   // Feb 28 2021: check PSF_UNIT for NEA 
   // Jan 14 2022: transfer SUBSURVEY info to GENLC; compute SUBSURVEY_ID
+  // Oct 16 2026: use SIMLIB_CACHE for sort, seasons & template IFIELD
 
   int NOBS_RAW    = SIMLIB_OBS_RAW.NOBS; // xxx SIMLIB_HEADER.NOBS ;
   int NEW_CADENCE = (REPEAT_CADENCE == 0 ) ;
+  bool CACHED ;
   int ISTORE,  OPTLINE, OBSRAW ;
   double RAD = RADIAN;
   double PIXSIZE, FUDGE_ZPTERR, NEA, PSF[3], TREST ;
@@ -17199,6 +18294,9 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
   }
   NGENLC_TOT_SUBSURVEY[GENLC.SUBSURVEY_ID]++ ; 
 
+  // check for sort & seasons from previous use of this LIBID
+  CACHED = load_SIMLIB_CACHE(REPEAT_CADENCE);
+
   // --------------------------------------------------------------
   // do a few things for a NEW cadence, 
   // but not for a repeated/re-used cadence
@@ -17266,13 +18364,13 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
     // -------------------------------------------
     // 1b. sort MJDs for new LIBID only 
 
-    SIMLIB_sortbyMJD();
+    if ( !CACHED ) { SIMLIB_sortbyMJD(); }
 
   } // end NEW_CADENCE 
 
   // - - - - - - - - - - - - - - - - - - - 
   // chop MJD range into seasons to allow user options
-  store_SIMLIB_SEASONS();
+  store_SIMLIB_SEASONS(CACHED);
 
   // - - - - - - -
   int isort, ifilt, IFILT_OBS, NEXPOSE, KEEP, NEP, NEP_NEWMJD ;
@@ -17446,7 +18544,7 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
     // check template noise for normal filters   
     if ( (IFLAG_TEMPLATE & 1)>0 && IFLAG_SYNFILT == 0 ) {
 
-      IFIELD = IFIELD_OVP_SIMLIB(1,FIELD);
+      IFIELD = get_IFIELD_SIMLIB_CACHE(OBSRAW,FIELD);
       if ( IFIELD < 0 || IFIELD >= MXFIELD_OVP ) {
 	sprintf(c1err,"Invalid IFIELD=%d for template FIELD='%s'",
 		IFIELD,FIELD);
@@ -18049,17 +19147,25 @@ void set_SIMLIB_MJDrange(int OPT, double *MJDrange) {
 
 
 // ==============================================
-void store_SIMLIB_SEASONS(void) {
+void store_SIMLIB_SEASONS(bool CACHED) {
 
   // Compute and store SIMLIB_HEADER.[seasonInfo]
   //
+  // Oct 16 2026: 
+  //   if CACHED=true, seasons were already loaded from SIMLIB_CACHE;
+  //   else compute seasons and store in SIMLIB_CACHE.
  
   double MJD, MJD_LAST;
   int    isort, NLINE_MJD, NLINE, ISEASON, ISGAP, FIRST ;  
+  int    j;
+  double DT, MJD_MIN, MJD_MAX, DT_MIN=999999.9;
+  double DT_TEST[2], z1 = 1.0 + GENLC.REDSHIFT_CMB ;
   char fnam[] = "store_SIMLIB_SEASONS" ;
 
   // -------------- BEGIN ------------
 
+  if ( CACHED ) { goto DTSEASON ; }
+
   SIMLIB_HEADER.NSEASON = 1;
   MJD_LAST = -9.0 ;
   NLINE_MJD = SIMLIB_LIST_forSORT.NMJD;
@@ -18116,14 +19222,14 @@ void store_SIMLIB_SEASONS(void) {
   // Aug 2018: check for minimum  Season length requirement 
   remove_short_SIMLIB_SEASON();
 
+  store_SIMLIB_CACHE();
+
+ DTSEASON:
+
   // check time in season |MJD_season_edge - PEAKMJD|
   // DTSEASON_PEAK > 0 if in season; negative if out of season.
   // This variable is useful for selecting NEVT_TOTAL for efficiencies.
 
-  int j;
-  double DT, MJD_MIN, MJD_MAX, DT_MIN=999999.9;
-  double DT_TEST[2], z1 = 1.0 + GENLC.REDSHIFT_CMB ;
-
   //  printf(" xxx %s: ------- LIBID=%d ---------- \n", 
   //	 fnam, SIMLIB_HEADER.LIBID);
 
@@ -18265,6 +19371,217 @@ void remove_short_SIMLIB_SEASON(void) {
 } // end  remove_short_SIMLIB_SEASON
 
 
+// =========================================
+void init_SIMLIB_CACHE(void) {
+
+  // Created Oct 16 2026
+  // Init cache of prepared cadences (see load_SIMLIB_CACHE).
+  // SIMLIB_CACHE_MXMB=0 disables cache.
+
+  int ib;
+  // ---------------- BEGIN -------------
+
+  SIMLIB_CACHE.NENTRY   = SIMLIB_CACHE.MXENTRY = 0 ;
+  SIMLIB_CACHE.ICURRENT = -1 ;
+  SIMLIB_CACHE.MEMTOT   = 0 ;
+  SIMLIB_CACHE.MEMMAX   = (long long)INPUTS.SIMLIB_CACHE_MXMB * 1000000 ;
+  SIMLIB_CACHE.NHIT     = SIMLIB_CACHE.NMISS = SIMLIB_CACHE.NFULL = 0 ;
+  SIMLIB_CACHE.ENTRY    = NULL ;
+  for(ib=0; ib < NBUCKET_SIMLIB_CACHE; ib++ ) { SIMLIB_CACHE.FIRST[ib] = -1; }
+
+  return ;
+
+} // end init_SIMLIB_CACHE
+
+// =========================================
+bool load_SIMLIB_CACHE(int REPEAT_CADENCE) {
+
+  // Created Oct 16 2026
+  // If current cadence (SIMLIB_OBS_RAW) was already prepared,
+  // load MJD-sort and season info from SIMLIB_CACHE and return true.
+  // Otherwise return false, and store_SIMLIB_SEASONS will call
+  // store_SIMLIB_CACHE after computing seasons.
+  // Key is LIBID + NOBS + hash of raw MJD/OPTLINE/APPEND values;
+  // hash is skipped for repeated cadence (SIMLIB_NREPEAT).
+
+  int  LIBID    = SIMLIB_HEADER.LIBID ;
+  int  NOBS_RAW = SIMLIB_OBS_RAW.NOBS ;
+  int  ISTORE, ientry, ISEASON ;
+  unsigned int HASH = 2166136261u ;
+  unsigned char *ptr ;
+  SIMLIB_CACHE_ENTRY_DEF *ENTRY ;
+  size_t ib, NBYTE ;
+  //  char fnam[] = "load_SIMLIB_CACHE" ;
+
+  // ---------------- BEGIN -------------
+
+  if ( SIMLIB_CACHE.MEMMAX <= 0 ) { return(false); }
+
+  ientry = SIMLIB_CACHE.ICURRENT ;
+  if ( REPEAT_CADENCE && ientry >= 0 && NPEREVT_TAKE_SPECTRUM == 0 &&
+       SIMLIB_CACHE.ENTRY[ientry].LIBID == LIBID &&
+       SIMLIB_CACHE.ENTRY[ientry].NOBS  == NOBS_RAW ) 
+    { goto LOAD ; }
+
+  // FNV-1a hash of raw cadence
+#define HASH_SIMLIB_CACHE(X) \
+  ptr = (unsigned char*)&(X);  NBYTE = sizeof(X);	\
+  for(ib=0; ib < NBYTE; ib++ ) { HASH ^= ptr[ib]; HASH *= 16777619u; }
+
+  HASH_SIMLIB_CACHE(SIMLIB_HEADER.NOBS_APPEND);
+  for(ISTORE=0; ISTORE < NOBS_RAW; ISTORE++ ) {
+    HASH_SIMLIB_CACHE(SIMLIB_OBS_RAW.MJD[ISTORE]);
+    HASH_SIMLIB_CACHE(SIMLIB_OBS_RAW.OPTLINE[ISTORE]);
+    HASH_SIMLIB_CACHE(SIMLIB_OBS_RAW.APPEND_PHOTFLAG[ISTORE]);
+  }
+  SIMLIB_CACHE.HASH_CURRENT = HASH ;
+
+  ientry = SIMLIB_CACHE.FIRST[ (unsigned int)LIBID % NBUCKET_SIMLIB_CACHE ];
+  while ( ientry >= 0 ) {
+    ENTRY = &SIMLIB_CACHE.ENTRY[ientry] ;
+    if ( ENTRY->LIBID == LIBID && ENTRY->NOBS == NOBS_RAW &&
+	 ENTRY->HASH  == HASH ) { goto LOAD ; }
+    ientry = ENTRY->NEXT ;
+  }
+
+  SIMLIB_CACHE.ICURRENT = -1 ;
+  SIMLIB_CACHE.NMISS++ ;
+  return(false);
+
+ LOAD:
+  ENTRY = &SIMLIB_CACHE.ENTRY[ientry] ;
+  SIMLIB_CACHE.ICURRENT = ientry ;
+  SIMLIB_CACHE.NHIT++ ;
+
+  SIMLIB_LIST_forSORT.NMJD = ENTRY->NMJD ;
+  memcpy(SIMLIB_LIST_forSORT.INDEX_SORT, ENTRY->INDEX_SORT, 
+	 NOBS_RAW*sizeof(int) );
+  memcpy(SIMLIB_OBS_RAW.ISEASON, ENTRY->ISEASON, NOBS_RAW*sizeof(int) );
+
+  SIMLIB_HEADER.NSEASON = ENTRY->NSEASON ;
+  for(ISEASON=0; ISEASON < ENTRY->NSEASON; ISEASON++ ) {
+    SIMLIB_HEADER.MJDRANGE_SEASON[ISEASON][0] = 
+      ENTRY->MJDRANGE_SEASON[ISEASON][0];
+    SIMLIB_HEADER.MJDRANGE_SEASON[ISEASON][1] = 
+      ENTRY->MJDRANGE_SEASON[ISEASON][1];
+    SIMLIB_HEADER.TLEN_SEASON[ISEASON] = ENTRY->TLEN_SEASON[ISEASON];
+  }
+  SIMLIB_HEADER.MJDRANGE_SURVEY[0] = ENTRY->MJDRANGE_SURVEY[0];
+  SIMLIB_HEADER.MJDRANGE_SURVEY[1] = ENTRY->MJDRANGE_SURVEY[1];
+
+  return(true);
+
+} // end load_SIMLIB_CACHE
+
+// =========================================
+void store_SIMLIB_CACHE(void) {
+
+  // Created Oct 16 2026
+  // Store MJD-sort and seasons for current cadence, unless
+  // SIMLIB_CACHE_MXMB is exceeded.
+
+  int  NOBS_RAW = SIMLIB_OBS_RAW.NOBS ;
+  int  ientry, ibucket, ISEASON, OBSRAW ;
+  long long MEM = sizeof(SIMLIB_CACHE_ENTRY_DEF) + 3LL*NOBS_RAW*sizeof(int);
+  SIMLIB_CACHE_ENTRY_DEF *ENTRY ;
+  //  char fnam[] = "store_SIMLIB_CACHE" ;
+
+  // ---------------- BEGIN -------------
+
+  SIMLIB_CACHE.ICURRENT = -1 ;
+  if ( SIMLIB_CACHE.MEMMAX <= 0 ) { return; }
+  if ( SIMLIB_CACHE.MEMTOT + MEM > SIMLIB_CACHE.MEMMAX ) 
+    { SIMLIB_CACHE.NFULL++ ;  return; }
+
+  if ( SIMLIB_CACHE.NENTRY == SIMLIB_CACHE.MXENTRY ) {
+    SIMLIB_CACHE.MXENTRY += 1000 ;
+    SIMLIB_CACHE.ENTRY = (SIMLIB_CACHE_ENTRY_DEF*)
+      realloc(SIMLIB_CACHE.ENTRY, 
+	      SIMLIB_CACHE.MXENTRY * sizeof(SIMLIB_CACHE_ENTRY_DEF) );
+  }
+
+  ientry  = SIMLIB_CACHE.NENTRY ;
+  ibucket = (unsigned int)SIMLIB_HEADER.LIBID % NBUCKET_SIMLIB_CACHE ;
+  ENTRY   = &SIMLIB_CACHE.ENTRY[ientry] ;
+
+  ENTRY->LIBID   = SIMLIB_HEADER.LIBID ;
+  ENTRY->NOBS    = NOBS_RAW ;
+  ENTRY->NMJD    = SIMLIB_LIST_forSORT.NMJD ;
+  ENTRY->HASH    = SIMLIB_CACHE.HASH_CURRENT ;
+  ENTRY->NEXT    = SIMLIB_CACHE.FIRST[ibucket] ;
+  ENTRY->NSEASON = SIMLIB_HEADER.NSEASON ;
+  for(ISEASON=0; ISEASON < SIMLIB_HEADER.NSEASON; ISEASON++ ) {
+    ENTRY->MJDRANGE_SEASON[ISEASON][0] = 
+      SIMLIB_HEADER.MJDRANGE_SEASON[ISEASON][0] ;
+    ENTRY->MJDRANGE_SEASON[ISEASON][1] = 
+      SIMLIB_HEADER.MJDRANGE_SEASON[ISEASON][1] ;
+    ENTRY->TLEN_SEASON[ISEASON] = SIMLIB_HEADER.TLEN_SEASON[ISEASON] ;
+  }
+  ENTRY->MJDRANGE_SURVEY[0] = SIMLIB_HEADER.MJDRANGE_SURVEY[0];
+  ENTRY->MJDRANGE_SURVEY[1] = SIMLIB_HEADER.MJDRANGE_SURVEY[1];
+
+  ENTRY->INDEX_SORT = (int*)malloc( 3*(NOBS_RAW+1)*sizeof(int) );
+  ENTRY->ISEASON    = ENTRY->INDEX_SORT + NOBS_RAW + 1 ;
+  ENTRY->IFIELD     = ENTRY->ISEASON    + NOBS_RAW + 1 ;
+  memcpy(ENTRY->INDEX_SORT, SIMLIB_LIST_forSORT.INDEX_SORT, 
+	 NOBS_RAW*sizeof(int) );
+  memcpy(ENTRY->ISEASON, SIMLIB_OBS_RAW.ISEASON, NOBS_RAW*sizeof(int) );
+  for(OBSRAW=0; OBSRAW < NOBS_RAW; OBSRAW++ ) { ENTRY->IFIELD[OBSRAW] = -99; }
+
+  SIMLIB_CACHE.FIRST[ibucket] = ientry ;
+  SIMLIB_CACHE.ICURRENT       = ientry ;
+  SIMLIB_CACHE.NENTRY++ ;
+  SIMLIB_CACHE.MEMTOT += MEM ;
+
+  return ;
+
+} // end store_SIMLIB_CACHE
+
+// =========================================
+int get_IFIELD_SIMLIB_CACHE(int OBSRAW, char *FIELD) {
+
+  // Created Oct 16 2026
+  // Return template IFIELD_OVP_SIMLIB(1,FIELD) for OBSRAW,
+  // using SIMLIB_CACHE to avoid string compares for re-used LIBID.
+
+  int ientry = SIMLIB_CACHE.ICURRENT ;
+  int IFIELD ;
+  // ---------------- BEGIN -------------
+
+  if ( ientry < 0 ) { return IFIELD_OVP_SIMLIB(1,FIELD); }
+
+  IFIELD = SIMLIB_CACHE.ENTRY[ientry].IFIELD[OBSRAW] ;
+  if ( IFIELD == -99 ) {
+    IFIELD = IFIELD_OVP_SIMLIB(1,FIELD);
+    SIMLIB_CACHE.ENTRY[ientry].IFIELD[OBSRAW] = IFIELD ;
+  }
+  return IFIELD ;
+
+} // end get_IFIELD_SIMLIB_CACHE
+
+// =========================================
+void summary_SIMLIB_CACHE(void) {
+
+  // Created Oct 16 2026
+  long long NTOT = SIMLIB_CACHE.NHIT + SIMLIB_CACHE.NMISS ;
+  // ---------------- BEGIN -------------
+
+  if ( NTOT == 0 ) { return; }
+
+  printf("\t SIMLIB_CACHE: %d LIBIDs (%.1f MB), hit rate = %.3f "
+	 "(%lld of %lld) \n",
+	 SIMLIB_CACHE.NENTRY, (double)SIMLIB_CACHE.MEMTOT/1.0E6,
+	 (double)SIMLIB_CACHE.NHIT/(double)NTOT, SIMLIB_CACHE.NHIT, NTOT);
+  if ( SIMLIB_CACHE.NFULL > 0 ) {
+    printf("\t SIMLIB_CACHE: %lld cadences not stored; "
+	   "increase SIMLIB_CACHE_MXMB=%d \n",
+	   SIMLIB_CACHE.NFULL, INPUTS.SIMLIB_CACHE_MXMB );
+  }
+  fflush(stdout);
+
+} // end summary_SIMLIB_CACHE
+
+
 // ==============================================
 void SIMLIB_prepMJD_forSORT(int ISTORE) {
 
@@ -18318,6 +19635,25 @@ void SIMLIB_sortbyMJD(void) {
 
   // ------------- BEGIN --------------
 
+  // Oct 2026: for binary SIMLIB, use stored sort if this cadence 
+  // has exactly the 'S:' lines of one LIBID, and nothing added.
+  if ( SIMLIB_BINARY.USE && NOBS_APPEND == 0 && NOBS_RAW > 0 &&
+       NOBS_RAW == SIMLIB_OBS_RAW.NOBS_READ && 
+       SIMLIB_OBS_RAW.NOBS_SPECTROGRAPH == 0 ) {
+    long long IOBS0 = SIMLIB_BINARY.IOBS_RAW[0] ;
+    int  ilib   = ilib_SIMLIB_BINARY(IOBS0);
+    bool SORTED = ( ilib >= 0 && SIMLIB_BINARY.LIB[ilib].SORTED &&
+		    SIMLIB_BINARY.LIB[ilib].IOBS == IOBS0 &&
+		    SIMLIB_BINARY.LIB[ilib].NOBS == NOBS_RAW );
+    for(isort=1; isort < NOBS_RAW && SORTED; isort++ ) 
+      { SORTED = ( SIMLIB_BINARY.IOBS_RAW[isort] == IOBS0 + isort ); }
+    if ( SORTED ) {
+      memcpy(SIMLIB_LIST_forSORT.INDEX_SORT, 
+	     &SIMLIB_BINARY.INDEX_SORT[IOBS0], NOBS_RAW*sizeof(int) );
+      SIMLIB_LIST_forSORT.NMJD = NOBS_RAW ;
+      return ;
+    }
+  }
 
   if ( NOBS_SORT > 0 ) {
     sortDouble( NOBS_SORT, SIMLIB_LIST_forSORT.MJD, ORDER_SORT, 
@@ -21090,6 +22426,312 @@ int gen_cutwin_PEAKMAG(int OPT, int ifilt_obs) {
 
 } // end  gen_cutwin_PEAKMAG
 
+
+// ***********************************************
+void init_EARLY_REJECT(void) {
+
+  // Created Oct 16 2026
+  // Init adaptive early-reject (pre-cuts before GENSPEC & GENFLUX).
+  // Disable if cuts are not applied, or if rejected events need
+  // the full set of CUTWIN variables (SIMGEN_DUMP), or for the
+  // SNRMAX fudge that relies on gen_cutwin for each pass.
+
+  int  NEVT_TRAIN = INPUTS.EARLY_REJECT_NEVT_TRAIN ;
+  int  istage ;
+  char *why = NULL ;
+  char fnam[] = "init_EARLY_REJECT" ;
+
+  // ------------ BEGIN -------------
+
+  EARLY_REJECT.USE        = false ;
+  EARLY_REJECT.TRAINED    = false ;
+  EARLY_REJECT.NEVT_TRAIN = EARLY_REJECT.NEVT_APPLY = 0 ;
+  EARLY_REJECT.T_START_DOWNSTREAM = -1 ;
+  EARLY_REJECT.NEVT_DOWNSTREAM    =  0 ;
+  EARLY_REJECT.TSUM_DOWNSTREAM    = 0.0 ;
+
+  for(istage=0; istage < NSTAGE_EARLY_REJECT; istage++ ) {
+    EARLY_REJECT.ORDER[istage]       = istage ;
+    EARLY_REJECT.APPLY[istage]       = false ;
+    EARLY_REJECT.NEVAL[istage]       = 0 ;
+    EARLY_REJECT.NFAIL_TRAIN[istage] = 0 ;
+    EARLY_REJECT.NREJECT[istage]     = 0 ;
+    EARLY_REJECT.TSUM_TRAIN[istage]  = 0.0 ;
+    EARLY_REJECT.TSUM_APPLY[istage]  = 0.0 ;
+  }
+
+  if ( NEVT_TRAIN <= 0 ) { return; }
+
+  if ( INPUTS.APPLY_CUTWIN_OPT == 0 ) 
+    { why = "APPLY_CUTWIN_OPT=0" ; }
+  else if ( INPUTS.NVAR_SIMGEN_DUMP > 0 )
+    { why = "SIMGEN_DUMP needs all CUTWIN variables" ; }
+  else if ( INPUTS.OPT_FUDGE_SNRMAX > 0 )
+    { why = "FUDGE_SNRMAX" ; }
+  else if ( INPUTS_STRONGLENS.USE_FLAG )
+    { why = "STRONGLENS" ; }
+
+  print_banner(fnam);
+  if ( why != NULL ) {
+    printf("\t Disable EARLY_REJECT_NEVT_TRAIN=%d because of %s\n",
+	   NEVT_TRAIN, why);
+    fflush(stdout);
+    return ;
+  }
+
+  EARLY_REJECT.USE = true ;
+  printf("\t Measure reject rate & CPU for %d pre-cuts using first %d "
+	 "events.\n", NSTAGE_EARLY_REJECT, NEVT_TRAIN);
+  fflush(stdout);
+
+  return ;
+
+} // end init_EARLY_REJECT
+
+
+// ***********************************************
+int apply_EARLY_REJECT(void) {
+
+  // Created Oct 16 2026
+  // Called after GENMAG_CUT and before GENSPEC_DRIVER.
+  // Returns 1 to continue generating this event;
+  // returns 0 to reject event (fails CUTWIN).
+  //
+  // During training, evaluate all pre-cuts without applying them.
+  // After training, apply enabled pre-cuts in order of 
+  // decreasing (reject rate)/(CPU cost).
+
+  int    NEVT_TRAIN = INPUTS.EARLY_REJECT_NEVT_TRAIN ;
+  int    i, istage, PASS ;
+  clock_t t0 ;
+  double  dt ;
+  //  char fnam[] = "apply_EARLY_REJECT" ;
+
+  // ------------ BEGIN -------------
+
+  if ( !EARLY_REJECT.USE ) { return 1; }
+  if ( GENLC.IFLAG_GENSOURCE == IFLAG_GENGRID ) { return 1; }
+
+  // never reject event that will be forced to be accepted 
+  if ( GENLC.NGEN_SIMLIB_ID >= SIMLIB_MXGEN_LIBID ) { return 1; }
+
+  if ( !EARLY_REJECT.TRAINED ) {
+    for(istage=0; istage < NSTAGE_EARLY_REJECT; istage++ ) {
+      t0   = clock();
+      PASS = precut_EARLY_REJECT(istage);
+      dt   = (double)(clock()-t0) / (double)CLOCKS_PER_SEC ;
+      EARLY_REJECT.TSUM_TRAIN[istage] += dt ;
+      if ( !PASS ) { EARLY_REJECT.NFAIL_TRAIN[istage]++ ; }
+    }
+    EARLY_REJECT.NEVT_TRAIN++ ;
+    if ( EARLY_REJECT.NEVT_TRAIN >= NEVT_TRAIN ) { order_EARLY_REJECT(); }
+    timer_EARLY_REJECT(1);
+    return 1;
+  }
+
+  for(i=0; i < NSTAGE_EARLY_REJECT; i++ ) {
+    istage = EARLY_REJECT.ORDER[i];
+    if ( !EARLY_REJECT.APPLY[istage] ) { continue; }
+    t0   = clock();
+    PASS = precut_EARLY_REJECT(istage);
+    dt   = (double)(clock()-t0) / (double)CLOCKS_PER_SEC ;
+    EARLY_REJECT.TSUM_APPLY[istage] += dt ;
+    EARLY_REJECT.NEVAL[istage]++ ;
+    if ( !PASS ) { EARLY_REJECT.NREJECT[istage]++ ;  return 0; }
+  }
+
+  EARLY_REJECT.NEVT_APPLY++ ;
+  timer_EARLY_REJECT(1);
+  return 1;
+
+} // end apply_EARLY_REJECT
+
+
+// ***********************************************
+int precut_EARLY_REJECT(int istage) {
+
+  // Created Oct 16 2026
+  // Return 1 if event passes pre-cut istage; 0 if it fails.
+  // Each pre-cut uses only quantities known after GENMAG_DRIVER, and
+  // failing a pre-cut guarantees that gen_cutwin fails the 
+  // corresponding CUTBIT:
+  //   REDSHIFT: true zCMB and host zPHOT (zFINAL can be changed by
+  //             setz_unconfirmed after the trigger, so it is skipped)
+  //   MWEBV:    same cut as gen_cutwin
+  //   PEAKMAG:  same cut as gen_cutwin (via gen_cutwin_PEAKMAG)
+  //   TREST:    require an epoch in TRESTMIN and TRESTMAX windows, 
+  //             ignoring LAMREST and SNR cuts that only remove epochs.
+
+  int    ep, ifilt, ifilt_obs, NPASS, NFAIL ;
+  double Trest, z ;
+  bool   FOUND_TMIN, FOUND_TMAX ;
+  char   fnam[] = "precut_EARLY_REJECT" ;
+
+  // ------------ BEGIN -------------
+
+  if ( istage == ISTAGE_EARLY_REJECT_REDSHIFT ) {
+    z = GENLC.REDSHIFT_CMB ;
+    if ( z < INPUTS.CUTWIN_REDSHIFT_TRUE[0] ) { return 0; }
+    if ( z > INPUTS.CUTWIN_REDSHIFT_TRUE[1] ) { return 0; }
+    if ( INPUTS.HOSTLIB_USE ) {
+      z = SNHOSTGAL.ZPHOT ;
+      if ( z < INPUTS.CUTWIN_HOST_ZPHOT[0] ) { return 0; }
+      if ( z > INPUTS.CUTWIN_HOST_ZPHOT[1] ) { return 0; }
+    }
+    return 1;
+  }
+  else if ( istage == ISTAGE_EARLY_REJECT_MWEBV ) {
+    if ( GENLC.MWEBV > INPUTS.CUTWIN_MWEBV[1] ) { return 0; }
+    if ( GENLC.MWEBV < INPUTS.CUTWIN_MWEBV[0] ) { return 0; }
+    return 1;
+  }
+  else if ( istage == ISTAGE_EARLY_REJECT_PEAKMAG ) {
+    NPASS = NFAIL = 0 ;
+    for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {      
+      ifilt_obs = GENLC.IFILTMAP_OBS[ifilt];    
+      if ( gen_cutwin_PEAKMAG(1,ifilt_obs) == SUCCESS ) { NPASS++; } 
+      if ( gen_cutwin_PEAKMAG(2,ifilt_obs) != SUCCESS ) { NFAIL++; } 
+    }
+    return ( NPASS > 0 && NFAIL == 0 ) ;
+  }
+  else if ( istage == ISTAGE_EARLY_REJECT_TREST ) {
+    FOUND_TMIN = FOUND_TMAX = false ;
+    for ( ep = 1; ep <= GENLC.NEPOCH ; ep++ ) {
+      if ( !GENLC.OBSFLAG_GEN[ep] ) { continue ; }
+      Trest = GENLC.epoch_rest[ep] ;
+      if ( Trest < INPUTS.CUTWIN_TRESTMIN[0] ) { continue ; }
+      if ( Trest > INPUTS.CUTWIN_TRESTMAX[1] ) { continue ; }
+      if ( Trest <= INPUTS.CUTWIN_TRESTMIN[1] ) { FOUND_TMIN = true; }
+      if ( Trest >= INPUTS.CUTWIN_TRESTMAX[0] ) { FOUND_TMAX = true; }
+      if ( FOUND_TMIN && FOUND_TMAX ) { return 1; }
+    }
+    return 0 ;
+  }
+  else {
+    sprintf(c1err,"Invalid istage=%d", istage);
+    sprintf(c2err,"Valid istage is 0 to %d", NSTAGE_EARLY_REJECT-1);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  return 1;
+
+} // end precut_EARLY_REJECT
+
+
+// ***********************************************
+void order_EARLY_REJECT(void) {
+
+  // Created Oct 16 2026
+  // After training, order pre-cuts by decreasing (reject rate)/(cost),
+  // and enable pre-cuts for which expected CPU saved per event,
+  // FRAC_REJECT * T_DOWNSTREAM, exceeds the pre-cut cost.
+
+  int    NEVT  = EARLY_REJECT.NEVT_TRAIN ;
+  int    NDOWN = EARLY_REJECT.NEVT_DOWNSTREAM ;
+  int    i, istage, ORDER_SORT = -1 ;
+  int    INDEX_SORT[NSTAGE_EARLY_REJECT] ;
+  double SCORE[NSTAGE_EARLY_REJECT], FRAC, COST, T_DOWN = 0.0 ;
+  char   fnam[] = "order_EARLY_REJECT" ;
+
+  // ------------ BEGIN -------------
+
+  EARLY_REJECT.TRAINED = true ;
+  if ( NDOWN > 0 ) { T_DOWN = EARLY_REJECT.TSUM_DOWNSTREAM/(double)NDOWN; }
+
+  for(istage=0; istage < NSTAGE_EARLY_REJECT; istage++ ) {
+    FRAC  = (double)EARLY_REJECT.NFAIL_TRAIN[istage] / (double)NEVT ;
+    COST  = EARLY_REJECT.TSUM_TRAIN[istage] / (double)NEVT ;
+    COST += 1.0E-9 ; // avoid divide-by-zero for clock resolution
+    SCORE[istage] = FRAC / COST ;
+    EARLY_REJECT.APPLY[istage] = ( FRAC > 0.0 && FRAC*T_DOWN > COST ) ;
+  }
+
+  sortDouble(NSTAGE_EARLY_REJECT, SCORE, ORDER_SORT, INDEX_SORT);
+
+  print_banner(fnam);
+  printf("\t Downstream CPU (GENSPEC -> CUTWIN): %.1f usec/event \n",
+	 1.0E6*T_DOWN );
+  for(i=0; i < NSTAGE_EARLY_REJECT; i++ ) {
+    istage = INDEX_SORT[i] ;
+    EARLY_REJECT.ORDER[i] = istage ;
+    printf("\t %-10s: reject frac=%.4f  cost=%7.2f usec  APPLY=%d \n",
+	   STAGENAME_EARLY_REJECT[istage],
+	   (double)EARLY_REJECT.NFAIL_TRAIN[istage]/(double)NEVT,
+	   1.0E6*EARLY_REJECT.TSUM_TRAIN[istage]/(double)NEVT,
+	   EARLY_REJECT.APPLY[istage] );
+  }
+  fflush(stdout);
+
+  return ;
+
+} // end order_EARLY_REJECT
+
+
+// ***********************************************
+void timer_EARLY_REJECT(int flag) {
+
+  // Created Oct 16 2026
+  // flag=1 -> start CPU timer for GENSPEC -> gen_cutwin
+  // flag=2 -> stop timer (if running) and increment sum
+
+  // ------------ BEGIN -------------
+
+  if ( !EARLY_REJECT.USE ) { return; }
+
+  if ( flag == 1 ) {
+    EARLY_REJECT.T_START_DOWNSTREAM = clock();
+  }
+  else if ( EARLY_REJECT.T_START_DOWNSTREAM >= 0 ) {
+    EARLY_REJECT.TSUM_DOWNSTREAM += 
+      (double)(clock()-EARLY_REJECT.T_START_DOWNSTREAM) / 
+      (double)CLOCKS_PER_SEC ;
+    EARLY_REJECT.NEVT_DOWNSTREAM++ ;
+    EARLY_REJECT.T_START_DOWNSTREAM = -1 ;
+  }
+
+  return ;
+
+} // end timer_EARLY_REJECT
+
+
+// ***********************************************
+void summary_EARLY_REJECT(void) {
+
+  // Created Oct 16 2026
+  // Print number of events rejected by each pre-cut, and estimated 
+  // CPU saved = NREJECT * <downstream CPU> - (CPU for pre-cut).
+
+  int    NDOWN = EARLY_REJECT.NEVT_DOWNSTREAM ;
+  int    i, istage ;
+  double T_DOWN, T_SAVE, T_SAVE_TOT = 0.0 ;
+
+  // ------------ BEGIN -------------
+
+  if ( !EARLY_REJECT.TRAINED || NDOWN == 0 ) { return; }
+
+  T_DOWN = EARLY_REJECT.TSUM_DOWNSTREAM / (double)NDOWN ;
+
+  printf("\t EARLY_REJECT: downstream CPU = %.1f usec/event \n", 
+	 1.0E6*T_DOWN);
+  for(i=0; i < NSTAGE_EARLY_REJECT; i++ ) {
+    istage = EARLY_REJECT.ORDER[i] ;
+    if ( !EARLY_REJECT.APPLY[istage] ) { continue; }
+    T_SAVE = (double)EARLY_REJECT.NREJECT[istage] * T_DOWN - 
+      EARLY_REJECT.TSUM_APPLY[istage] ;
+    T_SAVE_TOT += T_SAVE ;
+    printf("\t EARLY_REJECT %-10s: NREJECT=%d of %d  "
+	   "CPU saved = %.2f sec \n",
+	   STAGENAME_EARLY_REJECT[istage], 
+	   EARLY_REJECT.NREJECT[istage], EARLY_REJECT.NEVAL[istage],
+	   T_SAVE );
+  }
+  printf("\t EARLY_REJECT total CPU saved = %.2f sec \n", T_SAVE_TOT);
+  fflush(stdout);
+
+  return ;
+
+} // end summary_EARLY_REJECT
+
 // ******************************************
 void  LOAD_SEARCHEFF_DATA(void) {
 
@@ -23905,10 +25547,14 @@ void GENFLUX_DRIVER(void) {
   // Dec 2019: begin refactor to allow off-diagonal covariances;
   //           e.g., correlations for anomalous host noise.
   //
+  // Oct 16 2026: compute noise for all epochs with gen_fluxNoise_calc_batch;
+  //    DEBUG_FLAG = DEBUG_FLAG_FLUXNOISE_EPOCH -> legacy per-epoch calc.
+  //
 
   int NEPOCH = GENLC.NEPOCH ;
   int MEM    = (NEPOCH+1)*sizeof(FLUXNOISE_DEF);
-  int epoch, icov;
+  bool USE_BATCH = ( INPUTS.DEBUG_FLAG != DEBUG_FLAG_FLUXNOISE_EPOCH );
+  int epoch, icov, NOBS = 0 ;
   int VBOSE_CALC  = 0 ; 
   int VBOSE_FUDGE = 0 ;
   int VBOSE_APPLY = 0 ;
@@ -23929,6 +25575,9 @@ void GENFLUX_DRIVER(void) {
   for(icov=0; icov < NREDCOV_FLUXERRMODEL; icov++ )
     { COVINFO_FLUXERRMODEL[icov].NOBS = 0 ; }
 
+  if ( USE_BATCH && FLUXNOISE_BATCH.MXOBS < NEPOCH ) 
+    { malloc_FLUXNOISE_BATCH(NEPOCH); }
+
   for ( epoch = 1; epoch <= GENLC.NEPOCH; epoch++ ) {
 
     GENLC.flux[epoch]         = NULLFLOAT ; 
@@ -23936,7 +25585,18 @@ void GENFLUX_DRIVER(void) {
     GENLC.FLUXNOISE[epoch].IFILT_OBS = -888 ;
 
     if ( !GENLC.OBSFLAG_GEN[epoch]  )  { continue ; }
-    gen_fluxNoise_calc(epoch,VBOSE_CALC, &GENLC.FLUXNOISE[epoch]);
+    if ( USE_BATCH ) { FLUXNOISE_BATCH.EPOCH[NOBS++] = epoch; }
+  }
+
+  // compute noise for all generated epochs at once
+  if ( USE_BATCH ) 
+    { gen_fluxNoise_calc_batch(NOBS, FLUXNOISE_BATCH.EPOCH, GENLC.FLUXNOISE); }
+
+  for ( epoch = 1; epoch <= GENLC.NEPOCH; epoch++ ) {
+
+    if ( !GENLC.OBSFLAG_GEN[epoch]  )  { continue ; }
+    if ( !USE_BATCH ) 
+      { gen_fluxNoise_calc(epoch,VBOSE_CALC, &GENLC.FLUXNOISE[epoch]); }
 
     // check noise fudge-options; diagonal COV only
     gen_fluxNoise_fudge_diag(epoch, VBOSE_FUDGE, &GENLC.FLUXNOISE[epoch]);
@@ -23983,15 +25643,34 @@ void gen_fluxNoise_randoms(void) {
   //
   // Feb 14 2018: set GENLC.RANGauss_NOISE_ZP[ep] 
   //
+  // Oct 16 2026: count randoms first, then draw them all with one call
+  //    to getRan_GaussList; same random sequence as before.
+  //
 
+  static int     MXRAN   = 0 ;
+  static double *RANLIST = NULL ;
   double RAN1, RAN2;
-  int ep, ifilt, ifilt_obs, ifield;
+  int ep, ifilt, ifilt_obs, ifield, NRAN=0, iran=0 ;
   //  char fnam[] = "gen_fluxNoise_randoms" ;
 
   // -------------- BEGIN --------------
 
   if ( GENLC.IFLAG_GENSOURCE == IFLAG_GENGRID  ) { return ; }
 
+  // count randoms: 2 per used epoch + MXFIELD_OVP per used filter
+  for ( ep = 1; ep <= GENLC.NEPOCH; ep++ )  
+    { if ( GENLC.OBSFLAG_GEN[ep] ) { NRAN += 2; }  }
+  for ( ifilt=0; ifilt < GENLC.NFILTDEF_SIMLIB; ifilt++ ) {
+    ifilt_obs =  GENLC.IFILTMAP_SIMLIB[ifilt] ;
+    if ( GENLC.DOFILT[ifilt_obs] ) { NRAN += MXFIELD_OVP; }
+  }
+
+  if ( NRAN > MXRAN ) {
+    MXRAN   = NRAN + 100 ;
+    RANLIST = (double*) realloc(RANLIST, MXRAN*sizeof(double) );
+  }
+  getRan_GaussList(1, NRAN, RANLIST);
+
   // one random per epoch
   for ( ep = 1; ep <= GENLC.NEPOCH; ep++ )  {  
 
@@ -24005,8 +25684,8 @@ void gen_fluxNoise_randoms(void) {
     if ( !GENLC.OBSFLAG_GEN[ep]  ) { continue ; }
 
     // load randoms into global
-    RAN1 = getRan_Gauss(1) ;  
-    RAN2 = getRan_Gauss(1) ;  
+    RAN1 = RANLIST[iran++] ;  
+    RAN2 = RANLIST[iran++] ;  
     GENLC.RANGauss_NOISE_SEARCH[ep] = RAN1;
     GENLC.RANGauss_NOISE_ZP[ep]     = RAN2; // Jan 2020; soon to be obsolete
     GENLC.RANGauss_NOISE_FUDGE[ep]  = RAN2; // for refactored GENFLUX_DRIVER
@@ -24026,7 +25705,7 @@ void gen_fluxNoise_randoms(void) {
     if ( GENLC.DOFILT[ifilt_obs] == 0 ) { continue ; }
    
     for(ifield=0; ifield < MXFIELD_OVP; ifield++ ) {      
-      GENLC.RANGauss_NOISE_TEMPLATE[ifield][ifilt_obs] = getRan_Gauss(1) ; 
+      GENLC.RANGauss_NOISE_TEMPLATE[ifield][ifilt_obs] = RANLIST[iran++] ; 
     } 
     
   }
@@ -24268,6 +25947,266 @@ void gen_fluxNoise_calc(int epoch, int vbose, FLUXNOISE_DEF *FLUXNOISE) {
 
 } // end gen_fluxNoise_calc
 
+// *************************************
+void malloc_FLUXNOISE_BATCH(int MXOBS) {
+
+  // Created Oct 16 2026
+  // (re)allocate contiguous work arrays for gen_fluxNoise_calc_batch.
+
+  int MEMI = MXOBS * sizeof(int);
+  int MEMD = MXOBS * sizeof(double);
+  FLUXNOISE_BATCH_DEF *B = &FLUXNOISE_BATCH ;
+
+  // ----------- BEGIN ------------
+
+  B->MXOBS = MXOBS ;
+  B->EPOCH              = (int   *) realloc(B->EPOCH,     MEMI);
+  B->IFILT_OBS          = (int   *) realloc(B->IFILT_OBS, MEMI);
+
+  B->ZPT                = (double*) realloc(B->ZPT,        MEMD);
+  B->ZPTERR             = (double*) realloc(B->ZPTERR,     MEMD);
+  B->CCDGAIN            = (double*) realloc(B->CCDGAIN,    MEMD);
+  B->SKYSIG             = (double*) realloc(B->SKYSIG,     MEMD);
+  B->READNOISE          = (double*) realloc(B->READNOISE,  MEMD);
+  B->NEA                = (double*) realloc(B->NEA,        MEMD);
+  B->PIXSIZE            = (double*) realloc(B->PIXSIZE,    MEMD);
+  B->TEMPLATE_SKYSIG    = (double*) realloc(B->TEMPLATE_SKYSIG,    MEMD);
+  B->TEMPLATE_READNOISE = (double*) realloc(B->TEMPLATE_READNOISE, MEMD);
+  B->TEMPLATE_ZPT       = (double*) realloc(B->TEMPLATE_ZPT,       MEMD);
+  B->GENMAG             = (double*) realloc(B->GENMAG,     MEMD);
+  B->GENMAG_T           = (double*) realloc(B->GENMAG_T,   MEMD);
+
+  B->NADU_over_FLUXCAL  = (double*) realloc(B->NADU_over_FLUXCAL, MEMD);
+  B->FLUXSN_PE          = (double*) realloc(B->FLUXSN_PE,      MEMD);
+  B->FLUX_T             = (double*) realloc(B->FLUX_T,         MEMD);
+  B->FLUXMON_PE         = (double*) realloc(B->FLUXMON_PE,     MEMD);
+  B->SQERR_SKY          = (double*) realloc(B->SQERR_SKY,      MEMD);
+  B->SQERR_CCD          = (double*) realloc(B->SQERR_CCD,      MEMD);
+  B->TEMPLATE_SQERR     = (double*) realloc(B->TEMPLATE_SQERR, MEMD);
+  B->FLUXGAL_PE         = (double*) realloc(B->FLUXGAL_PE,     MEMD);
+  B->GALMAG             = (double*) realloc(B->GALMAG,         MEMD);
+  B->SQERR_ZP           = (double*) realloc(B->SQERR_ZP,       MEMD);
+
+  return ;
+
+} // end malloc_FLUXNOISE_BATCH
+
+// *************************************
+void gen_fluxNoise_calc_batch(int NOBS, int *EPLIST, 
+			      FLUXNOISE_DEF *FLUXNOISE) {
+
+  // Created Oct 16 2026
+  // Batch version of gen_fluxNoise_calc for the NOBS epochs in EPLIST.
+  // Observing conditions are gathered into contiguous arrays
+  // (FLUXNOISE_BATCH), and each noise term is computed for all 
+  // epochs in a simple loop without per-epoch option checks.
+  // Arithmetic is identical to gen_fluxNoise_calc so that output
+  // is identical; see test_fluxNoise_batch in sim_unit_tests.c.
+  // Results are stored in FLUXNOISE[epoch].
+
+  FLUXNOISE_BATCH_DEF *B = &FLUXNOISE_BATCH ;
+  bool   DO_MON      = ( INPUTS.MAGMONITOR_SNR > 10 );
+  bool   DO_ZP       = ( INPUTS.SMEARFLAG_ZEROPT > 0 );
+  bool   DO_ZP_TRUE  = ( (INPUTS.SMEARFLAG_ZEROPT & 1) > 0 );
+  bool   DO_ZP_DATA  = ( (INPUTS.SMEARFLAG_ZEROPT & 2) > 0 );
+  int    OVP_GAL     = INPUTS.SMEARFLAG_HOSTGAL & SMEARMASK_HOSTGAL_PHOT ;
+  double magmon      = (double)INPUTS.MAGMONITOR_SNR ;
+
+  int    o, ep, ifilt_obs, NERR, itype ;
+  double arg, NADU_over_FLUXCAL, Npe_over_FLUXCAL ;
+  double NADU_over_Npe, skysig_tmp_pe, area_bg, psfsig_arcsec ;
+  double sqsig_noZ, sqsig_true, sqsig_data, sqsig_mon, SNR_MON ;
+  double fluxsn_pe, template_sqerr_pe ;
+  FLUXNOISE_DEF *FN ;
+  char fnam[] = "gen_fluxNoise_calc_batch" ;
+
+  // ------------- BEGIN ---------------
+
+  if ( GENLC.IFLAG_GENSOURCE == IFLAG_GENGRID  ) { return ; }
+
+  B->NOBS = NOBS ;
+
+  // gather inputs and check observing conditions
+  for(o=0; o < NOBS; o++ ) {
+    ep        = EPLIST[o];
+    ifilt_obs = GENLC.IFILT_OBS[ep] ;
+    B->IFILT_OBS[o]          = ifilt_obs ;
+    B->ZPT[o]                = SIMLIB_OBS_GEN.ZPTADU[ep] ;
+    B->ZPTERR[o]             = SIMLIB_OBS_GEN.ZPTERR[ep] ;
+    B->CCDGAIN[o]            = SIMLIB_OBS_GEN.CCDGAIN[ep] ;
+    B->SKYSIG[o]             = SIMLIB_OBS_GEN.SKYSIG[ep] ;
+    B->READNOISE[o]          = SIMLIB_OBS_GEN.READNOISE[ep] ;
+    B->NEA[o]                = SIMLIB_OBS_GEN.NEA[ep] ;
+    B->PIXSIZE[o]            = SIMLIB_OBS_GEN.PIXSIZE[ep] ;
+    B->TEMPLATE_SKYSIG[o]    = SIMLIB_OBS_GEN.TEMPLATE_SKYSIG[ep] ;
+    B->TEMPLATE_READNOISE[o] = SIMLIB_OBS_GEN.TEMPLATE_READNOISE[ep] ;
+    B->TEMPLATE_ZPT[o]       = SIMLIB_OBS_GEN.TEMPLATE_ZPT[ep] ;
+    B->GENMAG[o]             = GENLC.genmag_obs[ep] ;
+    B->GENMAG_T[o]           = GENLC.genmag_obs_template[ifilt_obs] ;
+
+    NERR = 0 ;
+    if ( B->ZPT[o] < 10.0   )                   { NERR++ ; }
+    if ( SIMLIB_OBS_GEN.PSFSIG1[ep] < 0.0001 )  { NERR++ ; }
+    if ( B->SKYSIG[o]  < 0.0001 )               { NERR++ ; } 
+    if ( NERR > 0 ) {
+      sprintf(c1err,"%d invalid observing conditions for ep=%d, band=%c",
+	      NERR, ep, FILTERSTRING[ifilt_obs] );
+      sprintf(c2err,"mjd=%.3f zpt=%.2f, psf=%.3f, skysig=%.2f", 
+	      SIMLIB_OBS_GEN.MJD[ep], B->ZPT[o], 
+	      SIMLIB_OBS_GEN.PSFSIG1[ep], B->SKYSIG[o] );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+    }
+
+    if ( SIMLIB_TEMPLATE.USEFLAG && B->TEMPLATE_SKYSIG[o] > 0.0 &&
+	 B->TEMPLATE_ZPT[o] < 10.0 ) {
+      sprintf(c1err,"Invalid template_zpt(%c)=%f for  LIBID=%d at MJD=%.3f", 
+	      FILTERSTRING[ifilt_obs], B->TEMPLATE_ZPT[o], GENLC.SIMLIB_ID, 
+	      SIMLIB_OBS_GEN.MJD[ep] );
+      sprintf(c2err,"Need TEMPLATE_ZPT to scale template noise.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ; 
+    }
+  }
+
+  // zero point and source flux (p.e.)
+  for(o=0; o < NOBS; o++ ) {
+    B->NADU_over_FLUXCAL[o] = 
+      pow( TEN , 0.4*(B->ZPT[o] - ZEROPOINT_FLUXCAL_DEFAULT) ) ;
+    B->FLUXSN_PE[o] = pow(10.0, 0.4*(B->ZPT[o] - B->GENMAG[o]) ) 
+      * B->CCDGAIN[o] ;
+  }
+
+  // optional template flux (LCLIB) and monitor flux
+  for(o=0; o < NOBS; o++ ) {
+    B->FLUX_T[o] = 0.0 ;
+    if ( B->GENMAG_T[o] < 90.0 ) {
+      NADU_over_FLUXCAL = B->NADU_over_FLUXCAL[o];
+      Npe_over_FLUXCAL  = NADU_over_FLUXCAL * B->CCDGAIN[o] ;
+      NADU_over_Npe     = NADU_over_FLUXCAL/Npe_over_FLUXCAL ;  
+      arg               = 0.4 * ( B->ZPT[o] - B->GENMAG_T[o] );
+      B->FLUX_T[o]      = pow(10.0,arg) / NADU_over_Npe ; 
+    }
+    B->FLUXMON_PE[o] = 0.0 ;
+    if ( DO_MON ) {
+      arg              = 0.4 * ( B->ZPT[o] - magmon );
+      B->FLUXMON_PE[o] = B->CCDGAIN[o] * pow(10.0,arg); 
+    }
+  }
+
+  // sky and CCD noise from search and template images
+  for(o=0; o < NOBS; o++ ) {
+    area_bg          = B->NEA[o] ;
+    skysig_tmp_pe    = B->SKYSIG[o] * B->CCDGAIN[o] ;
+    B->SQERR_SKY[o]  = area_bg * (skysig_tmp_pe*skysig_tmp_pe);
+    B->SQERR_CCD[o]  = area_bg * (B->READNOISE[o]*B->READNOISE[o]) ;
+  }
+
+  for(o=0; o < NOBS; o++ ) {
+    B->TEMPLATE_SQERR[o] = 0.0 ;
+    if ( SIMLIB_TEMPLATE.USEFLAG && B->TEMPLATE_SKYSIG[o] > 0.0 ) {
+      double sqerr_sky, sqerr_ccd, zfac ;
+      area_bg       = B->NEA[o] ;
+      skysig_tmp_pe = B->TEMPLATE_SKYSIG[o] * B->CCDGAIN[o] ;
+      sqerr_sky     = area_bg * (skysig_tmp_pe*skysig_tmp_pe) ;
+      sqerr_ccd     = area_bg * 
+	(B->TEMPLATE_READNOISE[o]*B->TEMPLATE_READNOISE[o]);
+      zfac          = pow(TEN, 0.8*(B->ZPT[o] - B->TEMPLATE_ZPT[o]) );
+      sqerr_sky    *= zfac ;
+      sqerr_ccd    *= zfac ;
+      B->TEMPLATE_SQERR[o] = sqerr_sky + sqerr_ccd ;
+    }
+  }
+
+  // galaxy noise from photo-stats
+  for(o=0; o < NOBS; o++ ) {
+    B->FLUXGAL_PE[o] = B->GALMAG[o] = 0.0 ;
+    if ( OVP_GAL > 0 ) {
+      psfsig_arcsec    = B->PIXSIZE[o] * sqrt(B->NEA[o]/(2.0*TWOPI))  ; 
+      B->GALMAG[o]     = interp_GALMAG_HOSTLIB(B->IFILT_OBS[o], 
+					       psfsig_arcsec );
+      arg              = 0.4 * ( B->ZPT[o] - B->GALMAG[o] );
+      B->FLUXGAL_PE[o] = B->CCDGAIN[o] * pow(10.0,arg);
+    }
+  }
+
+  // optional ZP smearing
+  for(o=0; o < NOBS; o++ ) {
+    B->SQERR_ZP[o] = 0.0 ;
+    if ( DO_ZP ) {
+      double relerr, err;
+      relerr  = pow(TEN, 0.4*B->ZPTERR[o]) - 1.0 ;
+      err     = (B->FLUXSN_PE[o]-B->FLUX_T[o]) * relerr ;    
+      B->SQERR_ZP[o] = err*err;
+    }
+  }
+
+  // - - - - - - - - - - - - - - -   
+  // sum in quadrature and load output structure for each epoch
+  for(o=0; o < NOBS; o++ ) {
+    ep   = EPLIST[o];
+    FN   = &FLUXNOISE[ep] ;
+
+    NADU_over_FLUXCAL = B->NADU_over_FLUXCAL[o];
+    Npe_over_FLUXCAL  = NADU_over_FLUXCAL * B->CCDGAIN[o] ;
+    NADU_over_Npe     = NADU_over_FLUXCAL/Npe_over_FLUXCAL ;  
+    fluxsn_pe         = B->FLUXSN_PE[o];
+    template_sqerr_pe = B->TEMPLATE_SQERR[o];
+
+    sqsig_noZ = fluxsn_pe + B->FLUXGAL_PE[o] + B->SQERR_SKY[o] + 
+      B->SQERR_CCD[o] ;
+    sqsig_true = sqsig_noZ ;
+    sqsig_data = sqsig_noZ ;
+    if ( DO_ZP_TRUE ) { sqsig_true += B->SQERR_ZP[o]; }
+    if ( DO_ZP_DATA ) { sqsig_data += B->SQERR_ZP[o]; }
+
+    SNR_MON = 0.0 ;
+    if ( DO_MON ) {
+      sqsig_mon = (sqsig_data - fluxsn_pe + B->FLUXMON_PE[o] + 
+		   template_sqerr_pe);
+      SNR_MON = B->FLUXMON_PE[o] / sqrt(sqsig_mon);
+    }
+
+    FN->SQSIG_SRC       = fluxsn_pe ;
+    FN->SQSIG_TSRC      = B->FLUX_T[o] ;
+    FN->SQSIG_SKY       = B->SQERR_SKY[o] + B->SQERR_CCD[o] ;
+    FN->SQSIG_TSKY      = template_sqerr_pe ;
+    FN->SQSIG_ZP        = B->SQERR_ZP[o] ;  
+    FN->SQSIG_HOST_PHOT = B->FLUXGAL_PE[o] ;
+
+    FN->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_S]    = sqsig_noZ ;
+    FN->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_SZ]   = sqsig_true ;
+    FN->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_T]    = template_sqerr_pe;
+    FN->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_Z]    = B->SQERR_ZP[o];
+    FN->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_F]    = 0.0 ;
+    FN->SQSIG_CALC_TRUE[TYPE_FLUXNOISE_SUM]  = sqsig_true + template_sqerr_pe;
+
+    for(itype=0; itype < NTYPE_FLUXNOISE ; itype++ )  { 
+      FN->SQSIG_FUDGE_TRUE[itype] = 0.0 ;
+      FN->SQSIG_FINAL_TRUE[itype] = FN->SQSIG_CALC_TRUE[itype]; 
+    }
+
+    FN->SQSIG_CALC_DATA   = sqsig_data + template_sqerr_pe;
+    FN->SQSIG_FUDGE_DATA  = 0.0 ;
+    FN->SQSIG_FINAL_DATA  = sqsig_data + template_sqerr_pe;
+
+    FN->SNR_CALC_S        = fluxsn_pe / sqrt(sqsig_noZ); 
+    FN->SNR_CALC_ST       = fluxsn_pe / sqrt(sqsig_noZ  + template_sqerr_pe);
+    FN->SNR_CALC_SZT      = fluxsn_pe / sqrt(sqsig_data + template_sqerr_pe);
+    FN->SNR_CALC_MON      = SNR_MON  ;
+    FN->SNR_FINAL_MON     = SNR_MON  ;
+
+    FN->NEA               = B->NEA[o] ;
+    FN->GALMAG_NEA        = B->GALMAG[o] ;
+    FN->Npe_over_FLUXCAL  = Npe_over_FLUXCAL;
+    FN->NADU_over_Npe     = NADU_over_Npe ;
+
+    FN->IFILT_OBS = B->IFILT_OBS[o];
+    sprintf(FN->BAND, "%c", FILTERSTRING[B->IFILT_OBS[o]] );
+  }
+
+  return;
+
+} // end gen_fluxNoise_calc_batch
+
 // ********************************************************
 void  gen_fluxNoise_fudge_diag(int epoch, int VBOSE, FLUXNOISE_DEF *FLUXNOISE){
 
@@ -24533,20 +26472,19 @@ void gen_fluxNoise_fudge_cov(int icov) {
   //
   // Beware that epochs in "icov" group are a subset of the
   // GENLC.NEPOCH total epochs, so watch indices.
+  //
+  // Oct 16 2026: 
+  //   Cholesky(COV) = diag(SIG_F) x Cholesky(RHO), and SIG_F cancels
+  //   in GAURAN_F; thus use cached Cholesky factor of correlation
+  //   matrix RHO (get_CHOLESKY_CACHE_FLUXNOISE) instead of building
+  //   and decomposing COV for every event.
 
   int  NOBS = COVINFO_FLUXERRMODEL[icov].NOBS ;
   int  MEMD0 = NOBS*sizeof(double);
-  int  MEMD1 = NOBS*sizeof(double*);
   int  NEPOCH  = GENLC.NEPOCH ;
-  //  int  TYPE_S  = TYPE_FLUXNOISE_S ;  // search noise
-  int  TYPE_F  = TYPE_FLUXNOISE_F ;  // fudge noise
-  //  double COVFAC = 1.0E-3;
-
-  int  ep, iep0, iep1, indx_1D, IFILT_OBS, INDEX_REDCOV ;
-  int  N0=0, N1=0, o, *epMAP ;
-  double *covFlux_1D, **covCholesky_2D ;
-  double SQSIG_FUDGE[2] ;
-  double SIGxSIG, REDCOV, COV ;
+
+  int  ep, iep0, obs0, obs1, INDEX_REDCOV, N0=0, o, k0, *epMAP ;
+  double *L_RHO, *GAURAN_NEW, SUM ;
   int LDMP = 0 ; 
   char fnam[] = "gen_fluxNoise_fudge_cov" ;
 
@@ -24557,134 +26495,178 @@ void gen_fluxNoise_fudge_cov(int icov) {
   if ( LDMP ) 
     { printf("\n xxx ------------- DUMP on for %s --------------- \n", fnam); }
 
-  // create matrix for each cov matrix
+  epMAP      = (int*)    malloc( NOBS * sizeof(int) );
+  GAURAN_NEW = (double*) malloc( MEMD0 );
 
-  covFlux_1D     = (double*)malloc (NOBS*NOBS * sizeof(double) ) ;
-  covCholesky_2D = (double**)malloc(MEMD1) ;
-  for(o=0; o < NOBS; o++ ) { covCholesky_2D[o] = (double*) malloc(MEMD0); }
-
-  epMAP = (int*) malloc( NOBS * sizeof(int) );
-
-  // - - - - - - 
+  // preserve mapping between GENLC and COV arrays
   for(iep0=1; iep0 <= NEPOCH; iep0++ ) {
-
     if ( !GENLC.OBSFLAG_GEN[iep0]  ) { continue ; }
-    IFILT_OBS    = GENLC.IFILT_OBS[iep0] ;
     INDEX_REDCOV = GENLC.FLUXNOISE[iep0].INDEX_REDCOV;
     if ( INDEX_REDCOV != icov ) { continue; }
-    N0++ ;  N1=0;
-
-    epMAP[N0-1] = iep0 ; // preserve mapping between GENLC and COV arrays
-
-    for(iep1=1; iep1 <= iep0; iep1++ ) {
-
-      if ( !GENLC.OBSFLAG_GEN[iep1]  ) { continue ; }
-
-      IFILT_OBS = GENLC.IFILT_OBS[iep1] ;
-      INDEX_REDCOV = GENLC.FLUXNOISE[iep1].INDEX_REDCOV;
-      if ( INDEX_REDCOV != icov ) { continue; }
-      N1++ ;
-
-      REDCOV  = COVINFO_FLUXERRMODEL[INDEX_REDCOV].REDCOV;
-      if ( N0 == N1 ) { REDCOV = 1.0 ; }
-
-      SQSIG_FUDGE[0] = GENLC.FLUXNOISE[iep0].SQSIG_FINAL_TRUE[TYPE_F];
-      SQSIG_FUDGE[1] = GENLC.FLUXNOISE[iep1].SQSIG_FINAL_TRUE[TYPE_F];
-      SIGxSIG  = sqrt(SQSIG_FUDGE[0] * SQSIG_FUDGE[1]) ;
-      COV      = SIGxSIG * REDCOV ;
-            
-      indx_1D = (N1-1)*NOBS + (N0-1) ;
-      covFlux_1D[indx_1D] = COV;
-
-      indx_1D = (N0-1)*NOBS + (N1-1) ;
-      covFlux_1D[indx_1D] = COV;
-
-      if ( LDMP ) {
-	printf(" xxx iep[0,1]=%2d,%2d  N[0,1]=%2d,%2d  indx_1D=%3d  "
-	       "COV=%.1f\n",
-	       iep0, iep1, N0, N1, indx_1D, COV); fflush(stdout);
-	fflush(stdout);
-      }
-
-
-    }  // end iep2
-  }  // end iep
-
+    if ( N0 < NOBS ) { epMAP[N0] = iep0 ; }
+    N0++ ;
+  }
 
   // - - - - - - - - 
   // sanity checks
-  if ( N0 != NOBS || N1 != NOBS ) {
+  if ( N0 != NOBS ) {
     sprintf(c1err,"Invalid %d x %d matrix; expected %d^2 ",
-	    N0, N1, NOBS);
+	    N0, N0, NOBS);
     sprintf(c2err,"CID=%d  NEPOCH=%d  icov=%d(%s)",
 	    GENLC.CID, GENLC.NEPOCH, 
 	    icov, COVINFO_FLUXERRMODEL[icov].BANDSTRING);
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ; 
   }
 
-
-  if(LDMP) { dumpCovMat_fluxNoise(icov, NOBS, covFlux_1D); }
-
   // - - - - - - - - - - - - - - - - - - - - -
-  // do Cholesky decomp ...
-  int obs0, obs1;
-  double *flux_scatter, GAURAN, GAURAN_ORIG, GAURAN_NEW, SIG_F ;
-  gsl_matrix_view chk;
+  // correlated randoms from Cholesky factor of RHO
+  L_RHO = get_CHOLESKY_CACHE_FLUXNOISE(icov, NOBS);
 
-  flux_scatter = (double*) malloc( MEMD0 );
-  chk  = gsl_matrix_view_array ( covFlux_1D, NOBS, NOBS); 
-  gsl_linalg_cholesky_decomp ( &chk.matrix )  ;
-  
   for(obs0=0; obs0 < NOBS; obs0++ ) {  
-    flux_scatter[obs0] = 0.0 ;
-
-    for(obs1=0; obs1 < NOBS; obs1++ ) {
-      covCholesky_2D[obs0][obs1] = 0.0 ;
-      if ( obs0 <= obs1 ) {
-	covCholesky_2D[obs0][obs1] = gsl_matrix_get(&chk.matrix,obs0,obs1); 
-      }
-
-      covCholesky_2D[obs1][obs0] = 0.0 ;
-      if ( obs1 <= obs0 ) {
-	covCholesky_2D[obs1][obs0] = gsl_matrix_get(&chk.matrix,obs1,obs0); 
-      }
-     
-      ep = epMAP[obs1];  GAURAN  = GENLC.RANGauss_NOISE_FUDGE[ep] ; 
-      flux_scatter[obs0] += (GAURAN * covCholesky_2D[obs1][obs0]) ;
+    k0 = obs0*(obs0+1)/2 ;  SUM = 0.0 ;
+    for(obs1=0; obs1 <= obs0; obs1++ ) {
+      ep   = epMAP[obs1];
+      SUM += L_RHO[k0+obs1] * GENLC.RANGauss_NOISE_FUDGE[ep] ;
     }
+    GAURAN_NEW[obs0] = SUM ;
   }
-
   
   // modify independent RANGauss_FUDGE
   for(o=0; o < NOBS; o++ ) {
-    ep             = epMAP[o];
-    SIG_F          = sqrt(GENLC.FLUXNOISE[ep].SQSIG_FINAL_TRUE[TYPE_F]);
-    GAURAN_ORIG    = GENLC.RANGauss_NOISE_FUDGE[ep] ; 
-    GAURAN_NEW     = flux_scatter[o]/SIG_F ;
-    GENLC.RANGauss_NOISE_FUDGE[ep] = GAURAN_NEW ;
+    ep = epMAP[o];
+    if ( LDMP ) {
+      printf(" xxx obs=%3d ep=%3d  GAURAN_F = %7.3f -> %7.3f \n",
+	     o, ep, GENLC.RANGauss_NOISE_FUDGE[ep], GAURAN_NEW[o] );
+      fflush(stdout);
+    }
+    GENLC.RANGauss_NOISE_FUDGE[ep] = GAURAN_NEW[o] ;
   } // end o loop
 
+  free(epMAP);  free(GAURAN_NEW);
 
-  /* xxxxxx
-  for (i = 0 ; i < 3 ; i++) {
-    for (j = 0 ; j < 3 ; j++) {
-      double tmp = INPUTS.COVMAT_CHOLESKY_SCATTER[j][i]; 
-      SCATTER_VALUES[i] += tmp * normalvector[j];      
+  return ;
+
+} // end of  gen_fluxNoise_fudge_cov
+
+
+// ******************************
+double *get_CHOLESKY_CACHE_FLUXNOISE(int icov, int NOBS) {
+
+  // Created Oct 16 2026
+  // Return packed lower-triangle Cholesky factor of NOBS x NOBS 
+  // correlation matrix for REDCOV group icov; 
+  // RHO = 1 on diagonal, RHO = REDCOV off-diagonal.
+  // Factor is computed on first call for (icov,NOBS) and stored.
+  // If memory limit is exceeded (or NOBS is too large), factor
+  // is computed in temp array and not stored.
+
+  double REDCOV  = COVINFO_FLUXERRMODEL[icov].REDCOV ;
+  long long MEMMAX = (long long)MXMB_CHOLESKY_CACHE * 1000000 ;
+  int    NPACK   = NOBS*(NOBS+1)/2 ;
+  int    MEMPACK = NPACK * sizeof(double);
+  bool   STORE ;
+  int    o0, o1, o ;
+  double *RHO_1D, *L ;
+  gsl_matrix_view chk;
+  int LDMP = 0 ;
+  char fnam[] = "get_CHOLESKY_CACHE_FLUXNOISE" ;
+
+  // ---------- BEGIN ----------
+
+  if ( icov >= MXREDCOV_CHOLESKY_CACHE ) {
+    sprintf(c1err,"icov=%d exceeds bound of MXREDCOV_CHOLESKY_CACHE=%d",
+	    icov, MXREDCOV_CHOLESKY_CACHE);
+    sprintf(c2err,"Check NREDCOV_FLUXERRMODEL=%d", NREDCOV_FLUXERRMODEL);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ; 
+  }
+
+  // REDCOV is fixed per icov, but check anyway
+  if ( CHOLESKY_CACHE_FLUXNOISE.L[icov] != NULL &&
+       CHOLESKY_CACHE_FLUXNOISE.REDCOV[icov] != REDCOV ) {
+    for(o=0; o <= MXOBS_CHOLESKY_CACHE; o++ ) {
+      L = CHOLESKY_CACHE_FLUXNOISE.L[icov][o] ;
+      if ( L != NULL ) { 
+	free(L);  CHOLESKY_CACHE_FLUXNOISE.L[icov][o] = NULL ; 
+	CHOLESKY_CACHE_FLUXNOISE.MEMTOT -= (o*(o+1)/2) * sizeof(double);
+      }
     }
   }
-  xxxxxxxxx*/
+  CHOLESKY_CACHE_FLUXNOISE.REDCOV[icov] = REDCOV ;
 
-  // free matrix memory.
-  free(covFlux_1D);
+  if ( NOBS <= MXOBS_CHOLESKY_CACHE ) {
+    if ( CHOLESKY_CACHE_FLUXNOISE.L[icov] == NULL ) {
+      CHOLESKY_CACHE_FLUXNOISE.L[icov] = 
+	(double**) calloc(MXOBS_CHOLESKY_CACHE+1, sizeof(double*) );
+    }
+    L = CHOLESKY_CACHE_FLUXNOISE.L[icov][NOBS] ;
+    if ( L != NULL ) { CHOLESKY_CACHE_FLUXNOISE.NHIT++ ;  return L ; }
+  }
 
-  for(o=0; o < NOBS; o++ ) { free(covCholesky_2D[o]); }
-  free(covCholesky_2D);
+  // - - - - - - -
+  // compute factor
+  CHOLESKY_CACHE_FLUXNOISE.NMISS++ ;
 
-  free(epMAP);  free(flux_scatter);
+  STORE = ( NOBS <= MXOBS_CHOLESKY_CACHE && 
+	    CHOLESKY_CACHE_FLUXNOISE.MEMTOT + MEMPACK <= MEMMAX );
 
-  return ;
+  if ( STORE ) {
+    L = (double*) malloc(MEMPACK);
+    CHOLESKY_CACHE_FLUXNOISE.L[icov][NOBS] = L ;
+    CHOLESKY_CACHE_FLUXNOISE.MEMTOT += MEMPACK ;
+  }
+  else {
+    CHOLESKY_CACHE_FLUXNOISE.NFULL++ ;
+    L = (double*) realloc(CHOLESKY_CACHE_FLUXNOISE.L_TMP, MEMPACK);
+    CHOLESKY_CACHE_FLUXNOISE.L_TMP = L ;
+  }
 
-} // end of  gen_fluxNoise_fudge_cov
+  RHO_1D = (double*) malloc(NOBS*NOBS*sizeof(double));
+  for(o0=0; o0 < NOBS; o0++ ) {
+    for(o1=0; o1 < NOBS; o1++ ) 
+      { RHO_1D[o0*NOBS+o1] = ( o0 == o1 ? 1.0 : REDCOV ) ; }
+  }
+
+  if(LDMP) { dumpCovMat_fluxNoise(icov, NOBS, RHO_1D); }
+
+  chk  = gsl_matrix_view_array ( RHO_1D, NOBS, NOBS); 
+  gsl_linalg_cholesky_decomp ( &chk.matrix )  ;
+
+  // lower triangle contains L
+  for(o0=0; o0 < NOBS; o0++ ) {
+    for(o1=0; o1 <= o0; o1++ ) 
+      { L[o0*(o0+1)/2 + o1] = gsl_matrix_get(&chk.matrix,o0,o1); }
+  }
+
+  free(RHO_1D);
+
+  return L ;
+
+} // end get_CHOLESKY_CACHE_FLUXNOISE
+
+
+// ******************************
+void summary_CHOLESKY_CACHE_FLUXNOISE(void) {
+
+  // Created Oct 16 2026
+  long long NHIT = CHOLESKY_CACHE_FLUXNOISE.NHIT ;
+  long long NTOT = NHIT + CHOLESKY_CACHE_FLUXNOISE.NMISS ;
+  // ---------------- BEGIN -------------
+
+  if ( NTOT == 0 ) { return; }
+
+  printf("\t FLUXERRMODEL Cholesky cache: hit rate = %.3f "
+	 "(%lld of %lld, %.1f MB) \n",
+	 (double)NHIT/(double)NTOT, NHIT, NTOT, 
+	 (double)CHOLESKY_CACHE_FLUXNOISE.MEMTOT/1.0E6 );
+  if ( CHOLESKY_CACHE_FLUXNOISE.NFULL > 0 ) {
+    printf("\t FLUXERRMODEL Cholesky cache: %lld factors not stored "
+	   "(NOBS > %d or > %d MB) \n",
+	   CHOLESKY_CACHE_FLUXNOISE.NFULL, 
+	   MXOBS_CHOLESKY_CACHE, MXMB_CHOLESKY_CACHE );
+  }
+  fflush(stdout);
+
+} // end summary_CHOLESKY_CACHE_FLUXNOISE
 
 // *********************a****************
 void gen_fluxNoise_apply(int epoch, int vbose, FLUXNOISE_DEF *FLUXNOISE) {
@@ -27145,14 +29127,19 @@ void init_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
       errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
     }
 
-    WR_SNFITSIO_INIT(PATH_SNDATA_SIM
-		     , INPUTS.GENVERSION
-		     , INPUTS.GENPREFIX
-		     , INPUTS.WRITE_MASK
-		     , INPUTS.NSUBSAMPLE_MARK
-		     , headFile); // <== return arg for list file
+    // with forked workers, each worker opens its own fits files
+    // and the parent writes them to the LIST file after all workers
+    // are done; see init_simWorker and merge_simWorkers.
+    if ( SIMWORKER.NWORKER <= 1 ) {
+      WR_SNFITSIO_INIT(PATH_SNDATA_SIM
+		       , INPUTS.GENVERSION
+		       , INPUTS.GENPREFIX
+		       , INPUTS.WRITE_MASK
+		       , INPUTS.NSUBSAMPLE_MARK
+		       , headFile); // <== return arg for list file
 
-    fprintf(SIMFILE_AUX->FP_LIST,"%s", headFile);
+      fprintf(SIMFILE_AUX->FP_LIST,"%s", headFile);
+    }
   }
 
   // write filter responses for non-SNANA programs
@@ -27306,7 +29293,7 @@ void end_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
 #endif
 
   fflush(stdout);
-  if ( WRFLAG_FITS) { 
+  if ( WRFLAG_FITS && SIMWORKER.NWORKER <= 1 ) { 
     if ( INPUTS.JOBID > 0 ) { OPTMASK = OPTMASK_SNFITSIO_END_GZIP; }
     WR_SNFITSIO_END(OPTMASK); 
   }
@@ -29076,6 +31063,9 @@ void print_sim_help(void) {
     "",
     "# - - - - - - - - Misc inputs - - - - - - - ",
     "RANSEED:  128473        # random seed",
+    "NTHREAD:  8             # fork 8 workers to generate events",
+    "CBRNG_RAN: 1            # counter-based randoms keyed on event",
+    "SHARED_TABLES: 1        # share SIMSED/kcor tables among jobs on node",
     "DEBUG_FLAG: 0           # use this for development",
     "",
     "#  One-row per SN dump to <GENVERSION>.DUMP",
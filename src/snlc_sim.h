@@ -35,6 +35,14 @@
  Jun 25 2021: MXINPUT_FILE_SIM -> 4 (was 3)
  Jan 28 2022: MXEPSIM -> 15k (was 10k)
 
+ Oct 16 2026: add SIMWORKER struct for NTHREAD (forked workers)
+ Oct 16 2026: add SIMLIB_BINARY struct for pre-parsed binary SIMLIB
+ Oct 16 2026: add SIMLIB_CACHE struct to re-use prepared cadence per LIBID
+ Oct 16 2026: add FLUXNOISE_BATCH struct for batch flux-noise calc
+ Oct 16 2026: add CHOLESKY_CACHE_FLUXNOISE for correlated fudge noise
+ Oct 16 2026: add EARLY_REJECT struct for adaptive pre-cuts before GENFLUX
+ Oct 16 2026: add TIMERS_STAGE for wall time & call count of major drivers
+
 ********************************************/
 
 
@@ -109,6 +117,7 @@
 #define WRMASK_FITS     32   // write to fits file instead of ascii
 #define WRMASK_COMPACT  64   // suppress non-essential PHOT output
 #define WRMASK_FILTERS  256  // write filterTrans files (Aug 2016)
+#define WRMASK_THREAD_FITS 512 // FITS writes on separate I/O thread (Oct 2026)
 
 // xxx #define KEYSOURCE_FILE 1
 // xxx #define KEYSOURCE_ARG  2
@@ -130,6 +139,7 @@ int WRFLAG_CIDRAN    ;
 int WRFLAG_FITS      ;
 int WRFLAG_FILTERS   ; // Aug 2016
 int WRFLAG_COMPACT   ; // Jan 2018
+int WRFLAG_THREAD_FITS ; // Oct 2026
 
 #define SIMLIB_PSF_PIXEL_SIGMA   "PIXEL_SIGMA"        // default
 #define SIMLIB_PSF_ARCSEC_FWHM   "ARCSEC_FWHM"        // option
@@ -148,6 +158,7 @@ int WRFLAG_COMPACT   ; // Jan 2018
 #define SIMLIB_MSKOPT_IGNORE_FLUXERR_COR      32 // ignore FLUXERR_COR map
 #define SIMLIB_MSKOPT_ENTIRE_SEASON          128 // keep entire SIMLIB season
 #define SIMLIB_MSKOPT_ENTIRE_SURVEY          256 // keep entire SIMLIB survey
+#define SIMLIB_MSKOPT_WRITEBIN              1024 // write binary SIMLIB & quit
 
 #define METHOD_TYPE_SPEC 1    // spec id
 #define METHOD_TYPE_PHOT 2    // phot id
@@ -160,6 +171,59 @@ struct {
   int    NGENTOT_LAST ;
 } TIMERS ;
 
+// Oct 2026: wall-clock timer (monotonic, nsec) and call counter around 
+// each major driver; written to README OUTPUT_SUMMARY and YAML file.
+// Times are inclusive, e.g., EVENT includes SIMLIB and HOSTLIB.
+#define NSTAGE_TIMER          8
+#define ISTAGE_TIMER_EVENT    0  // gen_event_driver
+#define ISTAGE_TIMER_HOSTLIB  1  // GEN_SNHOST_DRIVER (GEN_SNHOST_GALID ...)
+#define ISTAGE_TIMER_SIMLIB   2  // SIMLIB_READ_DRIVER
+#define ISTAGE_TIMER_GENMAG   3  // GENMAG_DRIVER
+#define ISTAGE_TIMER_GENSPEC  4  // GENSPEC_DRIVER
+#define ISTAGE_TIMER_GENFLUX  5  // GENFLUX_DRIVER
+#define ISTAGE_TIMER_SEARCHEFF 6 // gen_SEARCHEFF
+#define ISTAGE_TIMER_OUTPUT   7  // update_simFiles
+#define STAGENAME_TIMER (char*[NSTAGE_TIMER]) \
+  { "EVENT", "HOSTLIB", "SIMLIB", "GENMAG", "GENSPEC", "GENFLUX", \
+    "SEARCHEFF", "OUTPUT" }
+
+struct {
+  long long NCALL[NSTAGE_TIMER] ;
+  double    TSUM[NSTAGE_TIMER] ;  // seconds
+  struct timespec T0[NSTAGE_TIMER] ;
+} TIMERS_STAGE ;
+
+// Oct 2026: NTHREAD>1 forks workers after init; each worker has its own
+// copy of GENLC, SEARCHEFF, SIMLIB buffers ... and its own random seed.
+// Each worker writes its own FITS files, and the parent merges the
+// LIST, DUMP and stats in worker order so that output is reproducible
+// for a given RANSEED and NTHREAD.
+#define MXWORKER_SIM  64
+
+typedef struct {
+  int NGENLC_TOT, NGENLC_WRITE, NGENSPEC_TOT, NGENSPEC_WRITE ;
+  int NGENFLUX_DRIVER, NGEN_ALLSKIP, NTYPE_PHOT_WRONGHOST ;
+  int NGEN_REJECT_GENRANGE, NGEN_REJECT_GENMAG, NGEN_REJECT_HOSTLIB ;
+  int NGEN_REJECT_SEARCHEFF, NGEN_REJECT_CUTWIN, NGEN_REJECT_NEPOCH ;
+  int NGEN_REJECT_GENPAR_SELECT ;
+  int NGENLC_TOT_SUBSURVEY[MXIDSURVEY];
+  int NGENLC_WRITE_SUBSURVEY[MXIDSURVEY];
+  int NGENLC_HOSTMATCH[10], NGENLC_NO_HOST[10], NGENLC_MULTI_HOST[10];
+  long long NCALL_STAGE[NSTAGE_TIMER];
+  double    TSUM_STAGE[NSTAGE_TIMER];
+  char HEADFILE[MXPATHLEN];  // FITS HEAD file written by worker
+  char DUMPFILE[MXPATHLEN];  // SIMGEN_DUMP file written by worker
+} SIMWORKER_STATS_DEF ;
+
+struct {
+  int   NWORKER ;      // = INPUTS.NTHREAD
+  int   ID_WORKER ;    // 0 to NWORKER-1 in worker; -1 in parent
+  int   FD_PIPE ;      // worker writes stats to parent via this pipe
+  int   ILC_RANGE[MXWORKER_SIM][2] ; // ilc range per worker
+  pid_t PID[MXWORKER_SIM];
+  SIMWORKER_STATS_DEF STATS ;  // stats for this worker
+} SIMWORKER ;
+
 // define auxillary files produced with data files.
 typedef struct {
 
@@ -390,6 +454,43 @@ typedef struct {
 
 } FLUXNOISE_DEF ;
 
+// Oct 2026: contiguous work arrays (one element per generated epoch)
+//   to compute flux noise for all epochs of an event in simple loops.
+//   DEBUG_FLAG = DEBUG_FLAG_FLUXNOISE_EPOCH -> legacy per-epoch calc.
+#define DEBUG_FLAG_FLUXNOISE_EPOCH 1013
+typedef struct {
+  int    NOBS, MXOBS ;
+  int    *EPOCH, *IFILT_OBS ;
+
+  // inputs gathered from SIMLIB_OBS_GEN and GENLC
+  double *ZPT, *ZPTERR, *CCDGAIN, *SKYSIG, *READNOISE, *NEA, *PIXSIZE ;
+  double *TEMPLATE_SKYSIG, *TEMPLATE_READNOISE, *TEMPLATE_ZPT ;
+  double *GENMAG, *GENMAG_T ;
+
+  // intermediate results (p.e.)
+  double *NADU_over_FLUXCAL, *FLUXSN_PE, *FLUX_T, *FLUXMON_PE ;
+  double *SQERR_SKY, *SQERR_CCD, *TEMPLATE_SQERR, *FLUXGAL_PE, *GALMAG ;
+  double *SQERR_ZP ;
+} FLUXNOISE_BATCH_DEF ;
+
+FLUXNOISE_BATCH_DEF FLUXNOISE_BATCH ;
+
+// Oct 2026: cache Cholesky factor of the correlation matrix for each
+//   FLUXERRMODEL REDCOV group. COV_ij = SIG_i*SIG_j*RHO_ij with RHO=1 
+//   on diagonal and RHO=REDCOV off-diagonal, so the correlated randoms
+//   depend only on (icov, NOBS, REDCOV) and the factor of RHO is 
+//   re-used for all events. L is packed lower-triangle, 
+//   L[j*(j+1)/2 + i] for i <= j.
+#define MXREDCOV_CHOLESKY_CACHE  20    // >= MXREDCOV_FLUXERRMAP
+#define MXOBS_CHOLESKY_CACHE   2000    // max NOBS to cache
+#define MXMB_CHOLESKY_CACHE     200    // max memory (MB) for cache
+struct {
+  double   REDCOV[MXREDCOV_CHOLESKY_CACHE] ;
+  double **L[MXREDCOV_CHOLESKY_CACHE] ;  // [icov][NOBS] -> packed L
+  double  *L_TMP ;       // used when cache is full or NOBS is too large
+  long long MEMTOT, NHIT, NMISS, NFULL ;
+} CHOLESKY_CACHE_FLUXNOISE ;
+
 
 typedef struct {
   int    NSUM ;
@@ -474,6 +575,7 @@ struct INPUTS {
   int  USE_SIMLIB_SPECTRA;    // use TAKE_SPECTRUM keys in SIMLIB header
   int  USE_SIMLIB_SALT2 ;     // use SALT2c and SALT2x1 from SIMLIB header
   int  SIMLIB_MSKOPT ;        // special SIMLIB options (see manaul)
+  int  SIMLIB_CACHE_MXMB ;    // max MB to cache prepared cadences (Oct 2026)
 
   // ---- end simlib inputs -----
 
@@ -487,6 +589,7 @@ struct INPUTS {
 
   int  JOBID;       // command-line only (for batch) to compute SIMLIB_IDSTART
   int  NJOBTOT;     // idem, for submit_batch_jobs.py
+  int  NTHREAD;     // number of forked workers to generate events (Oct 2026)
 
   int  HOSTLIB_USE ;            // 1=> used; 0 => not used, 2=>rewrite HOSTLIB
   char HOSTLIB_PLUS_COMMAND[60];        //e.g., +HOSTMAGS, +HOSTNBR, +HOSTAPPEND
@@ -585,6 +688,8 @@ struct INPUTS {
   unsigned int ISEED;         // random seed
   unsigned int ISEED_ORIG;    // for readme output
   int          NSTREAM_RAN;   // number of independent random streams
+  int          CBRNG_RAN;     // 1 -> counter-based randoms (Oct 2026)
+  int          SHARED_TABLES; // 1 -> share model/kcor tables on node (Oct 2026)
 
   int    RANLIST_START_GENSMEAR;  // to pick different genSmear randoms
 
@@ -834,6 +939,7 @@ struct INPUTS {
   // define snana-style cut windows
   int APPLY_CUTWIN_OPT ;      // 0= ignore cuts; 1=> apply cuts;
                               // 3=> apply cuts to data, not to SIMGEN-DUMP
+  int EARLY_REJECT_NEVT_TRAIN ; // Ntrain events to order pre-cuts (Oct 2026)
 
   int   NCUTWIN_TOT;
   float EPCUTWIN_LAMREST[2];    // lambda-requirement on all epochs
@@ -1541,6 +1647,77 @@ struct {
 
 
 
+// Oct 2026: binary SIMLIB written with SIMLIB_MSKOPT += 1024.
+// TEXT is the original SIMLIB with each 'S:' line replaced by 
+// 'S: #<IOBS>', where IOBS points to pre-parsed values in the OBS 
+// arrays; all other keys are parsed as before. LIB index gives the
+// TEXT offset of each LIBID for random access, and the MJD-sort
+// (SIMLIB_sortbyMJD) for LIBIDs without APPEND or SPECTROGRAPH keys.
+#define MAGIC_SIMLIB_BINARY   "SNANA_SIMLIB_BINARY_V1"
+#define SUFFIX_SIMLIB_BINARY  ".BIN"
+typedef struct {
+  char      MAGIC[32] ;
+  int       NLIBID ;
+  int       NEA_PSF_UNIT ;     // PSF column is NEA
+  long long NOBS ;             // total number of 'S:' lines
+  long long OFFSET_TEXT, LEN_TEXT ;
+  long long OFFSET_LIB ;       // NLIBID x SIMLIB_BINARY_LIB_DEF
+  long long OFFSET_OBS ;       // NVAR_OBS_SIMLIB_BINARY x NOBS doubles,
+                               // then 3 x NOBS ints and NOBS x 4 chars
+} SIMLIB_BINARY_HEAD_DEF ;
+
+typedef struct {
+  int       LIBID ;
+  int       NOBS ;             // number of 'S:' lines for this LIBID
+  long long OFFSET ;           // TEXT offset of 'LIBID:' line
+  long long IOBS ;             // index of first obs in OBS arrays
+  int       SORTED ;           // 1 -> INDEX_SORT is stored
+  int       PAD ;
+} SIMLIB_BINARY_LIB_DEF ;
+
+#define NVAR_OBS_SIMLIB_BINARY  11
+struct {
+  bool   USE ;                 // SIMLIB_FILE is binary
+  char   FILENAME[MXPATHLEN] ;
+  char  *MAP ;
+  size_t MAPSIZE ;
+  SIMLIB_BINARY_HEAD_DEF *HEAD ;
+  SIMLIB_BINARY_LIB_DEF  *LIB ;
+  double *MJD, *CCDGAIN, *READNOISE, *SKYSIG, *PSFSIG1, *PSFSIG2, *PSFRATIO;
+  double *NEA, *ZPTADU, *ZPTERR, *MAG ;
+  int    *IDEXPT, *NEXPOSE, *INDEX_SORT ; // INDEX_SORT is relative to LIBID
+  char   *BAND ;                          // 4 chars per obs
+  long long IOBS_RAW[MXOBS_SIMLIB] ;      // IOBS for each SIMLIB_OBS_RAW
+} SIMLIB_BINARY ;
+
+
+// Oct 2026: cache of prepared cadence for each LIBID so that re-used
+// LIBIDs (SIMLIB_NREPEAT, or wrap-around) skip MJD-sort, season and 
+// template-field logic. Key is LIBID plus a hash of the raw cadence 
+// (MJD,OPTLINE,APPEND) so that a modified cadence is never matched.
+#define NBUCKET_SIMLIB_CACHE 4096
+typedef struct {
+  int    LIBID, NOBS, NMJD ;
+  unsigned int HASH ;
+  int    NEXT ;            // next entry in same hash bucket
+  int    NSEASON ;
+  double MJDRANGE_SEASON[MXSEASON_SIMLIB][2];
+  double TLEN_SEASON[MXSEASON_SIMLIB] ;
+  double MJDRANGE_SURVEY[2];
+  int    *INDEX_SORT, *ISEASON ;
+  int    *IFIELD ;         // template IFIELD per OBSRAW; -99 -> not set yet
+} SIMLIB_CACHE_ENTRY_DEF ;
+
+struct {
+  int    NENTRY, MXENTRY, ICURRENT ;
+  unsigned int HASH_CURRENT ;
+  int    FIRST[NBUCKET_SIMLIB_CACHE] ;
+  long long MEMTOT, MEMMAX ;   // bytes
+  long long NHIT, NMISS, NFULL ;
+  SIMLIB_CACHE_ENTRY_DEF *ENTRY ;
+} SIMLIB_CACHE ;
+
+
 struct SIMLIB_TEMPLATE {
 
   int    USEFLAG ;      // logical to use correlated template noise
@@ -1602,6 +1779,38 @@ xxxxx */
 
 #define ALLBIT_CUTMASK    4095   // 2^(maxbit+1)-1
 
+// Oct 2026: adaptive early-reject of CUTWIN cuts that are known after
+//   GENMAG_DRIVER. Each pre-cut is a necessary condition for the 
+//   corresponding CUTBIT in gen_cutwin, so accepted events are unchanged.
+//   During the first EARLY_REJECT_NEVT_TRAIN events, each pre-cut is
+//   evaluated (but not applied) to measure its reject rate and CPU cost,
+//   along with the CPU cost of GENSPEC -> gen_cutwin. Pre-cuts are then
+//   ordered by (reject rate)/(cost) and applied before GENSPEC_DRIVER;
+//   pre-cuts with no expected time saving are disabled.
+#define NSTAGE_EARLY_REJECT      4
+#define ISTAGE_EARLY_REJECT_REDSHIFT  0
+#define ISTAGE_EARLY_REJECT_MWEBV     1
+#define ISTAGE_EARLY_REJECT_PEAKMAG   2
+#define ISTAGE_EARLY_REJECT_TREST     3
+#define STAGENAME_EARLY_REJECT \
+  (char*[NSTAGE_EARLY_REJECT]){ "REDSHIFT", "MWEBV", "PEAKMAG", "TREST" }
+
+struct {
+  bool   USE ;          // pre-cuts are valid for this job
+  bool   TRAINED ;      // order is set after training
+  int    NEVT_TRAIN, NEVT_APPLY ;
+  int    ORDER[NSTAGE_EARLY_REJECT] ;  // evaluation order after training
+  bool   APPLY[NSTAGE_EARLY_REJECT] ;  // false -> skip this pre-cut
+  int    NEVAL[NSTAGE_EARLY_REJECT] ;  // evaluations after training
+  int    NFAIL_TRAIN[NSTAGE_EARLY_REJECT], NREJECT[NSTAGE_EARLY_REJECT] ;
+  double TSUM_TRAIN[NSTAGE_EARLY_REJECT], TSUM_APPLY[NSTAGE_EARLY_REJECT] ;
+
+  // CPU for GENSPEC -> gen_cutwin (cost avoided by early reject)
+  clock_t T_START_DOWNSTREAM ;  // -1 -> timer is not running
+  int     NEVT_DOWNSTREAM ;
+  double  TSUM_DOWNSTREAM ;
+} EARLY_REJECT ;
+
 // define strings to contain info about simulated volume & time
 int  NLINE_RATE_INFO;
 char LINE_RATE_INFO[MXEPSIM][80];
@@ -1707,6 +1916,12 @@ void   SIMLIB_readGlobalHeader_TEXT(void);
 void   SIMLIB_prepGlobalHeader(void);
 void   SIMLIB_prep_fluxerrScale_LEGACY(void);
 void   SIMLIB_findStart(void);
+int    open_SIMLIB_BINARY(char *PATH_LIST);
+FILE  *fopen_SIMLIB_BINARY(void);
+void   SIMLIB_write_BINARY(void);
+void   load_obs_SIMLIB_BINARY(char *cIOBS, int ISTORE);
+int    ilib_SIMLIB_BINARY(long long IOBS);
+int    seek_SIMLIB_BINARY(int NSKIP_LIBID, int IDSEEK);
 
 void   SIMLIB_READ_DRIVER(void);
 void   SIMLIB_readNextCadence_TEXT(void);
@@ -1724,14 +1939,20 @@ int    SIMLIB_read_templateNoise(char *field, char *whatNoise, char **wdlist);
 void   SIMLIB_TAKE_SPECTRUM(void) ;
 
 void   set_TIMERS(int flag);
+void   set_TIMERS_STAGE(int flag, int istage);
 
 int    SKIP_SIMLIB_FIELD(char *field);
 int    USE_SAME_SIMLIB_ID(int IFLAG) ;
 void   set_SIMLIB_NREPEAT(void);
 
-void   store_SIMLIB_SEASONS(void);
+void   store_SIMLIB_SEASONS(bool CACHED);
 void   set_SIMLIB_MJDrange(int OPT, double *MJDrange);
 void   remove_short_SIMLIB_SEASON(void);
+void   init_SIMLIB_CACHE(void);
+bool   load_SIMLIB_CACHE(int REPEAT_CADENCE);
+void   store_SIMLIB_CACHE(void);
+int    get_IFIELD_SIMLIB_CACHE(int OBSRAW, char *FIELD);
+void   summary_SIMLIB_CACHE(void);
 
 void   store_SIMLIB_SPECTROGRAPH(int ifilt, double *VAL_STORE, int ISTORE);
 void   store_GENSPEC(double *VAL_STORE);
@@ -1896,6 +2117,14 @@ void update_accept_counters(void);
 void update_hostmatch_counters(void);
 
 void    simEnd(SIMFILE_AUX_DEF *SIMFILE_AUX);
+
+void    prep_simWorkers(void);
+int     fork_simWorkers(SIMFILE_AUX_DEF *SIMFILE_AUX);
+void    init_simWorker(SIMFILE_AUX_DEF *SIMFILE_AUX);
+void    end_simWorker(SIMFILE_AUX_DEF *SIMFILE_AUX);
+void    merge_simWorkers(SIMFILE_AUX_DEF *SIMFILE_AUX, 
+			 SIMWORKER_STATS_DEF *STATS);
+void    SIMLIB_reopen_simWorker(void);
 double  gen_AV(void);          // generate AV from model
 
 double  GENAV_WV07(void);
@@ -1913,8 +2142,13 @@ void   GENFLUX_DRIVER_LEGACY(void);   // driver to generate observed fluxes
 void   set_GENFLUX_FLAGS(int ep);
 void   gen_fluxNoise_randoms(void);
 void   gen_fluxNoise_calc(int ep, int vbose, FLUXNOISE_DEF *FLUXNOISE);
+void   gen_fluxNoise_calc_batch(int NOBS, int *EPLIST, 
+				FLUXNOISE_DEF *FLUXNOISE);
+void   malloc_FLUXNOISE_BATCH(int MXOBS);
 void   gen_fluxNoise_fudge_diag(int ep, int vbose, FLUXNOISE_DEF *FLUXNOISE);
 void   gen_fluxNoise_fudge_cov(int icov);
+double *get_CHOLESKY_CACHE_FLUXNOISE(int icov, int NOBS);
+void   summary_CHOLESKY_CACHE_FLUXNOISE(void);
 void   gen_fluxNoise_apply(int ep, int vbose, FLUXNOISE_DEF *FLUXNOISE);
 void   dumpLine_fluxNoise(char *fnam, int ep, FLUXNOISE_DEF *FLUXNOISE);
 void   dumpEpoch_fluxNoise_apply(char *fnam, int ep, FLUXNOISE_DEF *FLUXNOISE);
@@ -1988,6 +2222,13 @@ double zHEL_WRONGHOST(void);
 
 int    gen_cutwin(void);
 int    gen_cutwin_PEAKMAG(int OPT, int ifilt_obs);
+
+void   init_EARLY_REJECT(void);
+int    apply_EARLY_REJECT(void);
+int    precut_EARLY_REJECT(int istage);
+void   order_EARLY_REJECT(void);
+void   timer_EARLY_REJECT(int flag);
+void   summary_EARLY_REJECT(void);
 int    geneff_calc(void);
 void   magdim_calc(void);
 void   screen_update(void);
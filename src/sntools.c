@@ -7,6 +7,10 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>   // Oct 2026: shared tables
+#include <sys/file.h>
+#include <fcntl.h>
+#include <errno.h>
 
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_sort.h>
@@ -6197,6 +6201,11 @@ void init_random_seed(int ISEED, int NSTREAM) {
 #endif
   }
 
+  // key for optional counter-based randoms (Oct 2026)
+  GENRAN_INFO.CBRNG_KEY[0] = (unsigned int)ISEED ;
+  GENRAN_INFO.CBRNG_KEY[1] = (unsigned int)ISEED2 ;
+  for(i=0; i < MXSTREAM_RAN; i++ ) { GENRAN_INFO.CBRNG_NDRAW_UNIX[i] = 0; }
+
   fill_RANLISTs(); 
   for ( i=1; i <= GENRAN_INFO.NLIST_RAN; i++ )  { 
     GENRAN_INFO.RANFIRST[i]    = getRan_Flat1(i); 
@@ -6226,6 +6235,8 @@ void fill_RANLISTs(void) {
   //
   // Jun 9 2018: use unix_getRan_Flat1() call.
   // Jun 4 2020: change function name from init_RANLIST -> fill_RANLISTs
+  // Oct 2026: for counter-based randoms, nothing to fill; just
+  //           increment NFILL and reset draw counters.
 
   int ilist, istore, NLIST_RAN;
   char fnam[] = "fill_RANLISTs" ;
@@ -6244,6 +6255,15 @@ void fill_RANLISTs(void) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
   }
 
+  if ( GENRAN_INFO.USE_CBRNG ) {
+    GENRAN_INFO.CBRNG_NFILL++ ;
+    for (ilist = 1; ilist <= NLIST_RAN; ilist++ ) 
+      { GENRAN_INFO.NSTORE_RAN[ilist] = 0 ; }
+    for (ilist = 0; ilist < MXSTREAM_RAN; ilist++ ) 
+      { GENRAN_INFO.CBRNG_NDRAW_UNIX[ilist] = 0 ; }
+    return ;
+  }
+
   sumstat_RANLISTs(0);
 
   for (ilist = 1; ilist <= NLIST_RAN; ilist++ ) {
@@ -6258,6 +6278,130 @@ void fill_RANLISTs(void) {
 
 }  // end of fill_RANLISTs
 
+
+// **********************************************
+void init_random_cbrng(int OPT) {
+
+  // Created Oct 2026
+  // OPT > 0 -> use counter-based randoms for getRan_Flat1 and
+  //            unix_getRan_Flat1. Must be called before init_random_seed.
+  //
+  // Each random is computed from (seed, event, fill, list, draw)
+  // with Philox4x32-10 instead of a lookup in pre-filled RANSTORE
+  // lists, so that
+  //  + any event can be regenerated in isolation from its event index
+  //  + there is no wrap-around (re-use) of randoms for large events
+  //  + streams are trivially split among workers, since the
+  //    sequence does not depend on how many events were generated 
+  //    before.
+  // The event index is set by calling set_random_event(EVENT) before
+  // fill_RANLISTs for each event.
+
+  // ---------- BEGIN -----------
+
+  GENRAN_INFO.USE_CBRNG   = ( OPT > 0 );
+  GENRAN_INFO.CBRNG_EVENT = 0 ;
+  GENRAN_INFO.CBRNG_NFILL = 0 ;
+
+  if ( GENRAN_INFO.USE_CBRNG ) 
+    { printf("\t Use counter-based randoms (Philox4x32-10)\n"); }
+
+  return ;
+
+} // end init_random_cbrng
+
+
+// **********************************************
+void set_random_event(int EVENT) {
+
+  // Created Oct 2026
+  // Set event index for counter-based randoms. If EVENT is the same
+  // as the previous call (e.g., sim re-generates a rejected event),
+  // the fill counter continues so that new randoms are used.
+  // Does nothing unless init_random_cbrng(1) was called.
+
+  unsigned int UEVENT = (unsigned int)EVENT ;
+
+  // ---------- BEGIN -----------
+
+  if ( !GENRAN_INFO.USE_CBRNG ) { return; }
+
+  if ( UEVENT != GENRAN_INFO.CBRNG_EVENT ) {
+    GENRAN_INFO.CBRNG_EVENT = UEVENT ;
+    GENRAN_INFO.CBRNG_NFILL = 0 ;
+  }
+
+  return ;
+
+} // end set_random_event
+
+
+// **********************************************
+void philox4x32_10(unsigned int *CTR, unsigned int *KEY, unsigned int *OUT) {
+
+  // Created Oct 2026
+  // Philox4x32 with 10 rounds (Salmon et al, SC11, "Parallel random
+  // numbers: as easy as 1, 2, 3"). Input 128-bit counter CTR[4] and 
+  // 64-bit KEY[2]; return 128 random bits in OUT[4].
+  // Known answer: CTR=KEY=0 -> 6627e8d5 e169c58d bc57ac4c 9b00dbd8
+
+  const unsigned int M0 = 0xD2511F53, M1 = 0xCD9E8D57 ;
+  const unsigned int W0 = 0x9E3779B9, W1 = 0xBB67AE85 ;
+  unsigned int c0=CTR[0], c1=CTR[1], c2=CTR[2], c3=CTR[3] ;
+  unsigned int k0=KEY[0], k1=KEY[1] ;
+  unsigned long long p0, p1 ;
+  int iround ;
+
+  // ---------- BEGIN -----------
+
+  for(iround=0; iround < 10; iround++ ) {
+    if ( iround > 0 ) { k0 += W0;  k1 += W1; }
+    p0 = (unsigned long long)M0 * c0 ;
+    p1 = (unsigned long long)M1 * c2 ;
+    c0 = (unsigned int)(p1 >> 32) ^ c1 ^ k0 ;
+    c2 = (unsigned int)(p0 >> 32) ^ c3 ^ k1 ;
+    c1 = (unsigned int)p1 ;
+    c3 = (unsigned int)p0 ;
+  }
+
+  OUT[0] = c0;  OUT[1] = c1;  OUT[2] = c2;  OUT[3] = c3;
+
+} // end philox4x32_10
+
+
+// **********************************************
+double cbrng_getRan_Flat1(unsigned int *KEY, unsigned int EVENT, 
+			  unsigned int NFILL, int ISLOT, 
+			  unsigned long long IDRAW) {
+
+  // Created Oct 2026
+  // Return counter-based flat random, 0 < r < 1, with 53-bit resolution.
+  // Stateless: same inputs always give the same random.
+  //   KEY[2] : from random seed
+  //   EVENT  : event index
+  //   NFILL  : fill index within event (see fill_RANLISTs)
+  //   ISLOT  : list index for getRan_Flat1, or stream slot for unix_getRan
+  //   IDRAW  : draw index
+  // Each Philox block gives two randoms: even/odd IDRAW.
+
+  unsigned int CTR[4], OUT[4], hi, lo ;
+  unsigned long long IBLOCK = IDRAW >> 1 ;
+  int  IPAIR = (int)(IDRAW & 1) ;
+
+  // ---------- BEGIN -----------
+
+  CTR[0] = (unsigned int)(IBLOCK & 0xFFFFFFFF) ;
+  CTR[1] = ((unsigned int)ISLOT << 24) | (NFILL & 0x00FFFFFF) ;
+  CTR[2] = EVENT ;
+  CTR[3] = (unsigned int)(IBLOCK >> 32) ;
+  philox4x32_10(CTR, KEY, OUT);
+
+  hi = OUT[2*IPAIR+0] >> 5 ;  // 27 bits
+  lo = OUT[2*IPAIR+1] >> 6 ;  // 26 bits
+  return( ((double)hi * 67108864.0 + (double)lo + 0.5) / 9007199254740992.0 );
+
+} // end cbrng_getRan_Flat1
+
 // **********************************
 void sumstat_RANLISTs(int FLAG) {
 
@@ -6292,6 +6436,7 @@ void sumstat_RANLISTs(int FLAG) {
       SUM   = GENRAN_INFO.NWRAP_SUM[ilist] ;
       SUMSQ = GENRAN_INFO.NWRAP_SUMSQ[ilist] ;
       NCALL = GENRAN_INFO.NCALL_fill_RANSTATs ;
+      if ( NCALL == 0 ) { continue; } // e.g., counter-based randoms
       GENRAN_INFO.NWRAP_AVG[ilist] = SUM/(double)NCALL ; 
       GENRAN_INFO.NWRAP_RMS[ilist] = STD_from_SUMS(NCALL, SUM, SUMSQ);
     }
@@ -6308,11 +6453,20 @@ double unix_getRan_Flat1(int istream) {
   // Return random between 0 and 1.
   //
   // Jul 30 2020: check pre-proc flag ONE_RANDOM_STREAM
+  // Oct 2026: check counter-based option (slot after the lists)
 
   int NSTREAM = GENRAN_INFO.NSTREAM ;
   int JRAN ;
   char fnam[] = "unix_getRan_Flat1";
   // ------------ BEGIN ----------------
+  if ( GENRAN_INFO.USE_CBRNG ) {
+    return cbrng_getRan_Flat1(GENRAN_INFO.CBRNG_KEY, 
+			      GENRAN_INFO.CBRNG_EVENT,
+			      GENRAN_INFO.CBRNG_NFILL, 
+			      MXLIST_RAN+1+istream,
+			      GENRAN_INFO.CBRNG_NDRAW_UNIX[istream]++ );
+  }
+
   if ( NSTREAM == 1 )  { 
     JRAN = random(); 
   }
@@ -6351,6 +6505,55 @@ double getRan_Gauss(int ilist) {
 }  // end of getRan_Gauss
 
 
+void getRan_GaussList(int ilist, int NRAN, double *RANLIST) {
+
+  // Created Oct 16 2026
+  // Fill RANLIST with NRAN Gaussian randoms from "ilist".
+  // Same sequence as NRAN calls to getRan_Gauss(ilist), but ilist
+  // is checked once and the stored flat randoms are read directly
+  // in one loop (e.g., all flux-noise randoms for an event).
+
+  int    NLIST_RAN = GENRAN_INFO.NLIST_RAN ;
+  int    i, N ;
+  double R, V1, V2, FAC, *RANSTORE ;
+  char fnam[] = "getRan_GaussList" ;
+
+  // --------------- BEGIN ----------------
+
+  if ( ilist < 1 || ilist > NLIST_RAN ) {
+    sprintf(c1err,"Invalid ilist = %d", ilist);
+    sprintf(c2err,"Valid ilist is 1 to %d", NLIST_RAN );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+  }
+
+  // counter-based randoms are already evaluated per draw
+  if ( GENRAN_INFO.USE_CBRNG ) {
+    for(i=0; i < NRAN; i++ ) { RANLIST[i] = getRan_Gauss(ilist); }
+    return ;
+  }
+
+  RANSTORE = GENRAN_INFO.RANSTORE[ilist] ;
+  N        = GENRAN_INFO.NSTORE_RAN[ilist] ;
+
+  for(i=0; i < NRAN; i++ ) {
+  PICK:
+    if ( N >= MXSTORE_RAN ) { N = 0; GENRAN_INFO.NWRAP[ilist] += 1.0 ; }
+    V1 = 2.0 * RANSTORE[N++] - 1.0;
+    if ( N >= MXSTORE_RAN ) { N = 0; GENRAN_INFO.NWRAP[ilist] += 1.0 ; }
+    V2 = 2.0 * RANSTORE[N++] - 1.0;
+    R  = V1*V1 + V2*V2 ;
+    if ( R >= 1.0 ) { goto PICK ; }
+    FAC = sqrt(-2.*log(R)/R) ;
+    RANLIST[i] = V2 * FAC ;
+  }
+
+  GENRAN_INFO.NSTORE_RAN[ilist] = N ;
+
+  return ;
+
+} // end getRan_GaussList
+
+
 double unix_getRan_Gauss(int istream) {
   // Created Jun 4 2020
   // pick random Gaussian directly from unix_getRan_Flat1 using 
@@ -6402,6 +6605,15 @@ double getRan_Flat1(int ilist) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
   }
 
+  // Oct 2026: counter-based random; NSTORE_RAN is the draw index
+  if ( GENRAN_INFO.USE_CBRNG ) {
+    N = GENRAN_INFO.NSTORE_RAN[ilist]++ ;
+    return cbrng_getRan_Flat1(GENRAN_INFO.CBRNG_KEY, 
+			      GENRAN_INFO.CBRNG_EVENT,
+			      GENRAN_INFO.CBRNG_NFILL, ilist, 
+			      (unsigned long long)N );
+  }
+
   // check to wrap around with random list.
   if ( GENRAN_INFO.NSTORE_RAN[ilist] >= MXSTORE_RAN ) { 
     GENRAN_INFO.NSTORE_RAN[ilist] = 0;  
@@ -10150,3 +10362,282 @@ float malloc_shortint4D(int opt, int LEN1, int LEN2, int LEN3, int LEN4,
   return(f_MEMTOT);
 
 }   // end malloc_shortint4D
+
+
+// ****************************************************
+void *malloc_shared_table(char *TAG, char *FILENAME, size_t SIZE, 
+			  bool *IS_OWNER) {
+
+  // Created Oct 16 2026
+  // Return pointer to SIZE bytes for a large read-only table
+  // (e.g., model flux table or kcor table) in a shared-memory 
+  // segment under /dev/shm, so that concurrent jobs on the same
+  // node share one copy instead of each job holding a private copy.
+  //
+  // Inputs:
+  //   TAG      : name of table + any option that changes table content
+  //   FILENAME : file that table is read from; file size, mod-time
+  //              and SNANA version are included in key so that a 
+  //              changed file or code results in a new segment.
+  //   SIZE     : size of table, bytes
+  //
+  // Output:
+  //  *IS_OWNER = true  -> this job created segment and must fill the
+  //                       table, then call ready_shared_table(TABLE).
+  //  *IS_OWNER = false -> table was filled by another job; do not 
+  //                       read or modify the table.
+  //
+  // Function returns NULL if shared tables are not used, or for any 
+  // failure; caller then falls back to private malloc. 
+  // The creator holds an exclusive flock until the table is ready;
+  // other jobs block on a shared flock, then increment the reference
+  // count NATTACH. Last job to detach (free_shared_tables) removes
+  // the segment. Attached jobs map the table read-only; only the
+  // header (for NATTACH) is mapped writable.
+  //
+  // A segment whose header does not match (magic, version, size, key)
+  // or was never made READY (creator died) is stale: it is removed 
+  // and this job rebuilds it.
+
+  int  NTABLE = SHARED_TABLE_INFO.NTABLE ;
+  SHARED_TABLE_HEAD_DEF *HEAD = NULL ;
+  struct stat STAT, STAT_SHM, STAT_NOW ;
+  char KEY[MXCHAR_KEY_SHARED_TABLE], shmFile[MXPATHLEN] ;
+  unsigned long long HASH ;
+  size_t OFFSET, MAPSIZE, HEADSIZE = sizeof(SHARED_TABLE_HEAD_DEF) ;
+  void  *MAP = NULL ;
+  int   fd, FD_LOCK = -1, itry, ibuild, i, len, NATTACH = 1 ;
+  bool  VALID, REBUILD ;
+  char fnam[] = "malloc_shared_table" ;
+
+  // ----------- BEGIN -------------
+
+  *IS_OWNER = false ;
+  if ( !SHARED_TABLE_INFO.USE      ) { return NULL; }
+  if ( NTABLE >= MXSHARED_TABLE    ) { return NULL; }
+  if ( SIZE == 0                   ) { return NULL; }
+  if ( stat(FILENAME, &STAT) != 0  ) { return NULL; }
+
+  snprintf(KEY, MXCHAR_KEY_SHARED_TABLE, 
+	   "%s | %s | %lld | %lld | %llu | %s",
+	   TAG, FILENAME, (long long)STAT.st_size, 
+	   (long long)STAT.st_mtime, (unsigned long long)SIZE,
+	   SNANA_VERSION_CURRENT );
+
+  // FNV-1a hash of key -> segment name
+  HASH = 14695981039346656037ULL ;
+  len  = strlen(KEY);
+  for(i=0; i < len; i++ ) 
+    { HASH ^= (unsigned char)KEY[i];  HASH *= 1099511628211ULL ; }
+
+  sprintf(shmFile,"%s_%d_%016llx", 
+	  PREFIX_SHARED_TABLE, (int)getuid(), HASH );
+
+  // keep table 64-byte aligned after header
+  OFFSET  = 64 * ( (HEADSIZE + 63)/64 ) ;
+  MAPSIZE = OFFSET + SIZE ;
+
+  // ibuild=1 only after removing a stale segment
+  for(ibuild=0; ibuild < 2; ibuild++ ) {
+
+    // - - - - - - - - - 
+    // first job creates segment
+    fd = open(shmFile, O_RDWR | O_CREAT | O_EXCL, 0600) ;
+    if ( fd >= 0 ) {
+      // reserve memory now so that a full /dev/shm results in
+      // fallback instead of SIGBUS later.
+      if ( flock(fd, LOCK_EX) != 0 || 
+	   posix_fallocate(fd, 0, (off_t)MAPSIZE) != 0 ) 
+	{ unlink(shmFile); close(fd); return NULL; }
+
+      MAP = mmap(NULL, MAPSIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+      if ( MAP == MAP_FAILED ) 
+	{ unlink(shmFile); close(fd); return NULL; }
+
+      HEAD = (SHARED_TABLE_HEAD_DEF*)MAP ;
+      HEAD->MAGIC   = MAGIC_SHARED_TABLE ;
+      HEAD->VERSION = VERSION_SHARED_TABLE ;
+      HEAD->SIZE    = (unsigned long long)SIZE ;
+      HEAD->READY   = 0 ;
+      HEAD->NATTACH = 1 ;
+      sprintf(HEAD->KEY, "%s", KEY);
+      *IS_OWNER = true ;
+      FD_LOCK   = fd ;   // hold lock until ready_shared_table
+      fstat(fd, &STAT_SHM);
+      break ;
+    }
+
+    if ( errno != EEXIST ) { return NULL; } // e.g., no /dev/shm
+
+    // another job created (or is creating) this segment; 
+    // shared lock waits until creator is done. Creator may not
+    // have the lock yet, so retry a few times before declaring
+    // an empty segment stale.
+    REBUILD = false ;
+    for(itry=0; itry < NTRY_STALE_SHARED_TABLE; itry++ ) {
+      if ( itry > 0 ) { sleep(1); }
+      fd = open(shmFile, O_RDWR);
+      if ( fd < 0 ) { REBUILD = true; break; } // removed -> create
+      flock(fd, LOCK_SH);
+      fstat(fd, &STAT_SHM);
+
+      // size=0 -> creator has not yet taken the lock; else the
+      // header is complete because creator writes it under lock.
+      if ( STAT_SHM.st_size == 0 && itry < NTRY_STALE_SHARED_TABLE-1 ) 
+	{ flock(fd, LOCK_UN);  close(fd);  continue; }
+
+      HEAD = NULL ;
+      if ( STAT_SHM.st_size == (off_t)MAPSIZE ) {
+	HEAD = (SHARED_TABLE_HEAD_DEF*)
+	  mmap(NULL, HEADSIZE, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+	if ( HEAD == MAP_FAILED ) { HEAD = NULL; }
+      }
+
+      VALID = ( HEAD != NULL                            &&
+		HEAD->MAGIC   == MAGIC_SHARED_TABLE         &&
+		HEAD->VERSION == VERSION_SHARED_TABLE       &&
+		HEAD->SIZE    == (unsigned long long)SIZE   &&
+		HEAD->READY   == 1                          &&
+		strcmp(HEAD->KEY,KEY) == 0 );
+
+      if ( VALID ) {
+	MAP = mmap(NULL, MAPSIZE, PROT_READ, MAP_SHARED, fd, 0);
+	if ( MAP == MAP_FAILED ) 
+	  { MAP = NULL;  munmap(HEAD,HEADSIZE);  HEAD = NULL; }
+	else
+	  { NATTACH = __sync_add_and_fetch(&HEAD->NATTACH, 1); }
+      }
+      else {
+	// stale: remove under exclusive lock, unless another job
+	// already replaced it with a new segment.
+	if ( HEAD != NULL ) { munmap(HEAD,HEADSIZE);  HEAD = NULL; }
+	flock(fd, LOCK_EX);
+	if ( stat(shmFile,&STAT_NOW) == 0 && 
+	     STAT_NOW.st_ino == STAT_SHM.st_ino ) { unlink(shmFile); }
+	REBUILD = true ;
+      }
+
+      flock(fd, LOCK_UN);  close(fd);
+      break ;
+    }
+
+    if ( MAP != NULL ) { break; }
+    if ( !REBUILD    ) { return NULL; } // e.g., mmap failure
+
+    printf("  %s: remove stale segment for %s -> rebuild\n", fnam, TAG);
+    printf("\t %s \n", shmFile);
+    fflush(stdout);
+  } // end ibuild
+
+  if ( MAP == NULL ) { return NULL; }
+
+  // - - - - - - - - 
+  // store info for ready & detach
+  if ( NTABLE == 0 ) {
+    SHARED_TABLE_INFO.PID = (int)getpid();
+    atexit(free_shared_tables); 
+  }
+  sprintf(SHARED_TABLE_INFO.FILENAME[NTABLE], "%s", shmFile);
+  SHARED_TABLE_INFO.MAP[NTABLE]     = MAP ;
+  SHARED_TABLE_INFO.MAPSIZE[NTABLE] = MAPSIZE ;
+  SHARED_TABLE_INFO.HEAD[NTABLE]    = HEAD ;
+  SHARED_TABLE_INFO.TABLE[NTABLE]   = (char*)MAP + OFFSET ;
+  SHARED_TABLE_INFO.FD_LOCK[NTABLE] = FD_LOCK ;
+  SHARED_TABLE_INFO.INODE[NTABLE]   = (long long)STAT_SHM.st_ino ;
+  SHARED_TABLE_INFO.NTABLE++ ;
+
+  printf("  %s: %s %s (%.1f MB, NATTACH=%d) \n", 
+	 fnam, (*IS_OWNER ? "create" : "attach"), TAG, 
+	 1.0E-6*(double)SIZE, NATTACH );
+  printf("\t %s \n", shmFile);
+  fflush(stdout);
+
+  return SHARED_TABLE_INFO.TABLE[NTABLE] ;
+
+} // end malloc_shared_table
+
+int index_shared_table(void *TABLE) {
+  // return index of shared TABLE, or -1 if not found.
+  int i;
+  for(i=0; i < SHARED_TABLE_INFO.NTABLE; i++ ) {
+    if ( SHARED_TABLE_INFO.TABLE[i] == TABLE ) { return i; }
+  }
+  return -1;
+} // end index_shared_table
+
+void ready_shared_table(void *TABLE) {
+
+  // Created Oct 16 2026
+  // Called by creator after filling TABLE; set READY flag and
+  // release exclusive lock so that waiting jobs can attach.
+
+  int i = index_shared_table(TABLE);
+  int fd ;
+  SHARED_TABLE_HEAD_DEF *HEAD ;
+
+  // ----------- BEGIN ------------
+
+  if ( i < 0 ) { return; }
+  fd = SHARED_TABLE_INFO.FD_LOCK[i] ;
+  if ( fd < 0 ) { return; }
+
+  HEAD = SHARED_TABLE_INFO.HEAD[i] ;
+  __sync_synchronize();
+  HEAD->READY = 1 ;
+  __sync_synchronize();
+
+  flock(fd, LOCK_UN);  close(fd);
+  SHARED_TABLE_INFO.FD_LOCK[i] = -1 ;
+
+  return ;
+
+} // end ready_shared_table
+
+void free_shared_tables(void) {
+
+  // Created Oct 16 2026
+  // Detach all shared tables (registered with atexit).
+  // Decrement reference count, and remove segment if this is 
+  // the last job. A creator that exits before its table is
+  // ready removes the incomplete segment. Forked children skip 
+  // this so that only the attaching process decrements NATTACH.
+
+  SHARED_TABLE_HEAD_DEF *HEAD ;
+  struct stat STAT_SHM ;
+  char *shmFile ;
+  int  i, fd, NATTACH ;
+
+  // ----------- BEGIN ------------
+
+  if ( (int)getpid() != SHARED_TABLE_INFO.PID ) { return; }
+
+  for(i=0; i < SHARED_TABLE_INFO.NTABLE; i++ ) {
+    HEAD    = SHARED_TABLE_INFO.HEAD[i] ;
+    shmFile = SHARED_TABLE_INFO.FILENAME[i] ;
+
+    if ( SHARED_TABLE_INFO.FD_LOCK[i] >= 0 ) {
+      unlink(shmFile);
+      close(SHARED_TABLE_INFO.FD_LOCK[i]);
+      SHARED_TABLE_INFO.FD_LOCK[i] = -1 ;
+    }
+    else {
+      // exclusive lock prevents another job from attaching while
+      // this job removes the segment.
+      fd = open(shmFile, O_RDWR);
+      if ( fd >= 0 ) { flock(fd, LOCK_EX); }
+      NATTACH = __sync_sub_and_fetch(&HEAD->NATTACH, 1);
+      if ( NATTACH <= 0 && fd >= 0 && fstat(fd,&STAT_SHM) == 0 &&
+	   (long long)STAT_SHM.st_ino == SHARED_TABLE_INFO.INODE[i] ) 
+	{ unlink(shmFile); }
+      if ( fd >= 0 ) { flock(fd, LOCK_UN); close(fd); }
+    }
+
+    if ( (void*)HEAD != SHARED_TABLE_INFO.MAP[i] ) 
+      { munmap(HEAD, sizeof(SHARED_TABLE_HEAD_DEF)); }
+    munmap(SHARED_TABLE_INFO.MAP[i], SHARED_TABLE_INFO.MAPSIZE[i]);
+  }
+
+  SHARED_TABLE_INFO.NTABLE = 0 ;
+  return ;
+
+} // end free_shared_tables
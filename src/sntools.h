@@ -46,6 +46,10 @@
   Jun 15 2022: MXCHARWORD_PARSE_WORDS -> MXPATHLEN + 200 
              (for long rows in FITRES or HOSTLIB)
 
+  Oct 16 2026: add shared-memory utility for large read-only tables
+               (malloc_shared_table) so that concurrent jobs on one
+               node share one copy of model & kcor tables.
+
 ********************************************************/
 
 
@@ -229,6 +233,15 @@ struct {
   double NWRAP_SUM[MXLIST_RAN+1] ;
   double NWRAP_SUMSQ[MXLIST_RAN+1] ;
 
+  // Oct 2026: optional counter-based randoms (Philox4x32-10) where
+  // each random is a function of (seed, event, fill, list, draw)
+  // instead of a lookup in RANSTORE. NSTORE_RAN is the draw counter.
+  bool          USE_CBRNG ;
+  unsigned int  CBRNG_KEY[2] ;   // from ISEED
+  unsigned int  CBRNG_EVENT ;    // event index (e.g., ilc in sim)
+  unsigned int  CBRNG_NFILL ;    // number of fill_RANLISTs for this event
+  unsigned long long CBRNG_NDRAW_UNIX[MXSTREAM_RAN] ; // unix_getRan draws
+
 } GENRAN_INFO ;
 
 
@@ -833,6 +846,13 @@ double host_confusion__(char *CID, int *N_DDLR, double *DDLR_LIST_SORTED);
 // May 2014: snran1 -> Flatran1,  float rangen -> double FlatRan
 void   init_random_seed(int ISEED, int NSTREAM);
 void   fill_RANLISTs(void);
+void   init_random_cbrng(int OPT);
+void   set_random_event(int EVENT);
+double cbrng_getRan_Flat1(unsigned int *KEY, unsigned int EVENT, 
+			  unsigned int NFILL, int ISLOT, 
+			  unsigned long long IDRAW);
+void   philox4x32_10(unsigned int *CTR, unsigned int *KEY, 
+		     unsigned int *OUT);
 void   sumstat_RANLISTs(int FLAG);
 // xxx double unix_random(int istream) ;
 // xxx double unix_GaussRan(int istream);
@@ -843,6 +863,7 @@ double unix_getRan_Gauss(int istream);
 double getRan_Flat(int ilist, double *range);  //return rnmd on range[0-1]
 double getRan_Flat1(int ilist);          // return 0 < random  < 1
 double getRan_Gauss(int ilist);   // return Gauss randon (sigma=1)
+void   getRan_GaussList(int ilist, int NRAN, double *RANLIST); // NRAN Gauss
 double getRan_GaussClip(int ilist, double ranGmin, double ranGmax);
 double getRan_GaussAsym(double siglo, double sighi, double peakinterval);
 int    getRan_Poisson(double mean);
@@ -942,4 +963,44 @@ float malloc_shortint2D(int opt, int LEN1, int LEN2,
 float malloc_shortint4D(int opt, int LEN1, int LEN2, int LEN3, int LEN4,
 			short int *****array4D );
 
+// Oct 2026: shared-memory tables. First job creates & fills a segment
+// in /dev/shm; other jobs with the same KEY attach read-only copy.
+// A segment with invalid header (stale) is removed and rebuilt.
+// Any failure returns NULL so that caller falls back to malloc.
+#define PREFIX_SHARED_TABLE  "/dev/shm/SNANA_TABLE"
+#define MAGIC_SHARED_TABLE   0x534E414E41544142   // 'SNANATAB'
+#define VERSION_SHARED_TABLE 1  // increment if header layout changes
+#define MXSHARED_TABLE       20
+#define MXCHAR_KEY_SHARED_TABLE  1024
+#define NTRY_STALE_SHARED_TABLE  10 // N tries before declaring stale
+
+typedef struct {
+  unsigned long long MAGIC ;
+  int  VERSION ;                 // VERSION_SHARED_TABLE of creator
+  int  UNUSED ;                  // keep SIZE 8-byte aligned
+  unsigned long long SIZE ;      // size of table, bytes (excludes header)
+  int  READY ;                   // set by creator after filling table
+  int  NATTACH ;                 // reference count of jobs using table
+  char KEY[MXCHAR_KEY_SHARED_TABLE] ; // full key to protect hash collision
+} SHARED_TABLE_HEAD_DEF ;
+
+struct {
+  int    USE ;                      // 1 -> use shared tables
+  int    NTABLE ;                   // number of segments used by this job
+  char   FILENAME[MXSHARED_TABLE][MXPATHLEN] ;
+  void  *MAP[MXSHARED_TABLE] ;     // start of mapped segment
+  size_t MAPSIZE[MXSHARED_TABLE] ;
+  SHARED_TABLE_HEAD_DEF *HEAD[MXSHARED_TABLE] ; // writable header map
+  void  *TABLE[MXSHARED_TABLE] ;   // start of table after header
+  int    FD_LOCK[MXSHARED_TABLE] ; // >=0 -> creator holds lock until ready
+  long long INODE[MXSHARED_TABLE]; // to avoid unlinking a newer segment
+  int    PID ;                      // only this process detaches (not forks)
+} SHARED_TABLE_INFO ;
+
+void  *malloc_shared_table(char *TAG, char *FILENAME, size_t SIZE, 
+			   bool *IS_OWNER);
+void   ready_shared_table(void *TABLE);
+void   free_shared_tables(void);
+int    index_shared_table(void *TABLE);
+
 // ============== END OF FILE =============
@@ -32,6 +32,10 @@
   The maps are prepared in a set of "prepare_kcor_table_XXX" functions, 
   and they are evaluated in a set of "eval_kcor_table_XXX functions. 
 
+  Oct 16 2026: 1D tables (KCOR, LCMAG, MWXT) can be placed in shared
+               memory (see malloc_kcor_table) so that concurrent jobs 
+               on a node share one copy.
+
 ***************************************************/
 
 #include "fitsio.h"
@@ -231,6 +235,7 @@ void  read_calib_open(void) {
   }
 
   printf("  Opened %s\n", kcorFile); fflush(stdout);
+  sprintf(CALIB_INFO.FILENAME_OPEN, "%s", kcorFile);
 
   return ;
 
@@ -814,8 +819,10 @@ void read_kcor_tables(void) {
   double KCOR_SHIFT;
 
   int MEMF    = NBINTOT * sizeof(float);
-  CALIB_INFO.KCORTABLE1D_F = (float*) malloc(MEMF);
-  for(k=0; k < NBINTOT; k++ ) { CALIB_INFO.KCORTABLE1D_F[k] = 9999.9; }
+  bool LOAD ;
+  CALIB_INFO.KCORTABLE1D_F = malloc_kcor_table("KCORTABLE1D", MEMF, &LOAD);
+  if ( LOAD ) 
+    { for(k=0; k < NBINTOT; k++ ) { CALIB_INFO.KCORTABLE1D_F[k] = 9999.9; } }
 
   // loop over kcor tables
   for(i=0; i < NKCOR_STORE; i++ ) {
@@ -849,6 +856,8 @@ void read_kcor_tables(void) {
     IBIN_FIRST  = get_1DINDEX(IDMAP_KCOR_TABLE, NKDIM_KCOR, IBKCOR);
     IBIN_LAST   = IBIN_FIRST + NROW - 1 ;
 
+    if ( !LOAD ) { continue; } // table filled by another job
+
     fits_read_col_flt(FP, icol, FIRSTROW, FIRSTELEM, NROW,
 		      NULL_1E, &CALIB_INFO.KCORTABLE1D_F[IBIN_FIRST], 
 		      &anynul, &istat )  ;      
@@ -864,10 +873,57 @@ void read_kcor_tables(void) {
 
   } // end i-loop to NKCOR_STORE
 
+  if ( LOAD ) { ready_shared_table(CALIB_INFO.KCORTABLE1D_F); }
+
   return ;
 
 } // end read_kcor_tables
 
+
+// =============================================
+float *malloc_kcor_table(char *NAME, int MEMF, bool *LOAD) {
+
+  // Created Oct 16 2026
+  // Return pointer to MEMF bytes for 1D kcor table NAME.
+  // If SHARED_TABLES option is set, use shared memory so that
+  // concurrent jobs on the same node share one copy; else malloc.
+  // Output *LOAD=true if caller must read the table; 
+  // *LOAD=false -> table was already filled by another job.
+  // 
+  // Since tables depend on the survey filters and on primary mag 
+  // shifts, these are included in the key that identifies the table.
+
+  int  ifilt;
+  bool IS_OWNER;
+  char TAG[MXCHAR_KEY_SHARED_TABLE], cshift[60];
+  float *TABLE ;
+
+  // ----------- BEGIN ------------
+
+  *LOAD = true ;
+
+  if ( SHARED_TABLE_INFO.USE ) {
+    sprintf(TAG,"%s FILTERS=%s", NAME, CALIB_INFO.FILTERS_SURVEY);
+    for(ifilt=0; ifilt < MXFILT_CALIB; ifilt++ ) {
+      if ( CALIB_INFO.MAGREST_SHIFT_PRIMARY[ifilt] == 0.0 &&
+	   CALIB_INFO.MAGOBS_SHIFT_PRIMARY[ifilt]  == 0.0 ) { continue; }
+      if ( strlen(TAG) > MXCHAR_KEY_SHARED_TABLE - 2*MXPATHLEN ) { break; }
+      sprintf(cshift," %d:%.6f,%.6f", ifilt, 
+	      CALIB_INFO.MAGREST_SHIFT_PRIMARY[ifilt],
+	      CALIB_INFO.MAGOBS_SHIFT_PRIMARY[ifilt] );
+      strcat(TAG,cshift);
+    }
+
+    TABLE = (float*)malloc_shared_table(TAG, CALIB_INFO.FILENAME_OPEN, 
+					(size_t)MEMF, &IS_OWNER);
+    if ( TABLE != NULL ) { *LOAD = IS_OWNER;  return TABLE; }
+  }
+
+  TABLE = (float*) malloc(MEMF);
+  return TABLE ;
+
+} // end malloc_kcor_table
+
 // ===========================
 int ISBXFILT_KCOR(char *cfilt) {
   // return true if BX is part of filter name
@@ -1245,11 +1301,14 @@ void read_kcor_mags(void) {
 
   int  NBINTOT_LCMAG   = NBIN_T * NBIN_z * NBIN_AV * NFILTDEF_REST;
   int  MEMF_LCMAG      = NBINTOT_LCMAG * sizeof(float);
-  CALIB_INFO.LCMAG_TABLE1D_F = (float*)malloc(MEMF_LCMAG);
+  bool LOAD_LCMAG, LOAD_MWXT ;
+  CALIB_INFO.LCMAG_TABLE1D_F = 
+    malloc_kcor_table("LCMAG_TABLE1D", MEMF_LCMAG, &LOAD_LCMAG);
 
   int  NBINTOT_MWXT    = NBIN_T * NBIN_z * NBIN_AV * NFILTDEF_OBS;
   int  MEMF_MWXT       = NBINTOT_MWXT * sizeof(float);
-  CALIB_INFO.MWXT_TABLE1D_F = (float*)malloc(MEMF_MWXT);
+  CALIB_INFO.MWXT_TABLE1D_F = 
+    malloc_kcor_table("MWXT_TABLE1D", MEMF_MWXT, &LOAD_MWXT);
 
   int istat=0, hdutype, anynul, ifilt, ifiltr, ifilto, IFILTDEF ;
   int MASK, ISREST, ISOBS, ICOL_LCMAG, ICOL_MWXT;
@@ -1265,7 +1324,11 @@ void read_kcor_mags(void) {
   fits_movrel_hdu(FP, 1, &hdutype, &istat);
   snfitsio_errorCheck("Cannot move to MAG table", istat);
 
-  if ( CALIB_INFO.NKCOR_STORE == 0 ) { return; }
+  if ( CALIB_INFO.NKCOR_STORE == 0 ) { 
+    ready_shared_table(CALIB_INFO.LCMAG_TABLE1D_F); // release lock
+    ready_shared_table(CALIB_INFO.MWXT_TABLE1D_F);
+    return; 
+  }
 
   NROW = NBIN_T * NBIN_z * NBIN_AV;
   for(ibin=0; ibin < N4DIM_KCOR; ibin++ ) 
@@ -1303,16 +1366,18 @@ void read_kcor_mags(void) {
 		CFILT, ifiltr, IFILTDEF);
 	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
       }
-      fits_read_col_flt(FP, ICOL_LCMAG, FIRSTROW, FIRSTELEM, NROW,
-			NULL_1E, &CALIB_INFO.LCMAG_TABLE1D_F[IBIN_FIRST], 
-			&anynul, &istat );
-      sprintf(c1err,"read LCMAG(%s)", CFILT);
-      snfitsio_errorCheck(c1err, istat);
-
-      // apply user mag-shifts
-      for(ibin=IBIN_FIRST; ibin<=IBIN_LAST; ibin++ ) {
-	CALIB_INFO.LCMAG_TABLE1D_F[ibin] += 
-	  ( CALIB_INFO.MAGREST_SHIFT_PRIMARY[IFILTDEF] - 19.6);	  
+      if ( LOAD_LCMAG ) {
+	fits_read_col_flt(FP, ICOL_LCMAG, FIRSTROW, FIRSTELEM, NROW,
+			  NULL_1E, &CALIB_INFO.LCMAG_TABLE1D_F[IBIN_FIRST], 
+			  &anynul, &istat );
+	sprintf(c1err,"read LCMAG(%s)", CFILT);
+	snfitsio_errorCheck(c1err, istat);
+
+	// apply user mag-shifts
+	for(ibin=IBIN_FIRST; ibin<=IBIN_LAST; ibin++ ) {
+	  CALIB_INFO.LCMAG_TABLE1D_F[ibin] += 
+	    ( CALIB_INFO.MAGREST_SHIFT_PRIMARY[IFILTDEF] - 19.6);	  
+	}
       }
     } // end ISREST
     
@@ -1333,16 +1398,20 @@ void read_kcor_mags(void) {
 		CFILT, ifilto, IFILTDEF);
 	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
       }
-      fits_read_col_flt(FP, ICOL_MWXT, FIRSTROW, FIRSTELEM, NROW,
-			NULL_1E, &CALIB_INFO.MWXT_TABLE1D_F[IBIN_FIRST],
-			&anynul, &istat );
-      sprintf(c1err,"read MWXT-slope(%s)", CFILT);
-      snfitsio_errorCheck(c1err, istat);
+      if ( LOAD_MWXT ) {
+	fits_read_col_flt(FP, ICOL_MWXT, FIRSTROW, FIRSTELEM, NROW,
+			  NULL_1E, &CALIB_INFO.MWXT_TABLE1D_F[IBIN_FIRST],
+			  &anynul, &istat );
+	sprintf(c1err,"read MWXT-slope(%s)", CFILT);
+	snfitsio_errorCheck(c1err, istat);
+      }
 
     } // end ISOBS    
 
   } // end ifilt loop
 
+  if ( LOAD_LCMAG ) { ready_shared_table(CALIB_INFO.LCMAG_TABLE1D_F); }
+  if ( LOAD_MWXT  ) { ready_shared_table(CALIB_INFO.MWXT_TABLE1D_F);  }
 
   /*xxxxxx dump entire table to compare with original fortran
   for(ibin=0; ibin < NBINTOT_LCMAG; ibin++ ) {
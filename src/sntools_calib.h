@@ -104,6 +104,7 @@ struct CALIB_INFO {
 
   // info passed to driver
   char FILENAME[MXPATHLEN] ;
+  char FILENAME_OPEN[MXPATHLEN] ; // file actually opened (Oct 2026)
   fitsfile *FP ;
 
   char FILTERS_SURVEY[MXFILT_CALIB]; // filter list read from SIMLIB file
@@ -208,6 +209,7 @@ void read_calib_primarysed(void);
 
 void read_kcor_mags(void);
 void read_kcor_tables(void);
+float *malloc_kcor_table(char *NAME, int MEMF, bool *LOAD);
 void read_kcor_binInfo(char *VARNAME, char *VARSYM, int MXBIN,
 		       KCOR_BININFO_DEF *BININFO) ;
 void fill_kcor_binInfo_C(void);
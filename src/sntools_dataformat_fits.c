@@ -65,6 +65,10 @@
 
  Jul 21 2021: write PHOTFLAG_DETECT to global header
 
+ Oct 16 2026: buffer HEAD & PHOT table rows in memory and write each
+              column in chunks (one fits_write_col per column per chunk);
+              optional I/O thread via WRITE_MASK_THREAD_FITS.
+
 **************************************************/
 
 #include "fitsio.h"
@@ -104,6 +108,7 @@ void WR_SNFITSIO_INIT(char *path, char *version, char *prefix, int writeFlag,
   // May 14 2020: set SNFITSIO_DATAFLAG
   // Sep 10 2020: begin refactor with BYOSED -> PySEDMODEL
   // Oct 14 2021: change simFlag to writeFlag that has spectra bit
+  // Oct 16 2026: init column buffers; check WRITE_MASK_THREAD_FITS
 
   int  MEMC = MXPATHLEN * sizeof(char);
   int  itype, ipar, OVP, lenpath, lenfile, lentot ;
@@ -223,6 +228,9 @@ void WR_SNFITSIO_INIT(char *path, char *version, char *prefix, int writeFlag,
   wr_snfitsio_init_head();
   wr_snfitsio_init_phot();
 
+  // Oct 2026: column buffers for HEAD & PHOT, and optional I/O thread
+  wr_snfitsio_init_buffer( (writeFlag & WRITE_MASK_THREAD_FITS) > 0 );
+
   if ( SNFITSIO_SPECTRA_FLAG ) {
     wr_snfitsio_create ( ITYPE_SNFITSIO_SPEC    ) ; 
     wr_snfitsio_create ( ITYPE_SNFITSIO_SPECTMP ) ; 
@@ -2237,6 +2245,9 @@ void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype ) {
   // Sep 20 2017: define logical ALLOW_BLANK to allow exceptions
   //              for the no-blank rule on strins. See SUBSURVEY.
   //
+  // Oct 16 2026: for HEAD & PHOT, copy value to column buffer
+  //              instead of calling fits_write_col for each cell.
+  //
   int istat, colnum, firstelem, firstrow, nrow, LEN, OPTMASK ;
   int LDMP = 0 ;
   fitsfile *fp ;
@@ -2278,6 +2289,14 @@ void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype ) {
       sprintf(c2err,"to colnum=%d of table=%s", colnum, snfitsType[itype]);
       errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
     }
+  }
+
+  // Oct 2026: copy value to column buffer (written later in chunks)
+  if ( WRBUF_SNFITSIO.USE[itype] ) {
+    if ( wr_snfitsio_fillBuffer(itype, colnum, firstrow) ) { return; }
+  }
+
+  if ( strcmp(clast,"A") == 0 ) {
     fits_write_col(fp, TSTRING, colnum, firstrow, firstelem, nrow,
 		   &WR_SNFITSIO_TABLEVAL[itype].value_A, &istat);  
   }
@@ -2319,6 +2338,385 @@ void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype ) {
 
 } //  end of wr_snfitsio_fillTable
 
+// ==================================================
+void wr_snfitsio_init_buffer(bool use_thread) {
+
+  // Created Oct 16 2026
+  // Allocate column buffers for HEAD and PHOT tables. 
+  // wr_snfitsio_fillTable copies each value into the buffer, and
+  // each column is written with one fits_write_col call per chunk
+  // of MXROW_WRBUF_[HEAD,PHOT] rows (instead of one call per cell).
+  // If use_thread=true, chunks are written by a separate I/O thread
+  // so that the caller does not wait for disk; requires cfitsio
+  // built with --enable-reentrant, and snana built without 
+  // -DNO_THREAD_SNFITSIO.
+
+  int  itype, icol, ibuf, MXROW, NBYTE, irow ;
+  char *form ;
+  SNFITSIO_WRBUF_DEF *BUF ;
+  char fnam[] = "wr_snfitsio_init_buffer" ;
+
+  // ------------- BEGIN -------------
+
+  WRTHREAD_SNFITSIO.USE    = false ;
+  WRTHREAD_SNFITSIO.STOP   = false ;
+  WRTHREAD_SNFITSIO.NQUEUE = WRTHREAD_SNFITSIO.IQUEUE = 0 ;
+
+  for(itype=0; itype < MXTYPE_SNFITSIO; itype++ ) {
+    WRBUF_SNFITSIO.USE[itype]    = false ;
+    WRBUF_SNFITSIO.ACTIVE[itype] = 0 ;
+    WRBUF_SNFITSIO.NFLUSH[itype] = 0 ;
+    MXROW = 0 ;
+    if ( itype == ITYPE_SNFITSIO_HEAD ) { MXROW = MXROW_WRBUF_HEAD; }
+    if ( itype == ITYPE_SNFITSIO_PHOT ) { MXROW = MXROW_WRBUF_PHOT; }
+    if ( MXROW == 0 ) { continue; }
+
+    for(ibuf=0; ibuf < 2; ibuf++ ) {
+      BUF = &WRBUF_SNFITSIO.BUF[itype][ibuf];
+      BUF->itype    = itype ;
+      BUF->NCOL     = NPAR_WR_SNFITSIO[itype] ;
+      BUF->MXROW    = MXROW ;
+      BUF->NROW     = 0 ;
+      BUF->FIRSTROW = 1 ;
+      BUF->BUSY     = false ;
+
+      for(icol=1; icol <= BUF->NCOL; icol++ ) {
+	form = WR_SNFITSIO_TABLEDEF[itype].ptrForm[icol];
+	BUF->PTR_A[icol]     = NULL ;
+	BUF->NROW_FILL[icol] = 0 ;
+
+	if ( form[strlen(form)-1] == 'A' ) {
+	  BUF->DATATYPE[icol] = TSTRING ;
+	  BUF->NBYTE[icol]    = atoi(form) + 1 ;
+	  if ( BUF->NBYTE[icol] < 2 ) { BUF->NBYTE[icol] = 2; }
+	}
+	else if ( strcmp(form,"1D") == 0 ) 
+	  { BUF->DATATYPE[icol] = TDOUBLE;    BUF->NBYTE[icol] = sizeof(double); }
+	else if ( strcmp(form,"1E") == 0 ) 
+	  { BUF->DATATYPE[icol] = TFLOAT;     BUF->NBYTE[icol] = sizeof(float); }
+	else if ( strcmp(form,"1J") == 0 ) 
+	  { BUF->DATATYPE[icol] = TINT;       BUF->NBYTE[icol] = sizeof(int); }
+	else if ( strcmp(form,"1I") == 0 ) 
+	  { BUF->DATATYPE[icol] = TSHORT;     BUF->NBYTE[icol] = sizeof(short); }
+	else if ( strcmp(form,"1K") == 0 ) 
+	  { BUF->DATATYPE[icol] = TLONGLONG;  BUF->NBYTE[icol] = sizeof(long long);}
+	else {
+	  // unknown form -> no buffer; fillTable will abort
+	  BUF->NCOL = icol-1;  break; 
+	}
+
+	NBYTE = BUF->NBYTE[icol];
+	BUF->VALUES[icol] = (char*) calloc(MXROW, NBYTE);
+	if ( BUF->DATATYPE[icol] == TSTRING ) {
+	  BUF->PTR_A[icol] = (char**) malloc(MXROW*sizeof(char*));
+	  for(irow=0; irow < MXROW; irow++ ) 
+	    { BUF->PTR_A[icol][irow] = &BUF->VALUES[icol][irow*NBYTE]; }
+	}
+      } // end icol
+    } // end ibuf
+
+    WRBUF_SNFITSIO.USE[itype] = 
+      ( WRBUF_SNFITSIO.BUF[itype][0].NCOL == NPAR_WR_SNFITSIO[itype] );
+  } // end itype
+
+  // - - - - - - 
+  // check option for I/O thread
+  if ( use_thread ) {
+#ifdef USE_THREAD_SNFITSIO
+    if ( fits_is_reentrant() ) {
+      WRTHREAD_SNFITSIO.USE = true ;
+      pthread_mutex_init(&WRTHREAD_SNFITSIO.MUTEX, NULL);
+      pthread_cond_init(&WRTHREAD_SNFITSIO.COND, NULL);
+      pthread_create(&WRTHREAD_SNFITSIO.THREAD, NULL, 
+		     wr_snfitsio_thread, NULL);
+    }
+    else {
+      printf("\t WARNING: cfitsio is not reentrant -> "
+	     "no I/O thread for FITS writes.\n");
+    }
+#else
+    printf("\t WARNING: built with NO_THREAD_SNFITSIO -> "
+	   "no I/O thread for FITS writes.\n");
+#endif
+  }
+
+  printf("\t Buffer %d HEAD rows and %d PHOT rows per FITS write "
+	 "(I/O thread=%d)\n",
+	 MXROW_WRBUF_HEAD, MXROW_WRBUF_PHOT,
+	 WRTHREAD_SNFITSIO.USE );
+  fflush(stdout);
+
+  return ;
+
+} // end wr_snfitsio_init_buffer
+
+
+// ==================================================
+int wr_snfitsio_fillBuffer(int itype, int colnum, long firstrow) {
+
+  // Created Oct 16 2026
+  // Copy current WR_SNFITSIO_TABLEVAL[itype] value for column colnum
+  // into buffer row for FITS table row firstrow.
+  // If buffer is full, flush it first. 
+  // Return 1 if value is buffered; return 0 if row is already
+  // written, in which case caller must use fits_write_col directly.
+
+  SNFITSIO_WRBUF_DEF *BUF ;
+  int  irow, NBYTE ;
+  char *ptrVal ;
+
+  // ------------- BEGIN -------------
+
+  BUF = &WRBUF_SNFITSIO.BUF[itype][WRBUF_SNFITSIO.ACTIVE[itype]];
+  if ( BUF->NROW == 0 ) { BUF->FIRSTROW = firstrow; }
+
+  irow = (int)(firstrow - BUF->FIRSTROW) ;
+  if ( irow < 0 ) { wr_snfitsio_waitBuffer(itype);  return 0; }
+
+  if ( irow >= BUF->MXROW ) {
+    wr_snfitsio_flushBuffer(itype);
+    BUF = &WRBUF_SNFITSIO.BUF[itype][WRBUF_SNFITSIO.ACTIVE[itype]];
+    BUF->FIRSTROW = firstrow ;
+    irow = 0 ;
+  }
+
+  NBYTE  = BUF->NBYTE[colnum] ;
+  ptrVal = &BUF->VALUES[colnum][irow*NBYTE] ;
+
+  switch ( BUF->DATATYPE[colnum] ) {
+  case TSTRING :
+    strncpy(ptrVal, WR_SNFITSIO_TABLEVAL[itype].value_A, NBYTE-1);
+    ptrVal[NBYTE-1] = 0 ;
+    break;
+  case TDOUBLE :
+    memcpy(ptrVal, &WR_SNFITSIO_TABLEVAL[itype].value_1D, NBYTE); break;
+  case TFLOAT :
+    memcpy(ptrVal, &WR_SNFITSIO_TABLEVAL[itype].value_1E, NBYTE); break;
+  case TINT :
+    memcpy(ptrVal, &WR_SNFITSIO_TABLEVAL[itype].value_1J, NBYTE); break;
+  case TSHORT :
+    memcpy(ptrVal, &WR_SNFITSIO_TABLEVAL[itype].value_1I, NBYTE); break;
+  case TLONGLONG :
+    memcpy(ptrVal, &WR_SNFITSIO_TABLEVAL[itype].value_1K, NBYTE); break;
+  }
+
+  if ( irow >= BUF->NROW_FILL[colnum] ) { BUF->NROW_FILL[colnum] = irow+1; }
+  if ( irow >= BUF->NROW )              { BUF->NROW = irow+1; }
+
+  return 1 ;
+
+} // end wr_snfitsio_fillBuffer
+
+
+// ==================================================
+void wr_snfitsio_flushBuffer(int itype) {
+
+  // Created Oct 16 2026
+  // Write active buffer for itype, either directly or by handing it
+  // to the I/O thread. With I/O thread, switch to other buffer and 
+  // wait only if that buffer is still being written; queue length 
+  // is bounded by MXQUEUE_WRBUF_SNFITSIO.
+
+  int  iact = WRBUF_SNFITSIO.ACTIVE[itype] ;
+  SNFITSIO_WRBUF_DEF *BUF = &WRBUF_SNFITSIO.BUF[itype][iact] ;
+  long NEXTROW ;
+
+  // ------------- BEGIN -------------
+
+  if ( !WRBUF_SNFITSIO.USE[itype] ) { return; }
+  if ( BUF->NROW == 0 ) { return; }
+
+  WRBUF_SNFITSIO.NFLUSH[itype]++ ;
+  NEXTROW = BUF->FIRSTROW + BUF->NROW ;
+
+  if ( !WRTHREAD_SNFITSIO.USE ) {
+    wr_snfitsio_writeBuffer(BUF);
+    BUF->FIRSTROW = NEXTROW ;
+    return ;
+  }
+
+#ifdef USE_THREAD_SNFITSIO
+  int MXQ = MXQUEUE_WRBUF_SNFITSIO, iq ;
+  pthread_mutex_lock(&WRTHREAD_SNFITSIO.MUTEX);
+  while ( WRTHREAD_SNFITSIO.NQUEUE == MXQ ) 
+    { pthread_cond_wait(&WRTHREAD_SNFITSIO.COND, &WRTHREAD_SNFITSIO.MUTEX); }
+
+  BUF->BUSY = true ;
+  iq = (WRTHREAD_SNFITSIO.IQUEUE + WRTHREAD_SNFITSIO.NQUEUE) % MXQ ;
+  WRTHREAD_SNFITSIO.QUEUE[iq] = BUF ;
+  WRTHREAD_SNFITSIO.NQUEUE++ ;
+  pthread_cond_broadcast(&WRTHREAD_SNFITSIO.COND);
+
+  // switch to other buffer
+  iact = 1 - iact ;
+  WRBUF_SNFITSIO.ACTIVE[itype] = iact ;
+  BUF  = &WRBUF_SNFITSIO.BUF[itype][iact] ;
+  while ( BUF->BUSY ) 
+    { pthread_cond_wait(&WRTHREAD_SNFITSIO.COND, &WRTHREAD_SNFITSIO.MUTEX); }
+  pthread_mutex_unlock(&WRTHREAD_SNFITSIO.MUTEX);
+
+  BUF->FIRSTROW = NEXTROW ;
+#endif
+
+  return ;
+
+} // end wr_snfitsio_flushBuffer
+
+
+// ==================================================
+void wr_snfitsio_writeBuffer(SNFITSIO_WRBUF_DEF *BUF) {
+
+  // Created Oct 16 2026
+  // Write each buffered column with one fits_write_col call,
+  // then reset buffer. May be called from I/O thread.
+
+  int  itype = BUF->itype ;
+  fitsfile *fp = fp_wr_snfitsio[itype] ;
+  int  icol, nrow, istat = 0 ;
+  void *ptrVal ;
+  char BANNER[200] ; // local: c1err is not thread safe
+  char fnam[] = "wr_snfitsio_writeBuffer" ;
+
+  // ------------- BEGIN -------------
+
+  for(icol=1; icol <= BUF->NCOL; icol++ ) {
+    nrow = BUF->NROW_FILL[icol] ;
+    if ( nrow == 0 ) { continue; }
+
+    if ( BUF->DATATYPE[icol] == TSTRING ) 
+      { ptrVal = BUF->PTR_A[icol]; }
+    else
+      { ptrVal = BUF->VALUES[icol]; }
+
+    fits_write_col(fp, BUF->DATATYPE[icol], icol, BUF->FIRSTROW, 1, nrow,
+		   ptrVal, &istat);
+    snprintf(BANNER, 200, "fits_write_col for %s-param: %s (%d rows)",
+	     snfitsType[itype], WR_SNFITSIO_TABLEDEF[itype].ptrName[icol], 
+	     nrow );
+    snfitsio_errorCheck(BANNER, istat);
+
+    // clear so that unfilled cells in next chunk are zero/blank
+    memset(BUF->VALUES[icol], 0, nrow*BUF->NBYTE[icol]);
+    BUF->NROW_FILL[icol] = 0 ;
+  }
+
+  BUF->NROW = 0 ;
+
+  return ;
+
+} // end wr_snfitsio_writeBuffer
+
+
+// ==================================================
+void *wr_snfitsio_thread(void *arg) {
+
+  // Created Oct 16 2026
+  // I/O thread: write queued buffers in FIFO order until STOP is set
+  // and the queue is empty.
+
+  SNFITSIO_WRBUF_DEF *BUF ;
+  int MXQ = MXQUEUE_WRBUF_SNFITSIO ;
+
+  // ------------- BEGIN -------------
+
+#ifdef USE_THREAD_SNFITSIO
+  pthread_mutex_lock(&WRTHREAD_SNFITSIO.MUTEX);
+  while ( 1 ) {
+    while ( WRTHREAD_SNFITSIO.NQUEUE == 0 && !WRTHREAD_SNFITSIO.STOP ) 
+      { pthread_cond_wait(&WRTHREAD_SNFITSIO.COND, &WRTHREAD_SNFITSIO.MUTEX);}
+    if ( WRTHREAD_SNFITSIO.NQUEUE == 0 ) { break; }
+
+    BUF = WRTHREAD_SNFITSIO.QUEUE[WRTHREAD_SNFITSIO.IQUEUE];
+    WRTHREAD_SNFITSIO.IQUEUE = (WRTHREAD_SNFITSIO.IQUEUE + 1) % MXQ ;
+    WRTHREAD_SNFITSIO.NQUEUE-- ;
+    pthread_cond_broadcast(&WRTHREAD_SNFITSIO.COND);
+    pthread_mutex_unlock(&WRTHREAD_SNFITSIO.MUTEX);
+
+    wr_snfitsio_writeBuffer(BUF);
+
+    pthread_mutex_lock(&WRTHREAD_SNFITSIO.MUTEX);
+    BUF->BUSY = false ;
+    pthread_cond_broadcast(&WRTHREAD_SNFITSIO.COND);
+  }
+  pthread_mutex_unlock(&WRTHREAD_SNFITSIO.MUTEX);
+#endif
+
+  return NULL ;
+
+} // end wr_snfitsio_thread
+
+
+// ==================================================
+void wr_snfitsio_waitBuffer(int itype) {
+
+  // Created Oct 16 2026
+  // Wait until I/O thread has finished writing both buffers for itype.
+
+  // ------------- BEGIN -------------
+
+  if ( !WRTHREAD_SNFITSIO.USE ) { return; }
+
+#ifdef USE_THREAD_SNFITSIO
+  pthread_mutex_lock(&WRTHREAD_SNFITSIO.MUTEX);
+  while ( WRBUF_SNFITSIO.BUF[itype][0].BUSY || 
+	  WRBUF_SNFITSIO.BUF[itype][1].BUSY ) 
+    { pthread_cond_wait(&WRTHREAD_SNFITSIO.COND, &WRTHREAD_SNFITSIO.MUTEX); }
+  pthread_mutex_unlock(&WRTHREAD_SNFITSIO.MUTEX);
+#endif
+
+  return ;
+
+} // end wr_snfitsio_waitBuffer
+
+
+// ==================================================
+void wr_snfitsio_end_buffer(void) {
+
+  // Created Oct 16 2026
+  // Flush remaining rows, stop I/O thread, and free buffers.
+  // Must be called before FITS files are closed.
+
+  int itype, ibuf, icol ;
+  SNFITSIO_WRBUF_DEF *BUF ;
+
+  // ------------- BEGIN -------------
+
+  for(itype=0; itype < MXTYPE_SNFITSIO; itype++ ) 
+    { wr_snfitsio_flushBuffer(itype); }
+
+#ifdef USE_THREAD_SNFITSIO
+  if ( WRTHREAD_SNFITSIO.USE ) {
+    pthread_mutex_lock(&WRTHREAD_SNFITSIO.MUTEX);
+    WRTHREAD_SNFITSIO.STOP = true ;
+    pthread_cond_broadcast(&WRTHREAD_SNFITSIO.COND);
+    pthread_mutex_unlock(&WRTHREAD_SNFITSIO.MUTEX);
+    pthread_join(WRTHREAD_SNFITSIO.THREAD, NULL);
+    pthread_mutex_destroy(&WRTHREAD_SNFITSIO.MUTEX);
+    pthread_cond_destroy(&WRTHREAD_SNFITSIO.COND);
+    WRTHREAD_SNFITSIO.USE = false ;
+  }
+#endif
+
+  for(itype=0; itype < MXTYPE_SNFITSIO; itype++ ) {
+    if ( !WRBUF_SNFITSIO.USE[itype] ) { continue; }
+    printf("\t Wrote %s table in %d chunks.\n", 
+	   snfitsType[itype], WRBUF_SNFITSIO.NFLUSH[itype] );
+    for(ibuf=0; ibuf < 2; ibuf++ ) {
+      BUF = &WRBUF_SNFITSIO.BUF[itype][ibuf];
+      for(icol=1; icol <= BUF->NCOL; icol++ ) {
+	free(BUF->VALUES[icol]);
+	if ( BUF->PTR_A[icol] != NULL ) { free(BUF->PTR_A[icol]); }
+      }
+    }
+    WRBUF_SNFITSIO.USE[itype] = false ;
+  }
+  fflush(stdout);
+
+  return ;
+
+} // end wr_snfitsio_end_buffer
+
+
 
 
 // ====================================
@@ -2784,6 +3182,9 @@ void WR_SNFITSIO_END(int OPTMASK) {
 	 fnam, NSNLC_WR_SNFITSIO_TOT, NSPEC_WR_SNFITSIO_TOT);
   fflush(stdout);
 
+  // write remaining buffered rows before closing (Oct 2026)
+  wr_snfitsio_end_buffer();
+
   NTYPE = 2 ; // defult is HEAD + PHOT
 
   if ( SNFITSIO_SPECTRA_FLAG ) {
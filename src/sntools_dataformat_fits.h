@@ -14,6 +14,8 @@
   Mar 07 2022: 
     split IFILE_SNFITSIO into IFILE_RD_SNFITSIO and IFILE_WR_SNFITSIO;
     Same for NFILE_SNFITSIO.
+  Oct 16 2026: define column buffers (WRBUF_SNFITSIO) for HEAD & PHOT
+               tables, and optional I/O thread (WRTHREAD_SNFITSIO).
 
 **************************************************/
 
@@ -179,6 +181,56 @@ int IPAR_SNFITSIO_PTROBS_MAX ;
 
 #define  stringBlank " " ;
 
+
+// Oct 2026: column buffers to write HEAD & PHOT tables in large chunks
+// instead of one fits_write_col call per table cell. Each itype has 
+// two buffers so that one can be filled while the other is written
+// by optional I/O thread. I/O thread is compiled by default; 
+// build with -DNO_THREAD_SNFITSIO to remove pthread calls.
+#ifndef NO_THREAD_SNFITSIO
+#define USE_THREAD_SNFITSIO
+#include <pthread.h>
+#endif
+
+#define MXROW_WRBUF_HEAD  2000   // HEAD rows per buffer
+#define MXROW_WRBUF_PHOT 50000   // PHOT rows per buffer
+#define MXQUEUE_WRBUF_SNFITSIO  4  // max buffers waiting for I/O thread
+
+typedef struct {
+  int   itype ;
+  int   NCOL ;            // number of table columns
+  int   MXROW ;           // max number of rows in buffer
+  int   NROW ;            // number of rows filled in buffer
+  long  FIRSTROW ;        // FITS table row for first buffer row
+  bool  BUSY ;            // true -> queued or being written by I/O thread
+
+  int   DATATYPE[MXPAR_SNFITSIO] ;    // TSTRING, TDOUBLE, TFLOAT ...
+  int   NBYTE[MXPAR_SNFITSIO] ;       // bytes per cell
+  int   NROW_FILL[MXPAR_SNFITSIO] ;   // 1 + last filled row (0 -> empty)
+  char *VALUES[MXPAR_SNFITSIO] ;      // [MXROW*NBYTE]
+  char **PTR_A[MXPAR_SNFITSIO] ;      // [MXROW] pointers for TSTRING
+} SNFITSIO_WRBUF_DEF ;
+
+struct {
+  bool  USE[MXTYPE_SNFITSIO] ;
+  int   ACTIVE[MXTYPE_SNFITSIO] ;  // which of 2 buffers is being filled
+  SNFITSIO_WRBUF_DEF BUF[MXTYPE_SNFITSIO][2] ;
+  int   NFLUSH[MXTYPE_SNFITSIO] ;  // number of chunks written
+} WRBUF_SNFITSIO ;
+
+struct {
+  bool USE ;    // true -> write buffers on I/O thread
+  bool STOP ;   // tell I/O thread to finish
+  int  NQUEUE, IQUEUE ;  // number in queue, index of oldest
+  SNFITSIO_WRBUF_DEF *QUEUE[MXQUEUE_WRBUF_SNFITSIO] ;
+#ifdef USE_THREAD_SNFITSIO
+  pthread_t       THREAD ;
+  pthread_mutex_t MUTEX ;
+  pthread_cond_t  COND ;
+#endif
+} WRTHREAD_SNFITSIO ;
+
+
 // maks of epochs to store in RD_SNFITSIO_PARVAL function
 // Default is all epochs unless SET_RDMASK_SNFITSIO is called
 // with some epochs masked out.
@@ -237,6 +289,14 @@ void wr_snfitsio_update_phot(int ep);
 void wr_snfitsio_update_spec(int imjd);
 void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype );
 
+void  wr_snfitsio_init_buffer(bool use_thread);
+int   wr_snfitsio_fillBuffer(int itype, int colnum, long firstrow);
+void  wr_snfitsio_flushBuffer(int itype);
+void  wr_snfitsio_writeBuffer(SNFITSIO_WRBUF_DEF *BUF);
+void  wr_snfitsio_waitBuffer(int itype);
+void  wr_snfitsio_end_buffer(void);
+void *wr_snfitsio_thread(void *arg);
+
 void WR_SNFITSIO_END(int OPTMASK);
 
 void rd_snfitsFile_close(int ifile, int itype);
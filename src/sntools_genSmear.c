@@ -89,6 +89,12 @@
    + refactor correlated Gauss randoms to use init_Cholesky and
      GaussRanCorr utilities.
 
+ Oct 16 2026
+   + GENMAG_SMEAR_MSKOPT += 64 -> tabulate node weights vs. rest-frame
+     wavelength (GENSMEAR_PROJ) for G10, C11, VCR and COVSED models.
+   + repeat_genSmear uses per-event GENSMEAR_CACHE of magSmear arrays
+     instead of checking only the last call.
+
 **********************************/
 
 #include "fitsio.h"
@@ -119,6 +125,7 @@ void  init_genSmear_FLAGS(int MSKOPT, char *SCALE_STRING) {
   // Mar 22 2020: 
   //  replace double SCALE with string that may have polynom funct
 
+  int  j;
   char fnam[] = "init_genSmear_FLAGS" ;
 
   GENSMEAR.NUSE           = 0 ; // number of GENSMEAR init calls
@@ -139,6 +146,17 @@ void  init_genSmear_FLAGS(int MSKOPT, char *SCALE_STRING) {
   GENSMEAR.NSET_RANFlat   = 0 ;
   GENSMEAR.MSKOPT         = MSKOPT ; // Oct 2019
 
+  // Oct 2026: option to tabulate node weights vs. wavelength
+  GENSMEAR_PROJ.USE  = ( (MSKOPT & MSKOPT_GENSMEAR_PROJ) > 0 );
+  GENSMEAR_PROJ.NBIN = 0 ; // table is made on first get_genSmear_XXX call
+
+  GENSMEAR_CACHE.NENTRY = GENSMEAR_CACHE.INEXT = 0 ;
+  GENSMEAR_CACHE.NHIT   = GENSMEAR_CACHE.NMISS = 0 ;
+  for(j=0; j < MXENTRY_GENSMEAR_CACHE; j++ ) {
+    GENSMEAR_CACHE.MXLAM[j]    = 0 ;
+    GENSMEAR_CACHE.MAGSMEAR[j] = NULL ;
+  }
+
   // hard-wire wavelengths to monitor COVARIANCE between 
   // 2 arbitrary wavelengths
   GENSMEAR.SUMSMEAR_CHECK[0]   =  0.0 ;
@@ -280,6 +298,7 @@ void load_genSmear_randoms(int CID, double gmin, double gmax, double RANFIX) {
   // ------------- BEGIN ------------
 
   GENSMEAR.CID = CID;
+  GENSMEAR_CACHE.NENTRY = GENSMEAR_CACHE.INEXT = 0 ; // Oct 2026
 
   // generate Guassian randoms for intrinsic scatter [genSmear] model
   if ( NRANGauss < MXFILTINDX-1 ) { NRANGauss = MXFILTINDX-1; } 
@@ -345,6 +364,8 @@ void get_genSmear(double *parList, int NLam, double *Lam,
   // Nov 30 2019: MAGSMEAR_COH -> MAGSMEAR_COH[2]
   // Feb 17 2020: add c & x1 input args
   // May 31 2021: refactor to pass parList that includes logMass
+  // Oct 16 2026: repeat_genSmear loads magSmear from per-event cache,
+  //              and new magSmear is stored in cache.
 
   double Trest   = parList[0];
   double x1      = parList[1];
@@ -358,7 +379,7 @@ void get_genSmear(double *parList, int NLam, double *Lam,
 
   GENSMEAR.NCALL++ ;
 
-  repeat = repeat_genSmear(Trest,NLam,Lam);
+  repeat = repeat_genSmear(Trest,NLam,Lam,magSmear);
   if ( repeat ) {  goto SET_LAST; }
 
   // abort if more than one model has been initialized.
@@ -416,6 +437,7 @@ void get_genSmear(double *parList, int NLam, double *Lam,
     for(ilam=0; ilam < NLam; ilam++ ) { magSmear[ilam] *= SCALE ; }
   }
 
+  store_genSmear_CACHE(Trest, NLam, Lam, magSmear);
 
  SET_LAST:
   GENSMEAR.CID_LAST    = GENSMEAR.CID ;
@@ -430,7 +452,7 @@ void get_genSmear(double *parList, int NLam, double *Lam,
 
 
 // ********************************************************
-int repeat_genSmear(double Trest, int NLam, double *Lam) {
+int repeat_genSmear(double Trest, int NLam, double *Lam, double *magSmear) {
   
   // Created Oct 21 2019
   // Return 0 --> get_genSmear returns new set of magSmear values
@@ -440,43 +462,114 @@ int repeat_genSmear(double Trest, int NLam, double *Lam) {
   //   GENMAG_SMEAR_MSKOPT:  32
   // then always return NEW (no repeats).
   //
+  // Oct 16 2026: 
+  //  + search per-event GENSMEAR_CACHE (all previous lambda grids for
+  //    this event) instead of checking only the last call, and load
+  //    output magSmear array from cache. Trest is part of the key for
+  //    Trest-dependent models (USRFUN).
+  //  + 1 lam bin (central filter wavelength) is cached too.
 
   int REPEAT  = 1;
   int NEW     = 0;
   int LDMP    = 0 ;
+  bool USE_TREST = ( GENSMEAR_USRFUN.USE > 0 );
   double LAMMIN = Lam[0];
   double LAMMAX = Lam[NLam-1];
+  int    ientry, ilam ;
   //  char fnam[] = "repeat_genSmear";
 
   // ------------ BEGIN ------------
 
-  // for 1 lam bin, it's central filter wavelength,
-  // so always re-calculate.
-  if ( NLam == 1 ) { return(NEW); }
-
   if ( (GENSMEAR.MSKOPT & 32 )>0 ) { return(NEW); }
 
   if ( LDMP ) {
     printf(" xxx ---------------------------------- \n");
-    printf(" xxx CID(%d,%d)  Trest(%.2f,%.2f) \n",
-	   GENSMEAR.CID, GENSMEAR.CID_LAST,  Trest, GENSMEAR.TREST_LAST ) ;
+    printf(" xxx CID(%d,%d)  Trest(%.2f,%.2f)  NENTRY=%d \n",
+	   GENSMEAR.CID, GENSMEAR.CID_LAST,  Trest, GENSMEAR.TREST_LAST,
+	   GENSMEAR_CACHE.NENTRY ) ;
     printf(" xxx LAMMIN(%.1f,%.1f)  LAMMAX(%.1f,%.1f) \n"
 	   ,LAMMIN, GENSMEAR.LAMMIN_LAST
 	   ,LAMMAX, GENSMEAR.LAMMAX_LAST );
     fflush(stdout);
   }
   
-  if ( GENSMEAR.CID != GENSMEAR.CID_LAST    ) { return(NEW); }
-  if ( LAMMIN       != GENSMEAR.LAMMIN_LAST ) { return(NEW); }
-  if ( LAMMAX       != GENSMEAR.LAMMAX_LAST ) { return(NEW); }
-
-  if ( LDMP ) { printf(" xxx REPEAT \n"); fflush(stdout); }
+  if ( GENSMEAR.CID != GENSMEAR.CID_LAST ) 
+    { GENSMEAR_CACHE.NENTRY = GENSMEAR_CACHE.INEXT = 0 ; }
+
+  for(ientry=0; ientry < GENSMEAR_CACHE.NENTRY; ientry++ ) {
+    if ( NLam   != GENSMEAR_CACHE.NLAM[ientry]   ) { continue; }
+    if ( LAMMIN != GENSMEAR_CACHE.LAMMIN[ientry] ) { continue; }
+    if ( LAMMAX != GENSMEAR_CACHE.LAMMAX[ientry] ) { continue; }
+    if ( USE_TREST && Trest != GENSMEAR_CACHE.TREST[ientry] ) { continue; }
+
+    if ( magSmear != GENSMEAR_CACHE.MAGSMEAR[ientry] ) {
+      for(ilam=0; ilam < NLam; ilam++ ) 
+	{ magSmear[ilam] = GENSMEAR_CACHE.MAGSMEAR[ientry][ilam]; }
+    }
+    GENSMEAR_CACHE.NHIT++ ;
+    if ( LDMP ) { printf(" xxx REPEAT (ientry=%d)\n", ientry); fflush(stdout); }
+    return(REPEAT);
+  }
 
-  return(REPEAT);
+  GENSMEAR_CACHE.NMISS++ ;
+  return(NEW);
 
 } // end repeat_genSmear
 
 
+// ********************************************************
+void store_genSmear_CACHE(double Trest, int NLam, double *Lam, 
+			  double *magSmear) {
+
+  // Created Oct 16 2026
+  // Store magSmear array for this lambda grid in per-event cache.
+  // When cache is full, overwrite oldest entry.
+
+  int ientry, ilam ;
+
+  // ------------ BEGIN ------------
+
+  if ( (GENSMEAR.MSKOPT & 32 )>0 ) { return; }
+
+  ientry = GENSMEAR_CACHE.INEXT ;
+  GENSMEAR_CACHE.INEXT = (ientry+1) % MXENTRY_GENSMEAR_CACHE ;
+  if ( GENSMEAR_CACHE.NENTRY < MXENTRY_GENSMEAR_CACHE ) 
+    { GENSMEAR_CACHE.NENTRY++ ; }
+
+  if ( NLam > GENSMEAR_CACHE.MXLAM[ientry] ) {
+    GENSMEAR_CACHE.MXLAM[ientry]    = NLam ;
+    GENSMEAR_CACHE.MAGSMEAR[ientry] = (double*)
+      realloc(GENSMEAR_CACHE.MAGSMEAR[ientry], NLam*sizeof(double) );
+  }
+
+  GENSMEAR_CACHE.NLAM[ientry]   = NLam ;
+  GENSMEAR_CACHE.TREST[ientry]  = Trest ;
+  GENSMEAR_CACHE.LAMMIN[ientry] = Lam[0] ;
+  GENSMEAR_CACHE.LAMMAX[ientry] = Lam[NLam-1] ;
+  for(ilam=0; ilam < NLam; ilam++ ) 
+    { GENSMEAR_CACHE.MAGSMEAR[ientry][ilam] = magSmear[ilam]; }
+
+  return ;
+
+} // end store_genSmear_CACHE
+
+
+// ********************************************************
+void summary_genSmear_CACHE(void) {
+
+  // Created Oct 16 2026
+  long long NHIT = GENSMEAR_CACHE.NHIT ;
+  long long NTOT = NHIT + GENSMEAR_CACHE.NMISS ;
+  // ------------ BEGIN ------------
+
+  if ( NTOT == 0 ) { return; }
+  printf("\t genSmear cache: hit rate = %.3f (%lld of %lld calls) \n",
+	 (double)NHIT/(double)NTOT, NHIT, NTOT);
+  fflush(stdout);
+
+} // end summary_genSmear_CACHE
+
+
 // ***********************************
 void init_genSmear_COVLAM_debug(double *lam, double COVMAT[2][2]) {
 
@@ -1563,6 +1656,27 @@ void get_genSmear_SALT2(double Trest, int NLam, double *Lam,
     GENSMEAR.MAGSMEAR_COH[0] = SMEAR0; // load global for SNTABLE (Jun 14 2016)
   }
 
+  // Oct 2026: check option for tabulated node weights
+  if ( GENSMEAR_PROJ.USE && NBCOH == 1 ) {
+    int NNODE = GENSMEAR_SALT2.NNODE ;
+    double NODEVAL[MXLAM_GENSMEAR_SALT2];
+    if ( GENSMEAR_PROJ.NBIN == 0 ) {
+      init_genSmear_PROJ(NNODE, GENSMEAR_SALT2.LAM_NODE, 
+			 OPT_GENSMEAR_PROJ_SIN);
+    }
+    for(INODE=0; INODE < NNODE; INODE++ ) {
+      NODEVAL[INODE] = 
+	GENSMEAR.RANGauss_LIST[INODE] * GENSMEAR_SALT2.SIG_NODE[INODE] ;
+    }
+    for ( ilam=0; ilam < NLam; ilam++ ) {
+      lam = Lam[ilam];   magSmear[ilam] = SMEAR0 ;
+      if ( lam <= (MINLAM+0.001) ) { continue ; }
+      if ( lam >= (MAXLAM-0.001) ) { continue ; }
+      magSmear[ilam] += eval_genSmear_PROJ(lam, NODEVAL);
+    }
+    return ;
+  }
+
 
   for ( ilam=0; ilam < NLam; ilam++ ) {
     lam = Lam[ilam];    
@@ -1812,6 +1926,15 @@ void get_genSmear_Chotard11(double Trest, int NLam, double *Lam,
   getRan_GaussCorr(&GENSMEAR_C11.DECOMP, GENSMEAR.RANGauss_LIST, // (I)
 		   SCATTER_VALUES );            // (O)
 
+  // Oct 2026: check option for tabulated node weights
+  if ( GENSMEAR_PROJ.USE ) {
+    if ( GENSMEAR_PROJ.NBIN == 0 ) 
+      { init_genSmear_PROJ(NBAND_C11, LAMCEN, OPT_GENSMEAR_PROJ_SIN); }
+    for ( ilam=0; ilam < NLam; ilam++ ) 
+      { magSmear[ilam] = eval_genSmear_PROJ(Lam[ilam], SCATTER_VALUES); }
+    return ;
+  }
+
   // -------------
   for ( ilam=0; ilam < NLam; ilam++ ) {
 
@@ -2493,6 +2616,15 @@ void get_genSmear_VCR(double Trest, int NLam, double *Lam,
 
   } // end of iband
 
+  // Oct 2026: check option for tabulated node weights
+  if ( GENSMEAR_PROJ.USE ) {
+    if ( GENSMEAR_PROJ.NBIN == 0 ) 
+      { init_genSmear_PROJ(NBAND, LAMCEN, OPT_GENSMEAR_PROJ_SIN); }
+    for ( ilam=0; ilam < NLam; ilam++ ) 
+      { magSmear[ilam] = eval_genSmear_PROJ(Lam[ilam], MAGSMEAR); }
+    return ;
+  }
+
 
   // -------------
   for ( ilam=0; ilam < NLam; ilam++ ) {
@@ -3503,6 +3635,19 @@ void get_genSmear_COVSED(double Trest, int NWAVE, double *WAVE,
   getRan_GaussCorr(&GENSMEAR_COVSED.DECOMP, GENSMEAR.RANGauss_LIST, // (I)
 		   GENSMEAR_COVSED.SCATTER_VALUES );        // (O)
 
+  // Oct 2026: check option for tabulated node weights (except debug)
+  if ( GENSMEAR_PROJ.USE && !DEBUG ) {
+    if ( GENSMEAR_PROJ.NBIN == 0 ) {
+      init_genSmear_PROJ(NBIN_WAVE, GENSMEAR_COVSED.WAVE, 
+			 OPT_GENSMEAR_PROJ_LINEAR);
+    }
+    for ( iwave=0; iwave < NWAVE; iwave++ ) {
+      magSmear[iwave] = 
+	eval_genSmear_PROJ(WAVE[iwave], GENSMEAR_COVSED.SCATTER_VALUES); 
+    }
+    return ;
+  }
+
   // -------------
   for ( iwave=0; iwave < NWAVE; iwave++ ) {
 
@@ -3574,6 +3719,118 @@ int INODE_LAMBDA(double LAM, int NNODE, double *LAM_NODES) {
 } // end of INODE_LAMBDA
 
 
+// *********************************************************
+void init_genSmear_PROJ(int NNODE, double *LAM_NODE, int OPT_INTERP) {
+
+  // Created Oct 16 2026
+  // Tabulate interpolation weights between wavelength nodes
+  // on uniform rest-frame grid with DLAM_GENSMEAR_PROJ bins.
+  // For node values V, smear at lam is
+  //    WGT0 * V[INODE] + WGT1 * V[INODE+1]
+  // with same node search (INODE_LAMBDA) and interpolation 
+  // (interp_SINFUN or linear) as the direct calculation. 
+  // Weights do not depend on the event, so each event's smear
+  // is a table lookup per wavelength bin.
+  //
+  // Inputs:
+  //   NNODE       : number of wavelength nodes
+  //   LAM_NODE    : wavelength at each node (increasing)
+  //   OPT_INTERP  : OPT_GENSMEAR_PROJ_[SIN,LINEAR]
+
+  double DLAM   = DLAM_GENSMEAR_PROJ ;
+  double LAMMIN = LAM_NODE[0];
+  double LAMMAX = LAM_NODE[NNODE-1];
+  double PI     = TWOPI/2.0 ;
+  int    NBIN   = (int)((LAMMAX-LAMMIN)/DLAM) + 2 ;
+  int    ibin, INODE ;
+  double lam, L0, L1, t, S ;
+  char fnam[] = "init_genSmear_PROJ" ;
+
+  // ------------- BEGIN -------------
+
+  if ( NNODE < 2 ) {
+    sprintf(c1err,"Invalid NNODE=%d", NNODE);
+    sprintf(c2err,"Need at least 2 wavelength nodes.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  GENSMEAR_PROJ.NNODE      = NNODE ;
+  GENSMEAR_PROJ.OPT_INTERP = OPT_INTERP ;
+  GENSMEAR_PROJ.NBIN       = NBIN ;
+  GENSMEAR_PROJ.LAMMIN     = LAMMIN ;
+  GENSMEAR_PROJ.LAMMAX     = LAMMAX ;
+  GENSMEAR_PROJ.INODE      = (int   *) malloc(NBIN*sizeof(int)   );
+  GENSMEAR_PROJ.WGT0       = (double*) malloc(NBIN*sizeof(double));
+  GENSMEAR_PROJ.WGT1       = (double*) malloc(NBIN*sizeof(double));
+
+  for(ibin=0; ibin < NBIN; ibin++ ) {
+    lam = LAMMIN + DLAM*(double)ibin ;
+    if ( lam > LAMMAX ) { lam = LAMMAX; }
+
+    INODE = INODE_LAMBDA(lam, NNODE, LAM_NODE);
+    if ( INODE < 0 ) {
+      sprintf(c1err,"Could not find INODE for lam=%7.1f", lam);
+      sprintf(c2err,"NNODE=%d  LAMRANGE=%.1f to %.1f", 
+	      NNODE, LAMMIN, LAMMAX);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+
+    L0 = LAM_NODE[INODE];  L1 = LAM_NODE[INODE+1];
+    if ( OPT_INTERP == OPT_GENSMEAR_PROJ_SIN ) {
+      // interp_SINFUN:  F = 0.5*(F0+F1) + 0.5*(F1-F0)*S
+      S = sin( PI * (lam - 0.5*(L0+L1)) / (L1-L0) ) ;
+      t = 0.5 + 0.5*S ;
+    }
+    else {
+      t = (lam - L0) / (L1-L0) ;
+    }
+
+    GENSMEAR_PROJ.INODE[ibin] = INODE ;
+    GENSMEAR_PROJ.WGT0[ibin]  = 1.0 - t ;
+    GENSMEAR_PROJ.WGT1[ibin]  = t ;
+  }
+
+  printf("   %s: %d nodes (%.0f-%.0f A) -> %d bins of %.1f A\n",
+	 fnam, NNODE, LAMMIN, LAMMAX, NBIN, DLAM);
+  fflush(stdout);
+
+  return ;
+
+} // end init_genSmear_PROJ
+
+
+// *********************************************************
+double eval_genSmear_PROJ(double LAM, double *NODEVAL) {
+
+  // Created Oct 16 2026
+  // Return smear at rest-frame wavelength LAM for node values NODEVAL
+  // using tabulated weights; interpolate linearly between table bins.
+  // Beyond the node range, return first or last node value.
+
+  int    NNODE = GENSMEAR_PROJ.NNODE ;
+  int    ibin, i0, i1 ;
+  double x, f, v0, v1 ;
+
+  // ------------- BEGIN -------------
+
+  if ( LAM <= GENSMEAR_PROJ.LAMMIN ) { return NODEVAL[0]; }
+  if ( LAM >= GENSMEAR_PROJ.LAMMAX ) { return NODEVAL[NNODE-1]; }
+
+  x    = (LAM - GENSMEAR_PROJ.LAMMIN) / DLAM_GENSMEAR_PROJ ;
+  ibin = (int)x ;   f = x - (double)ibin ;
+
+  i0 = GENSMEAR_PROJ.INODE[ibin] ;
+  i1 = GENSMEAR_PROJ.INODE[ibin+1] ;
+  v0 = GENSMEAR_PROJ.WGT0[ibin]   * NODEVAL[i0] + 
+       GENSMEAR_PROJ.WGT1[ibin]   * NODEVAL[i0+1] ;
+  v1 = GENSMEAR_PROJ.WGT0[ibin+1] * NODEVAL[i1] + 
+       GENSMEAR_PROJ.WGT1[ibin+1] * NODEVAL[i1+1] ;
+
+  return ( v0 + f*(v1-v0) ) ;
+
+} // end eval_genSmear_PROJ
+
+
 // ===============================================
 void extraFilters_4genSmear(char *modelName,      // (I) name of scatter model
 			    int *NFILT_extra,    // (O) Number of extra filt
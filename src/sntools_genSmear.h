@@ -2,6 +2,8 @@
 //
 // Mar 30 2018: MXLAM_GENSMEAR_SALT2 --> 4000 (was 1000)
 // Oct 18 2019: add COVSED model
+// Oct 16 2026: add GENSMEAR_PROJ table (GENMAG_SMEAR_MSKOPT += 64)
+// Oct 16 2026: add GENSMEAR_CACHE (per-event memoization of magSmear)
 
 #define MASK_GENSMEAR_APPLY 1 // apply genSmear, old or new
 #define MASK_GENSMEAR_NEW   2 // re-compute genSmear
@@ -60,7 +62,10 @@ void  SETSNPAR_genSmear(double shape, double color, double redshift) ;
 
 void get_genSmear(double *parList, int NLam, double *Lam, double *magSmear) ;
 
-int  repeat_genSmear(double Trest, int NLam, double *Lam);
+int  repeat_genSmear(double Trest, int NLam, double *Lam, double *magSmear);
+void store_genSmear_CACHE(double Trest, int NLam, double *Lam, 
+			  double *magSmear);
+void summary_genSmear_CACHE(void);
 void load_genSmear_randoms(int CID, double rmin, double rmax, double RANFIX);
 
 void init_genSmear_COVLAM_debug(double *lam, double COVMAT[2][2] );
@@ -102,6 +107,9 @@ void  get_genSmear_private(double Trest, int NLam, double *Lam,
 
 int INODE_LAMBDA(double LAM, int NNODE, double *LAM_NODES);
 
+void   init_genSmear_PROJ(int NNODE, double *LAM_NODE, int OPT_INTERP);
+double eval_genSmear_PROJ(double LAM, double *NODEVAL);
+
 void extraFilters_4genSmear(char *modelName,
 			    int *NFILT_extra, int *IFILTOBS_extra) ;
 
@@ -159,6 +167,41 @@ struct GENSMEAR {
 } GENSMEAR ;
 
 
+// Oct 2026: per-event cache of magSmear arrays for get_genSmear,
+// keyed on lambda grid (NLAM, LAMMIN, LAMMAX) and on Trest for
+// Trest-dependent models (USRFUN). Cache is cleared when new randoms
+// are loaded for an event. Replaces single-entry repeat check so 
+// that calls from any genmag model (SALT2, PySEDMODEL/BAYESN, ...) in 
+// any filter order re-use magSmear.
+#define MXENTRY_GENSMEAR_CACHE  40
+struct {
+  int    NENTRY, INEXT ;
+  int    NLAM[MXENTRY_GENSMEAR_CACHE], MXLAM[MXENTRY_GENSMEAR_CACHE] ;
+  double TREST[MXENTRY_GENSMEAR_CACHE] ;
+  double LAMMIN[MXENTRY_GENSMEAR_CACHE], LAMMAX[MXENTRY_GENSMEAR_CACHE] ;
+  double *MAGSMEAR[MXENTRY_GENSMEAR_CACHE] ;
+  long long NHIT, NMISS ;
+} GENSMEAR_CACHE ;
+
+
+// Oct 2026: tabulated projection from per-event node values to 
+// magSmear(lam) on a uniform rest-frame wavelength grid. Each table 
+// bin stores node index and weights, so each evaluation is a table 
+// lookup instead of a node search and sin-interpolation. 
+// Used by G10/C11/VCR/COVSED models with GENMAG_SMEAR_MSKOPT += 64.
+#define MSKOPT_GENSMEAR_PROJ       64
+#define DLAM_GENSMEAR_PROJ         1.0 // table bin size, A
+#define OPT_GENSMEAR_PROJ_LINEAR   1   // linear interp between nodes
+#define OPT_GENSMEAR_PROJ_SIN      2   // interp_SINFUN between nodes
+struct {
+  int    USE ;
+  int    NNODE, OPT_INTERP, NBIN ;
+  double LAMMIN, LAMMAX ;  // table range = first & last node
+  int    *INODE ;          // [ibin] node with LAM_NODE[INODE] <= lam
+  double *WGT0, *WGT1 ;    // [ibin] weights for INODE and INODE+1
+} GENSMEAR_PROJ ;
+
+
 // Mar 22 2020:
 // define scaling of mag-smearing as global scale or ploynomial func
 struct {
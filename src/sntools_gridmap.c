@@ -7,6 +7,10 @@
   Note: these utils are NOT related to those in sntools_modelgrid_gen.c[h]
         and sntools_modelgrid_read.c[h]
 
+  Oct 2026: fast interp_GRIDMAP path for NDIM <= 4 using strides and
+            cell-corner offsets precomputed in init_interp_GRIDMAP_FAST;
+            new interp_GRIDMAP_LIST to interpolate a list of points.
+
  *****************************************/
 
 #include <stdio.h>
@@ -235,6 +239,7 @@ void malloc_GRIDMAP(int OPT, GRIDMAP *gridmap, int NFUN, int NDIM, int MAPSIZE){
   // OPT < 0 -> free
   //
   // Nov 2022: sum and store MEMORY for MAPSIZE arrays.
+  // Oct 2026: malloc STRIDE and CORNER_OFFSET for fast interp.
 
   int ifun;
   int I4  = sizeof(int) ;
@@ -255,6 +260,10 @@ void malloc_GRIDMAP(int OPT, GRIDMAP *gridmap, int NFUN, int NDIM, int MAPSIZE){
     gridmap->RANGE     = (double  *)malloc(I8*NDIM+I8);
     gridmap->FUNMIN    = (double  *)malloc(I8*NFUN);
     gridmap->FUNMAX    = (double  *)malloc(I8*NFUN);
+    gridmap->STRIDE        = (int *)malloc(I4*NDIM+I4);
+    gridmap->CORNER_OFFSET = (int *)malloc(I4*(1<<NDIM));
+    gridmap->OPT_FAST      = 0 ;
+    gridmap->NCORNER       = 0 ;
 
     MEMI = I4*MAPSIZE+I4 ; MEMORY += 1.0E-6 * (float)MEMI;
     gridmap->INVMAP    = (int     *)malloc(MEMI);  
@@ -279,6 +288,8 @@ void malloc_GRIDMAP(int OPT, GRIDMAP *gridmap, int NFUN, int NDIM, int MAPSIZE){
     free(gridmap->FUNMIN);
     free(gridmap->FUNMAX);
     free(gridmap->INVMAP);
+    free(gridmap->STRIDE);
+    free(gridmap->CORNER_OFFSET);
 
     for(ifun=0; ifun < NFUN; ifun++ ) { free(gridmap->FUNVAL[ifun]); }
     free(gridmap->FUNVAL);
@@ -322,6 +333,8 @@ void init_interp_GRIDMAP(int ID, char *MAPNAME, int MAPSIZE,
   //
   // May 26 2021: move malloc calls into malloc_GRIDMAP()
   //
+  // Oct 16 2026: call init_interp_GRIDMAP_FAST
+  //
 
   int idim, ifun, i, NBIN, igrid_tmp, igrid_1d[100] ;
   double VAL, VALMIN, VALMAX, VALBIN, LASTVAL, RANGE, DIF ;
@@ -445,6 +458,8 @@ void init_interp_GRIDMAP(int ID, char *MAPNAME, int MAPSIZE,
       gridmap->INVMAP[igrid_tmp] = i ;
 
   } // end loop over MAPSIZE
+
+  init_interp_GRIDMAP_FAST(gridmap);
   
   return ;
 
@@ -477,6 +492,8 @@ int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
   //  + return SUCCESS or ERROR instead of hard-coded values.
   //
   // Mar 15 2020: allow numerical glitches in TMPMIN and TMPMAX
+  //
+  // Oct 16 2026: if gridmap->OPT_FAST, use interp_GRIDMAP_FAST
 
   int 
     ivar, ifun, NFUN, NVAR, ID, igrid, MSK, NBIN, OPT_EXTRAP
@@ -512,6 +529,9 @@ int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
     return(SUCCESS);
   }
 
+  if ( gridmap->OPT_FAST ) 
+    { return interp_GRIDMAP_FAST(gridmap, data, interpFun); }
+
   for  ( ifun=0; ifun < NFUN; ifun++ )   {  
     interpFun[ifun] = 0.0 ; 
     WGT_SUM[ifun] = 0.0 ;
@@ -682,6 +702,223 @@ int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
 } // end of interp_GRIDMAP
 
 
+// ==============================================================
+void init_interp_GRIDMAP_FAST(GRIDMAP *gridmap) {
+
+  // Created Oct 16 2026
+  // Precompute 1D-index stride for each dimension and the 1D-index
+  // offset of each of the 2^NDIM cell corners, so that interp_GRIDMAP
+  // can skip get_1DINDEX and the per-corner bit logic.
+  // Strides are identical to OFFSET_1DINDEX from init_1DINDEX, but
+  // stored in gridmap so that lookup does not depend on global ID.
+  //
+  // Fast path is enabled for 1 <= NDIM <= MXDIM_GRIDMAP_FAST and
+  // NBIN >= 2 in every dimension; otherwise the legacy interp_GRIDMAP
+  // is used.
+
+  int NDIM = gridmap->NDIM ;
+  int idim, icorner, OFFSET, NCORNER ;
+  bool USE_FAST = ( NDIM >= 1 && NDIM <= MXDIM_GRIDMAP_FAST ) ;
+  // char fnam[] = "init_interp_GRIDMAP_FAST" ;
+
+  // ----------- BEGIN ------------
+
+  for(idim=0; idim < NDIM; idim++ ) {
+    if ( idim == 0 ) 
+      { gridmap->STRIDE[idim] = 1; }
+    else
+      { gridmap->STRIDE[idim] = gridmap->STRIDE[idim-1] * 
+	  gridmap->NBIN[idim-1]; }
+
+    if ( gridmap->NBIN[idim] < 2 ) { USE_FAST = false; }
+  }
+
+  NCORNER = 1 << NDIM ;
+  for(icorner=0; icorner < NCORNER; icorner++ ) {
+    OFFSET = 0 ;
+    for(idim=0; idim < NDIM; idim++ ) {
+      if ( (icorner >> idim) & 1 ) { OFFSET += gridmap->STRIDE[idim]; }
+    }
+    gridmap->CORNER_OFFSET[icorner] = OFFSET ;
+  }
+
+  gridmap->NCORNER  = NCORNER ;
+  gridmap->OPT_FAST = (int)USE_FAST ;
+
+  return ;
+
+} // end init_interp_GRIDMAP_FAST
+
+
+// ==============================================================
+static inline int interp_GRIDMAP_NDIM(GRIDMAP *gridmap, const int NDIM,
+				      double *data, double *interpFun ) {
+
+  // Created Oct 16 2026
+  // Fast multi-linear interpolation on uniform grid for NDIM that is
+  // a compile-time constant at each call from interp_GRIDMAP_FAST,
+  // so that loops over dimensions and 2^NDIM corners are unrolled.
+  // Grid-index and GRIDFRAC logic is identical to interp_GRIDMAP,
+  // and corner weights are summed in the same order, so results
+  // are identical to the legacy interpolation.
+
+  int    NFUN       = gridmap->NFUN ;
+  int    OPT_EXTRAP = gridmap->OPT_EXTRAP ;
+  int    NCORNER    = 1 << NDIM ;
+  int    *INVMAP    = gridmap->INVMAP ;
+  int    idim, ifun, icorner, igrid, IGRID_BASE, igrid_1D ;
+  double TMPVAL, TMPDIF, TMPMIN, TMPMAX, TMPBIN, TMPRANGE, XNBIN ;
+  double GRIDFRAC[MXDIM_GRIDMAP_FAST], GRIDFRAC0[MXDIM_GRIDMAP_FAST];
+  double WGT_SUM[100], CORNER_WGT, CORNER_WGTSUM = 0.0 ;
+  double EPSILON = 1.0E-8 ;
+  bool   too_lo, too_hi ;
+  char fnam[] = "interp_GRIDMAP_FAST" ;
+
+  // ----------- BEGIN ------------
+
+  IGRID_BASE = 0 ;
+  for(idim=0; idim < NDIM; idim++ ) {
+    TMPVAL   = data[idim] ;
+    TMPMIN   = gridmap->VALMIN[idim] ;
+    TMPMAX   = gridmap->VALMAX[idim] ;
+    TMPBIN   = gridmap->VALBIN[idim] ;
+    TMPRANGE = TMPMAX - TMPMIN ;
+
+    TMPMAX += (1.0E-14*TMPRANGE);
+    TMPMIN -= (1.0E-14*TMPRANGE);
+
+    too_lo = ( TMPVAL < TMPMIN ) ;
+    too_hi = ( TMPVAL > TMPMAX ) ;
+    if ( too_lo || too_hi ) {
+      if ( OPT_EXTRAP > 0 ) {
+	if ( too_lo ) { TMPVAL = TMPMIN + (TMPRANGE*1.0E-12); }
+	if ( too_hi ) { TMPVAL = TMPMAX - (TMPRANGE*1.0E-12); }
+      }
+      else if ( OPT_EXTRAP == 0 ) 
+	{ return(ERROR); }
+    }
+
+    TMPDIF = TMPVAL - TMPMIN ;
+    if ( (TMPMAX - TMPVAL)/TMPRANGE < EPSILON  )  
+      { XNBIN = (TMPDIF - TMPRANGE*EPSILON)/TMPBIN ; }
+    else 
+      { XNBIN = (TMPDIF + TMPRANGE*EPSILON)/TMPBIN ; }
+    igrid = (int)XNBIN ;
+
+    if ( igrid < 0 || igrid+1 >= gridmap->NBIN[idim] ) {
+      sprintf(c1err,"Invalid igrid[idim=%d]=%d for NBIN=%d (ID=%d)", 
+	      idim, igrid, gridmap->NBIN[idim], gridmap->ID );
+      sprintf(c2err,"VAL=%f  VALMIN/MAX = %f / %f", 
+	      data[idim], gridmap->VALMIN[idim], gridmap->VALMAX[idim] );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+
+    GRIDFRAC[idim]  = TMPDIF/TMPBIN - (double)igrid ;
+    GRIDFRAC0[idim] = 1.0 - GRIDFRAC[idim] ;
+    IGRID_BASE     += igrid * gridmap->STRIDE[idim] ;
+  } 
+
+  for(ifun=0; ifun < NFUN; ifun++ ) { WGT_SUM[ifun] = 0.0 ; }
+
+  for(icorner=0; icorner < NCORNER; icorner++ ) {
+    CORNER_WGT = 1.0 ;
+    for(idim=0; idim < NDIM; idim++ ) {
+      if ( (icorner >> idim) & 1 ) 
+	{ CORNER_WGT *= GRIDFRAC[idim]; }
+      else
+	{ CORNER_WGT *= GRIDFRAC0[idim]; }
+    }
+    CORNER_WGTSUM += CORNER_WGT ;
+
+    igrid_1D = INVMAP[IGRID_BASE + gridmap->CORNER_OFFSET[icorner]] ;
+    for(ifun=0; ifun < NFUN; ifun++ ) 
+      { WGT_SUM[ifun] += (CORNER_WGT * gridmap->FUNVAL[ifun][igrid_1D]); }
+  }
+
+  if ( CORNER_WGTSUM <= 0.0 ) {
+    sprintf(c1err,"Could not compute CORNER_WGT for gridmap ID=%d", 
+	    gridmap->ID );
+    sprintf(c2err,"data[0] = %f", data[0] ) ;
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  for(ifun=0; ifun < NFUN; ifun++ ) 
+    { interpFun[ifun] = WGT_SUM[ifun] / CORNER_WGTSUM ; }
+
+  return(SUCCESS);
+
+} // end interp_GRIDMAP_NDIM
+
+
+int interp_GRIDMAP_FAST(GRIDMAP *gridmap, double *data, double *interpFun ) {
+
+  // Created Oct 16 2026
+  // Dispatch to interp_GRIDMAP_NDIM with constant NDIM (1-4).
+  // Requires gridmap->OPT_FAST=1 (see init_interp_GRIDMAP_FAST).
+
+  int NDIM = gridmap->NDIM ;
+  char fnam[] = "interp_GRIDMAP_FAST" ;
+
+  // ----------- BEGIN ------------
+
+  switch ( NDIM ) {
+  case 1: return interp_GRIDMAP_NDIM(gridmap, 1, data, interpFun); 
+  case 2: return interp_GRIDMAP_NDIM(gridmap, 2, data, interpFun); 
+  case 3: return interp_GRIDMAP_NDIM(gridmap, 3, data, interpFun); 
+  case 4: return interp_GRIDMAP_NDIM(gridmap, 4, data, interpFun); 
+  default:
+    sprintf(c1err,"Invalid NDIM=%d for gridmap ID=%d", NDIM, gridmap->ID);
+    sprintf(c2err,"Fast interp valid for NDIM <= %d", MXDIM_GRIDMAP_FAST);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  return(ERROR);
+
+} // end interp_GRIDMAP_FAST
+
+
+// ==============================================================
+int interp_GRIDMAP_LIST(GRIDMAP *gridmap, int NPT, double *dataList, 
+			double *interpFunList, int *istatList ) {
+
+  // Created Oct 16 2026
+  // Interpolate gridmap for a list of NPT points.
+  //
+  // Inputs:
+  //   gridmap    : map returned from init_interp_GRIDMAP
+  //   NPT        : number of points
+  //   dataList   : data[ipt*NDIM + idim]
+  //
+  // Outputs:
+  //   interpFunList : interpFun[ipt*NFUN + ifun]
+  //   istatList     : SUCCESS or ERROR for each point (or NULL)
+  //
+  // Function returns number of points outside map (ERROR).
+
+  int NDIM = gridmap->NDIM ;
+  int NFUN = gridmap->NFUN ;
+  int ipt, istat, NERR = 0 ;
+
+  // ----------- BEGIN ------------
+
+  for(ipt=0; ipt < NPT; ipt++ ) {
+    if ( gridmap->OPT_FAST ) {
+      istat = interp_GRIDMAP_FAST(gridmap, &dataList[ipt*NDIM], 
+				  &interpFunList[ipt*NFUN] );
+    }
+    else {
+      istat = interp_GRIDMAP(gridmap, &dataList[ipt*NDIM], 
+			     &interpFunList[ipt*NFUN] );
+    }
+    if ( istat != SUCCESS ) { NERR++ ; }
+    if ( istatList != NULL ) { istatList[ipt] = istat; }
+  }
+
+  return(NERR);
+
+} // end interp_GRIDMAP_LIST
+
+
 // ================================================
 int  get_1DINDEX(int ID, int NDIM, int *indx ) {
 
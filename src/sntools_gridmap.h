@@ -1,4 +1,9 @@
 // Created July 2021 [moved from sntools.h]
+//
+// Oct 2026: add STRIDE and CORNER_OFFSET for fast interp (NDIM<=4),
+//           and interp_GRIDMAP_LIST to interpolate list of points.
+
+#define MXDIM_GRIDMAP_FAST 4  // max NDIM for fast interp_GRIDMAP
 
 // define prototype for multi-dimensionl grid; used for interpolation
 typedef struct GRIDMAP {
@@ -19,6 +24,12 @@ typedef struct GRIDMAP {
   int  OPT_EXTRAP;   // 1=>snap outside values to edge 
   char VARLIST[80];  // comma-sep list of variables (optional to fill)   
 
+  // Oct 2026: precomputed 1D-index arithmetic for uniform grid
+  int  OPT_FAST;       // 1 => interp_GRIDMAP uses interp_GRIDMAP_FAST
+  int  *STRIDE;        // 1D-index stride per dimension
+  int  NCORNER;        // 2^NDIM corners per cell
+  int  *CORNER_OFFSET; // 1D-index offset of each cell corner
+
   float MEMORY; // alloated memory, MB
 
 } GRIDMAP ;
@@ -63,6 +74,10 @@ void init_interp_GRIDMAP(int ID, char *MAPNAME, int MAPSIZE, int NDIM, int NFUN,
                          GRIDMAP *gridmap ); 
                                                                            
 int  interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun );
+void init_interp_GRIDMAP_FAST(GRIDMAP *gridmap);
+int  interp_GRIDMAP_FAST(GRIDMAP *gridmap, double *data, double *interpFun );
+int  interp_GRIDMAP_LIST(GRIDMAP *gridmap, int NPT, double *dataList, 
+			 double *interpFunList, int *istatList );
                                                                 
 void read_GRIDMAP(FILE *fp, char *MAPNAME, char *KEY_ROW, char *KEY_STOP,
                   int IDMAP, int NDIM, int NFUN, int OPT_EXTRAP, int MXROW,
@@ -119,6 +119,20 @@
 
  Dec 30 2021: refactor GEN_SNHOST_GALID() to use binary search for speed.
 
+ Oct 16 2026: new HOSTLIB_MSKOPT_SKYINDEX option builds sky-position
+              index for +HOSTNBR neighbor search, and parses NBR_LIST
+              once at init for GEN_SNHOST_NBR. Timing counters are
+              printed in summary_SKYINDEX_HOSTLIB.
+
+ Oct 16 2026: USEONCE host selection jumps over used hosts with
+              path-compressed pointer (nextFree_SAMEHOST) instead of
+              checking each used host one at a time.
+
+ Oct 16 2026: binary HOSTLIB. +HOSTBINARY writes all columns in
+              redshift-sorted order (rewrite_HOSTLIB_BINARY); using this
+              file as HOSTLIB_FILE skips text parsing and sorting, and the
+              file is mmap'd so that jobs on a node share the page cache.
+
 =========================================================== */
 
 #include <stdio.h>
@@ -128,6 +142,9 @@
 #include <string.h>
 #include <time.h>
 #include <math.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "sntools.h"
 #include "sntools_cosmology.h"
@@ -209,6 +226,9 @@ void INIT_HOSTLIB(void) {
   // set redshift pointers for faster lookup
   zptr_HOSTLIB();
 
+  // optional sky index for neighbors (Oct 2026)
+  init_SKYINDEX_HOSTLIB();
+
   // setup optional wgt-map grid
   int IGAL_START = 0,  IGAL_END = HOSTLIB.NGAL_STORE-1;
   init_HOSTLIB_WGTMAP(1, IGAL_START, IGAL_END);
@@ -1036,12 +1056,22 @@ void Sersic_names(int j, char *a, char *b, char *w, char *n) {
 void open_HOSTLIB(FILE **fp) {
 
   // Dec 29 2017: use snana_openTextFile utility to allow gzipped library.
+  // Oct 16 2026: check for binary HOSTLIB
 
   char libname_full[MXPATHLEN] ;
   char fnam[] = "open_HOSTLIB" ;
 
   // ----------- BEGIN ----------
 
+  // Oct 2026: check for binary HOSTLIB; *fp is stream for text header
+  if ( open_HOSTLIB_BINARY(fp) ) {
+    HOSTLIB.GZIPFLAG = 0 ;
+    sprintf(HOSTLIB.FILENAME , "%s", HOSTLIB_BINARY.FILENAME );
+    printf("\t Reading %s (binary)\n", HOSTLIB.FILENAME );
+    fflush(stdout);
+    return ;
+  }
+
   *fp = snana_openTextFile(OPTMASK_OPENFILE_HOSTLIB, 
 			   PATH_DEFAULT_HOSTLIB, INPUTS.HOSTLIB_FILE,
 			   libname_full, &HOSTLIB.GZIPFLAG );  // <== returned
@@ -1070,6 +1100,110 @@ void close_HOSTLIB(FILE *fp) {
     { fclose(fp); } // close normal file stream
 } // end close_HOSTLIB
 
+
+// ==========================================
+int open_HOSTLIB_BINARY(FILE **fp) {
+
+  // Created Oct 16 2026
+  // If HOSTLIB_FILE is binary (written with +HOSTBINARY), mmap the
+  // file on first call and return *fp = stream to the text header
+  // stored in the binary file, so that header keys are parsed by
+  // the same functions as for a text HOSTLIB.
+  // File is mapped MAP_PRIVATE so that pages are shared with other
+  // jobs on the same node, except for the few pages that are
+  // modified (e.g., fixed Sersic params).
+  //
+  // Functions returns 1 for binary HOSTLIB, or 0 for text HOSTLIB
+  // (and *fp is not touched).
+
+  bool REQUIRE_DOCANA = ( OPTMASK_OPENFILE_HOSTLIB & OPENMASK_REQUIRE_DOCANA);
+  bool IGNORE_DOCANA  = ( OPTMASK_OPENFILE_HOSTLIB & OPENMASK_IGNORE_DOCANA);
+  int  ipath, NPATH, fd, NRD ;
+  bool FOUND_DOCANA ;
+  struct stat statbuf ;
+  char *PATH[4], sepKey[] = " ", FILENAME[MXPATHLEN], MAGIC[32] ;
+  HOSTLIB_BINARY_HEAD_DEF *HEAD ;
+  char fnam[] = "open_HOSTLIB_BINARY" ;
+
+  // ----------- BEGIN ----------
+
+  if ( HOSTLIB_BINARY.MAP != NULL ) { goto OPEN_HEAD; }
+
+  // find file: first current directory, then PATH_DEFAULT_HOSTLIB
+  sprintf(FILENAME, "%s", INPUTS.HOSTLIB_FILE);
+  fd = open(FILENAME, O_RDONLY);
+  if ( fd < 0 ) {
+    for(ipath=0; ipath < 4; ipath++ )
+      { PATH[ipath] = (char*) malloc(MXPATHLEN*sizeof(char) ); }
+    splitString(PATH_DEFAULT_HOSTLIB, sepKey, 4, &NPATH, PATH );
+    for(ipath=0; ipath < NPATH && fd < 0; ipath++ ) {
+      sprintf(FILENAME, "%s/%s", PATH[ipath], INPUTS.HOSTLIB_FILE);
+      fd = open(FILENAME, O_RDONLY);
+    }
+    for(ipath=0; ipath < 4; ipath++ )  { free(PATH[ipath]); }
+  }
+  if ( fd < 0 ) { return(0); } // let text-open give error message
+
+  memset(MAGIC, 0, sizeof(MAGIC));
+  NRD = read(fd, MAGIC, sizeof(MAGIC)-1) ;
+  if ( NRD <= 0 || strcmp(MAGIC,MAGIC_HOSTLIB_BINARY) != 0 ) 
+    { close(fd);  return(0); }
+
+  // - - - - - - 
+  // binary HOSTLIB: mmap entire file
+  fstat(fd, &statbuf);
+  HOSTLIB_BINARY.MAPSIZE = (size_t)statbuf.st_size ;
+  HOSTLIB_BINARY.MAP     = (char*)mmap(NULL, HOSTLIB_BINARY.MAPSIZE,
+					 PROT_READ | PROT_WRITE, MAP_PRIVATE, 
+					 fd, 0);
+  close(fd);
+  if ( HOSTLIB_BINARY.MAP == MAP_FAILED ) {
+    sprintf(c1err,"Could not mmap binary HOSTLIB (%.1f MB)",
+	    (double)HOSTLIB_BINARY.MAPSIZE/1.0E6 );
+    sprintf(c2err,"'%s'", FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  HEAD = (HOSTLIB_BINARY_HEAD_DEF*)HOSTLIB_BINARY.MAP ;
+  if ( HEAD->OFFSET_STRING + HEAD->LEN_STRING > 
+       (long long)HOSTLIB_BINARY.MAPSIZE ) {
+    sprintf(c1err,"Binary HOSTLIB is truncated (%lld < %lld bytes)",
+	    (long long)HOSTLIB_BINARY.MAPSIZE, 
+	    HEAD->OFFSET_STRING + HEAD->LEN_STRING );
+    sprintf(c2err,"'%s'", FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  HOSTLIB_BINARY.USE       = true ;
+  HOSTLIB_BINARY.ZERO_COPY = false ;
+  HOSTLIB_BINARY.HEAD      = HEAD ;
+  HOSTLIB_BINARY.VALUE     = (double*)(HOSTLIB_BINARY.MAP + HEAD->OFFSET_VALUE);
+  HOSTLIB_BINARY.ROWINDEX  = (int*)(HOSTLIB_BINARY.MAP+HEAD->OFFSET_ROWINDEX);
+  HOSTLIB_BINARY.STRPTR    = 
+    (long long*)(HOSTLIB_BINARY.MAP + HEAD->OFFSET_STRPTR);
+  HOSTLIB_BINARY.STRING    = HOSTLIB_BINARY.MAP + HEAD->OFFSET_STRING ;
+  sprintf(HOSTLIB_BINARY.FILENAME, "%s", FILENAME);
+
+  printf("\t mmap binary HOSTLIB: %d rows x %d columns (%.1f MB)\n",
+	 HEAD->NROW, HEAD->NVAR_ALL, (double)HOSTLIB_BINARY.MAPSIZE/1.0E6);
+  fflush(stdout);
+
+ OPEN_HEAD:
+  HEAD = HOSTLIB_BINARY.HEAD ;
+  *fp  = fmemopen(HOSTLIB_BINARY.MAP + HEAD->OFFSET_HEAD, 
+		  (size_t)HEAD->LEN_HEAD, "r");
+
+  // same DOCANA check as snana_openTextFile
+  if ( !IGNORE_DOCANA ) {
+    FOUND_DOCANA = check_openFile_docana(REQUIRE_DOCANA, *fp, 
+					 HOSTLIB_BINARY.FILENAME);
+    if ( !FOUND_DOCANA ) { rewind(*fp); }
+  }
+
+  return(1);
+
+} // end open_HOSTLIB_BINARY
+
 // ====================================
 void  read_HOSTLIB_WGTMAP(void) {
 
@@ -1252,6 +1386,7 @@ int read_VARNAMES_WGTMAP(char *VARLIST_WGTMAP) {
   // Nov 18 2021: 
   //   + abort if WGT is not found
   //   + set FOUNDVAR_SNMAGSHIFT 
+  // Oct 16 2026: read header of binary HOSTLIB
   //
 
   int NVAR   = 0 ;
@@ -1283,10 +1418,17 @@ int read_VARNAMES_WGTMAP(char *VARLIST_WGTMAP) {
     printf(" xxx \n" ) ;
   }
 
-  // open file containing WGTMAP
-  fp = snana_openTextFile(OPTMASK_OPENFILE_HOSTLIB, 
-			  PATH_DEFAULT_HOSTLIB, WGTMAP_FILE,
-			  FILENAME_FULL, &gzipFlag );  // <== returned
+  // open file containing WGTMAP; 
+  // Oct 2026: for binary HOSTLIB, read its text header
+  fp = NULL;  gzipFlag = 0;
+  if ( WGTMAP_FILE == INPUTS.HOSTLIB_FILE ) 
+    { open_HOSTLIB_BINARY(&fp); }
+
+  if ( fp == NULL ) {
+    fp = snana_openTextFile(OPTMASK_OPENFILE_HOSTLIB, 
+			    PATH_DEFAULT_HOSTLIB, WGTMAP_FILE,
+			    FILENAME_FULL, &gzipFlag );  // <== returned
+  }
   
   if ( !fp ) {
     sprintf(c1err, "Unable to open WGTMAP file (to read VARNAMES)");
@@ -2626,6 +2768,7 @@ void read_gal_HOSTLIB(FILE *fp) {
   // Feb 25 2020: set VALMIN & VALMAX for float; skip for ISCHAR.
   // Jan 22 2021: print WARNING if HOSTLIB.NSTAR > 0
   // Apr 30 2021: abort on NaN.
+  // Oct 16 2026: call read_gal_HOSTLIB_BINARY for binary HOSTLIB.
 
   bool DO_SWAPZPHOT = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_SWAPZPHOT) ;
   int  IVAR_ZPHOT    = HOSTLIB.IVAR_ZPHOT ; // ivar_STORE
@@ -2667,6 +2810,12 @@ void read_gal_HOSTLIB(FILE *fp) {
 
   NGAL = -9;
 
+  // Oct 2026: binary HOSTLIB is already in memory
+  if ( HOSTLIB_BINARY.USE ) {
+    NPRIORITY = read_gal_HOSTLIB_BINARY();
+    goto DONE_RDGAL ;
+  }
+
   while( (fscanf(fp, "%s", c_get)) != EOF) {
 
     if ( strcmp(c_get,"GAL:") == 0 ) {
@@ -2815,6 +2964,224 @@ void read_gal_HOSTLIB(FILE *fp) {
 
 } // end of read_gal_HOSTLIB
 
+
+// ====================================
+int read_gal_HOSTLIB_BINARY(void) {
+
+  // Created Oct 16 2026
+  // Binary-HOSTLIB version of the GAL-row loop in read_gal_HOSTLIB:
+  // apply the same cuts and fill the same HOSTLIB arrays, but fetch
+  // values from the mmap'd columns instead of parsing text.
+  // Rows are visited in the pre-built redshift order. If the stored 
+  // rows are a contiguous block (e.g., only a redshift cut) and values
+  // are not modified (SWAPZPHOT, ABMAG_FORCE), VALUE_ZSORTED points 
+  // directly into the mmap'd columns (ZERO_COPY) and sortz_HOSTLIB 
+  // does not sort or copy.
+  //
+  // Function returns number of galaxies in GALID_PRIORITY range.
+
+  HOSTLIB_BINARY_HEAD_DEF *HEAD = HOSTLIB_BINARY.HEAD ;
+  int    NROW         = HEAD->NROW ;
+  int    NVAR_ALL     = HOSTLIB.NVAR_ALL ;
+  int    NVAR_STORE   = HOSTLIB.NVAR_STORE ;
+  int    MAXREAD      = INPUTS.HOSTLIB_MAXREAD ;
+  int    IVAR_ZPHOT   = HOSTLIB.IVAR_ZPHOT ; // ivar_STORE
+  int    IVAR_ZTRUE   = HOSTLIB.IVAR_ZTRUE ;
+  bool   DO_SWAPZPHOT = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_SWAPZPHOT) ;
+  bool   DO_FIELD     = ( HOSTLIB.IVAR_FIELD    > 0 );
+  bool   DO_NBR       = ( HOSTLIB.IVAR_NBR_LIST > 0 );
+  double ABMAG_FORCE  = INPUTS.HOSTLIB_ABMAG_FORCE;
+  long long GALID_MIN = INPUTS.HOSTLIB_GALID_PRIORITY[0] ;
+  long long GALID_MAX = INPUTS.HOSTLIB_GALID_PRIORITY[1] ;
+
+  int    irow, irow_orig, irow_min=-9, irow_max=-9, ival ;
+  int    ivar_ALL, ivar_STORE, NGAL, NGAL_READ, NPRIORITY=0, MEMC ;
+  bool   ZERO_COPY ;
+  char   *PASS ;
+  long long GALID ;
+  double xval[MXVAR_HOSTLIB], val ;
+  char   FIELD[MXCHAR_FIELDNAME], NBR_LIST[MXCHAR_NBR_LIST] ;
+  char   fnam[] = "read_gal_HOSTLIB_BINARY" ;
+
+  // ----------- BEGIN ------------
+
+  if ( HEAD->NVAR_ALL != NVAR_ALL ) {
+    sprintf(c1err,"NVAR_ALL=%d in binary table, but %d VARNAMES in header",
+	    HEAD->NVAR_ALL, NVAR_ALL);
+    sprintf(c2err,"Re-create binary HOSTLIB with +HOSTBINARY");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  PASS = (char*) malloc ( (NROW+1) * sizeof(char) );
+  HOSTLIB.LIBINDEX_READ = (int*) malloc ( (NROW+1) * sizeof(int) );
+  for(irow=0; irow <= NROW; irow++ ) { HOSTLIB.LIBINDEX_READ[irow] = -9; }
+
+  // - - - - - - - - - - 
+  // 1st pass: apply cuts
+  NGAL = NGAL_READ = 0 ;
+  for(irow=0; irow < NROW; irow++ ) {
+    PASS[irow] = 0 ;
+    irow_orig  = HOSTLIB_BINARY.ROWINDEX[irow] ;
+    if ( irow_orig >= MAXREAD ) { continue; }
+    NGAL_READ++ ;
+
+    load_row_HOSTLIB_BINARY(irow, xval, NULL, NULL);
+
+    for(ival=0; ival < NVAR_ALL; ival++ ) {
+      if ( isnan(xval[ival]) ) {
+	HOSTLIB.NERR_NAN++ ;
+	if ( HOSTLIB.NERR_NAN < 20 ) 
+	  { printf("\t ERROR: HOSTLIB %s = NaN \n", 
+		   HOSTLIB.VARNAME_ALL[ival] );	}
+      }
+    }
+
+    if ( passCuts_HOSTLIB(xval) == 0 ) { continue; }
+
+    if ( GALID_MIN < GALID_MAX ) {
+      ivar_ALL    = HOSTLIB.IVAR_ALL[HOSTLIB.IVAR_GALID] ;
+      GALID       = (long long)xval[ivar_ALL];
+      if ( GALID >= GALID_MIN && GALID <= GALID_MAX ) { NPRIORITY++ ; }
+    }
+
+    PASS[irow] = 1;   NGAL++ ;
+    if ( irow_min < 0 ) { irow_min = irow; }
+    irow_max = irow ;
+  }
+
+  ZERO_COPY = ( NGAL > 0 && (irow_max - irow_min + 1) == NGAL &&
+		!DO_SWAPZPHOT && ABMAG_FORCE < -8.0 ) ;
+  HOSTLIB_BINARY.ZERO_COPY = ZERO_COPY ;
+  HOSTLIB_BINARY.IROW_MIN  = irow_min ;
+
+  // - - - - - - - - - - 
+  // allocate memory for stored galaxies
+  if ( !ZERO_COPY ) {
+    for ( ivar_STORE=0; ivar_STORE < NVAR_STORE; ivar_STORE++ ) {
+      HOSTLIB.VALUE_UNSORTED[ivar_STORE] = 
+	(double*)malloc( (NGAL+1) * sizeof(double) );
+    }
+  }
+  if ( DO_FIELD ) 
+    { HOSTLIB.FIELD_UNSORTED = (char**)malloc( (NGAL+1)*sizeof(char*) ); }
+  if ( DO_NBR ) 
+    { HOSTLIB.NBR_UNSORTED   = (char**)malloc( (NGAL+1)*sizeof(char*) ); }
+
+  // - - - - - - - - - - 
+  // 2nd pass: store
+  for(irow=0; irow < NROW; irow++ ) {
+    if ( !PASS[irow] ) { continue; }
+    irow_orig  = HOSTLIB_BINARY.ROWINDEX[irow] ;
+
+    load_row_HOSTLIB_BINARY(irow, xval, FIELD, NBR_LIST);
+
+    NGAL = HOSTLIB.NGAL_STORE ;   HOSTLIB.NGAL_STORE++ ;   
+
+    for ( ivar_STORE=0; ivar_STORE < NVAR_STORE; ivar_STORE++ ) {
+      ivar_ALL = HOSTLIB.IVAR_ALL[ivar_STORE] ;
+      val      = xval[ivar_ALL] ;
+
+      if ( !ZERO_COPY ) 
+	{ HOSTLIB.VALUE_UNSORTED[ivar_STORE][NGAL] = val ; }
+
+      if ( ISCHAR_HOSTLIB(ivar_STORE) ) { continue; }
+      if ( val > HOSTLIB.VALMAX[ivar_STORE] ) 
+	{ HOSTLIB.VALMAX[ivar_STORE] = val; }
+      if ( val < HOSTLIB.VALMIN[ivar_STORE] ) 
+	{ HOSTLIB.VALMIN[ivar_STORE] = val; }
+    }
+
+    if ( DO_FIELD ) {
+      HOSTLIB.FIELD_UNSORTED[NGAL] = (char*)malloc(MXCHAR_FIELDNAME);
+      sprintf(HOSTLIB.FIELD_UNSORTED[NGAL],"%s", FIELD);
+    }
+
+    if ( DO_NBR ) {
+      MEMC       = (1+strlen(NBR_LIST)) * sizeof(char) ;
+      HOSTLIB.NBR_UNSORTED[NGAL] = (char*) malloc(MEMC);
+      sprintf(HOSTLIB.NBR_UNSORTED[NGAL],"%s", NBR_LIST);
+    }
+
+    if ( DO_SWAPZPHOT ) {
+      HOSTLIB.VALUE_UNSORTED[IVAR_ZTRUE][NGAL] = 
+	HOSTLIB.VALUE_UNSORTED[IVAR_ZPHOT][NGAL] ;
+    }
+
+    HOSTLIB.LIBINDEX_READ[irow_orig] = NGAL ;
+  }
+
+  // for ZERO_COPY, point to stored rows in mmap'd columns
+  if ( ZERO_COPY ) {
+    for ( ivar_STORE=0; ivar_STORE < NVAR_STORE; ivar_STORE++ ) {
+      ivar_ALL = HOSTLIB.IVAR_ALL[ivar_STORE] ;
+      HOSTLIB.VALUE_ZSORTED[ivar_STORE] = 
+	HOSTLIB_BINARY.VALUE + (long long)ivar_ALL*NROW + irow_min ;
+    }
+  }
+
+  HOSTLIB.NGAL_READ = NGAL_READ ;
+  free(PASS);
+
+  printf("\t Binary HOSTLIB rows %d to %d pass cuts (ZERO_COPY=%d)\n",
+	 irow_min, irow_max, ZERO_COPY );
+  fflush(stdout);
+
+  return(NPRIORITY);
+
+} // end read_gal_HOSTLIB_BINARY
+
+
+// ====================================
+void load_row_HOSTLIB_BINARY(int irow, double *xval, char *FIELD,
+			     char *NBR_LIST) {
+
+  // Created Oct 16 2026
+  // For redshift-sorted row 'irow' of binary HOSTLIB, load all 
+  // column values into xval (same indexing as read_galRow_HOSTLIB),
+  // and optional FIELD and NBR_LIST strings (skip if NULL).
+
+  int    NROW        = HOSTLIB_BINARY.HEAD->NROW ;
+  int    NVAR_ALL    = HOSTLIB.NVAR_ALL ;
+  double ABMAG_FORCE = INPUTS.HOSTLIB_ABMAG_FORCE;
+  int    lensuf      = strlen(HOSTLIB_SUFFIX_MAGOBS);
+  long long ptr ;
+  int    ival ;
+  char  *varName ;
+
+  // ----------- BEGIN ------------
+
+  for(ival=0; ival < NVAR_ALL; ival++ ) {
+    xval[ival] = HOSTLIB_BINARY.VALUE[(long long)ival*NROW + irow] ;
+
+    // check option to force override for gal mags
+    if ( ABMAG_FORCE > -8.0 ) {
+      varName = HOSTLIB.VARNAME_ALL[ival] ;
+      if ( strstr(varName,HOSTLIB_SUFFIX_MAGOBS) != NULL &&
+	   strlen(varName) == lensuf+1 ) 
+	{ xval[ival] = ABMAG_FORCE ; }
+    }
+  }
+
+  if ( FIELD != NULL ) {
+    ptr = HOSTLIB_BINARY.STRPTR[2*irow+0] ;
+    if ( ptr >= 0 ) 
+      { sprintf(FIELD, "%s", HOSTLIB_BINARY.STRING + ptr); }
+    else
+      { sprintf(FIELD, "NULL"); }
+  }
+
+  if ( NBR_LIST != NULL ) {
+    ptr = HOSTLIB_BINARY.STRPTR[2*irow+1] ;
+    if ( ptr >= 0 ) 
+      { sprintf(NBR_LIST, "%s", HOSTLIB_BINARY.STRING + ptr); }
+    else
+      { sprintf(NBR_LIST, "NULL"); }
+  }
+
+  return ;
+
+} // end load_row_HOSTLIB_BINARY
+
 // ====================================
 int passCuts_HOSTLIB(double *xval ) {
 
@@ -3255,8 +3622,11 @@ void sortz_HOSTLIB(void) {
   //
   // Nov 11 2019: check NBR_LIST
   // May 23 2020: compute a few VPEC quantities for README
+  // Oct 16 2026: for binary HOSTLIB with ZERO_COPY, rows are already
+  //              z-sorted in the mmap'd file -> skip sort and copy.
 
   bool DO_VPEC  = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_USEVPEC ) ;
+  bool ZERO_COPY = HOSTLIB_BINARY.ZERO_COPY ;
   int  NGAL, igal, ival, unsort, VBOSE, DO_FIELD, DO_NBR;
   int  IVAR_ZTRUE, NVAR_STORE, ORDER_SORT, MEMC, IVAR_VPEC ;
   double ZTRUE, ZLAST, ZGAP, ZSUM, *ZSORT, VAL ;
@@ -3293,7 +3663,7 @@ void sortz_HOSTLIB(void) {
   HOSTLIB.LIBINDEX_ZSORT   = (int*)malloc( (NGAL+1) * sizeof(int) );
 
   // allocate memory for sorted values
-  for ( ival=0; ival < NVAR_STORE; ival++ ) {
+  for ( ival=0; ival < NVAR_STORE && !ZERO_COPY; ival++ ) {
     HOSTLIB.VALUE_ZSORTED[ival] = 
       (double*)malloc( (NGAL+1) * sizeof(double) ) ;
   }
@@ -3313,14 +3683,21 @@ void sortz_HOSTLIB(void) {
   // allocate memory and load ZSORT need for sorting routine
   ZSORT = (double*)malloc( (NGAL+1) * sizeof(double) );
 
-  // load ZSORT array
-  for ( igal=0; igal < NGAL; igal++ ) {
-    ZTRUE = HOSTLIB.VALUE_UNSORTED[IVAR_ZTRUE][igal]; 
-    ZSORT[igal] = ZTRUE ;
+  if ( ZERO_COPY ) {
+    // already sorted
+    for ( igal=0; igal < NGAL; igal++ ) 
+      { HOSTLIB.LIBINDEX_UNSORT[igal] = igal; }
   }
+  else {
+    // load ZSORT array
+    for ( igal=0; igal < NGAL; igal++ ) {
+      ZTRUE = HOSTLIB.VALUE_UNSORTED[IVAR_ZTRUE][igal]; 
+      ZSORT[igal] = ZTRUE ;
+    }
 
-  ORDER_SORT = +1 ;    // increasing order
-  sortDouble( NGAL, ZSORT, ORDER_SORT, HOSTLIB.LIBINDEX_UNSORT ) ;
+    ORDER_SORT = +1 ;    // increasing order
+    sortDouble( NGAL, ZSORT, ORDER_SORT, HOSTLIB.LIBINDEX_UNSORT ) ;
+  }
 
   HOSTLIB.SORTFLAG = 1 ;
   ZLAST = HOSTLIB.ZMIN ;
@@ -3336,7 +3713,7 @@ void sortz_HOSTLIB(void) {
     unsort = HOSTLIB.LIBINDEX_UNSORT[igal]  ;
     HOSTLIB.LIBINDEX_ZSORT[unsort] = igal;
 
-    for ( ival=0; ival < NVAR_STORE; ival++ ) {
+    for ( ival=0; ival < NVAR_STORE && !ZERO_COPY; ival++ ) {
       VAL = HOSTLIB.VALUE_UNSORTED[ival][unsort] ; 
       HOSTLIB.VALUE_ZSORTED[ival][igal] = VAL;
     }
@@ -3412,12 +3789,13 @@ void sortz_HOSTLIB(void) {
 
   // free memory for the pointers and the unsorted array.
   free(ZSORT);
-  for ( ival=0; ival < NVAR_STORE; ival++ ) 
+  for ( ival=0; ival < NVAR_STORE && !ZERO_COPY; ival++ ) 
     { free(HOSTLIB.VALUE_UNSORTED[ival]);  }
 
   int  OPT_PLUSMAGS  = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_PLUSMAGS);
   int  OPT_PLUSNBR   = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_PLUSNBR);
-  if ( !(OPT_PLUSMAGS || OPT_PLUSNBR) ) {
+  int  OPT_WRITEBIN  = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_WRITEBIN);
+  if ( !(OPT_PLUSMAGS || OPT_PLUSNBR || OPT_WRITEBIN) ) {
     free(HOSTLIB.LIBINDEX_UNSORT);
   }
 
@@ -4936,7 +5314,8 @@ void  init_SAMEHOST(void) {
 
   // -----------------------------------------
 
-  SAMEHOST.REUSE_FLAG = 0 ;
+  SAMEHOST.REUSE_FLAG    = 0 ;
+  SAMEHOST.IGAL_NEXTFREE = NULL ;
 
   // always allocate NUSE for each host
   i2size = sizeof(unsigned short);
@@ -4959,6 +5338,10 @@ void  init_SAMEHOST(void) {
   // if useOnce-bit it set, then skip init
   if ( USEONCE ) { 
     printf("\t %s: Use a host only once.\n", fnam );
+    // Oct 2026: skip-pointers to jump over used hosts
+    SAMEHOST.IGAL_NEXTFREE = (int*)malloc ( (NGAL+10) * sizeof(int) );
+    for(igal=0; igal < NGAL+10; igal++ ) 
+      { SAMEHOST.IGAL_NEXTFREE[igal] = igal; }
     return ; 
   }
 
@@ -5428,6 +5811,8 @@ void GEN_SNHOST_DRIVER(double ZGEN_HELIO, double PEAKMJD) {
   //  GEN_SNHOST_ZPHOT(IGAL) is moved after DDLR sorting,
   //  which changes random sync.
   //
+  // Oct 16 2026: timing counters for NBR and DDLR (HOSTLIB_SKYINDEX)
+  //
 
   int    USE, IGAL, ilist ;
   double fixran ;
@@ -5481,7 +5866,11 @@ void GEN_SNHOST_DRIVER(double ZGEN_HELIO, double PEAKMJD) {
 
   // - - - - - - - - - - - - - -
   // check for neighbors
+  bool    USE_SKYINDEX = HOSTLIB_SKYINDEX.USE ;
+  clock_t t0 = 0, t1 = 0 ;
+  if ( USE_SKYINDEX ) { t0 = clock(); }
   GEN_SNHOST_NBR(IGAL);
+  if ( USE_SKYINDEX ) { t1 = clock(); }
     
   // determine DDLR and ordered list
   for(ilist=0; ilist < SNHOSTGAL.NNBR_ALL; ilist++ ) 
@@ -5490,6 +5879,13 @@ void GEN_SNHOST_DRIVER(double ZGEN_HELIO, double PEAKMJD) {
   // sort by DDLR
   SORT_SNHOST_byDDLR();
 
+  // Oct 2026: timing counters for sky-index summary
+  if ( USE_SKYINDEX ) {
+    HOSTLIB_SKYINDEX.NCALL_NBR++ ;  HOSTLIB_SKYINDEX.NCALL_DDLR++ ;
+    HOSTLIB_SKYINDEX.T_NBR  += (double)(t1-t0)      / CLOCKS_PER_SEC ;
+    HOSTLIB_SKYINDEX.T_DDLR += (double)(clock()-t1) / CLOCKS_PER_SEC ;
+  }
+
   // - - - - - - 
   // check on host photoz
   GEN_SNHOST_ZPHOT(IGAL);
@@ -5543,6 +5939,7 @@ void GEN_SNHOST_GALID(double ZGEN) {
   //
   // Nov 23 2019: for MODEL_SIMLIB, force GALID to value in SIMLIB header.
   // Dec 30 2021: minor refactor to make igal loops faster with binary search.
+  // Oct 16 2026: for USEONCE, use nextFree_SAMEHOST to skip used hosts.
 
   bool DO_SN2GAL_Z  = (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_SN2GAL_Z);
 
@@ -5558,7 +5955,7 @@ void GEN_SNHOST_GALID(double ZGEN) {
   int  IZ_CEN, IZ_TOLMIN, IZ_TOLMAX ;
   int  IGAL_SELECT, igal_start, igal_end, igal;
   int  igal0, igal1, igal_middle;
-  int  igal_start_init, igal_end_init ;
+  int  igal_start_init, igal_end_init, igal_free ;
   int  NSKIP_WGT, NSKIP_USED, NGAL_CHECK, MATCH, ibin_SNVAR=-9; 
   long long GALID ;
   double ZTRUE, LOGZGEN, LOGZTOLMIN, LOGZTOLMAX, LOGZDIF ;
@@ -5789,6 +6186,15 @@ void GEN_SNHOST_GALID(double ZGEN) {
     if ( WGT <  WGT_select  )  
       { NSKIP_WGT++; continue ; }
     
+    // Oct 2026: for USEONCE, jump directly to next unused host
+    // (same selection as stepping one igal at a time)
+    if ( USEONCE ) {
+      igal_free   = nextFree_SAMEHOST(igal);
+      NSKIP_USED += (igal_free - igal);
+      igal        = igal_free ;
+      if ( igal > igal_end ) { break; }
+    }
+
     if ( USEHOST_GALID(igal) == 0 ) 
       { NSKIP_USED++ ; continue ; }
     
@@ -6053,6 +6459,47 @@ void FREEHOST_GALID(int IGAL) {
 
 } // end UNUSE_HOST_GALID
 
+// =========================================
+int nextFree_SAMEHOST(int IGAL) {
+
+  // Created Oct 16 2026
+  // For USEONCE option, return first igal >= IGAL that has not
+  // been used (NUSE=0); returns NGAL_STORE if all are used.
+  // Since a used host is never freed with USEONCE, skip-pointers
+  // are path-compressed so that a long run of used hosts is
+  // traversed only once instead of for every event.
+  // If skip-pointers are not allocated, just return IGAL.
+
+  int *NEXT = SAMEHOST.IGAL_NEXTFREE ;
+  int  NGAL = HOSTLIB.NGAL_STORE ;
+  int  igal, igal_free, igal_next ;
+
+  // ------------ BEGIN -------------
+
+  if ( NEXT == NULL ) { return IGAL; }
+
+  // find first unused host
+  igal = IGAL ;
+  while ( igal < NGAL && SAMEHOST.NUSE[igal] > 0 ) {
+    igal_next = NEXT[igal];
+    if ( igal_next <= igal ) { igal_next = igal + 1; }
+    igal = igal_next ;
+  }
+  igal_free = igal ;
+
+  // path compression: used hosts along path point to igal_free
+  igal = IGAL ;
+  while ( igal < igal_free ) {
+    igal_next = NEXT[igal];
+    if ( igal_next <= igal ) { igal_next = igal + 1; }
+    NEXT[igal] = igal_free ;
+    igal = igal_next ;
+  }
+
+  return igal_free ;
+
+} // end nextFree_SAMEHOST
+
 // =========================================
 void GEN_SNHOST_ZPHOT(int IGAL) {
 
@@ -7307,6 +7754,8 @@ void GEN_SNHOST_NBR(int IGAL) {
   // to SNHOSTGAL.IGAL_NBR_LIST
   //
   // Jun 29 2021: change rownum-1 to rownum to fix index bug.
+  // Oct 16 2026: use NBR list parsed in init_NBR_SKYINDEX_HOSTLIB
+  //              if HOSTLIB_MSKOPT_SKYINDEX bit is set.
 
   int  NBAND_SNR_DETECT = INPUTS.HOSTLIB_NBAND_SNR_DETECT ;
   int  LDMP = 0 ; // ( NCALL_GEN_SNHOST_DRIVER < 20 );
@@ -7333,6 +7782,18 @@ void GEN_SNHOST_NBR(int IGAL) {
   // bail if there is no NBR list
   if ( HOSTLIB.IVAR_NBR_LIST < 0 ) { goto SNR_DETECT ; }
 
+  // Oct 2026: use NBR list parsed at init
+  if ( HOSTLIB_SKYINDEX.NBR_PTR != NULL ) {
+    for(i = HOSTLIB_SKYINDEX.NBR_PTR[IGAL]; 
+	i < HOSTLIB_SKYINDEX.NBR_PTR[IGAL+1]; i++ ) {
+      ii = NNBR_STORE; NNBR_STORE++ ;
+      SNHOSTGAL.IGAL_NBR_LIST[ii] = HOSTLIB_SKYINDEX.NBR_IGAL[i] ;
+      ROWNUM_LIST[ii] = -9 ;
+    }
+    SNHOSTGAL.NNBR_ALL = NNBR_STORE ;
+    goto SNR_DETECT ;
+  }
+
   sprintf(NBR_LIST, "%s", HOSTLIB.NBR_ZSORTED[IGAL] );
   GALID      = get_GALID_HOSTLIB(IGAL);
 
@@ -7446,6 +7907,352 @@ void GEN_SNHOST_NBR(int IGAL) {
 
 } // end GEN_SNHOST_NBR
 
+// ========================================
+void init_SKYINDEX_HOSTLIB(void) {
+
+  // Created Oct 16 2026
+  // If HOSTLIB_MSKOPT_SKYINDEX bit is set, 
+  //  + parse optional NBR_LIST column once (instead of for each event)
+  //  + for +HOSTNBR option, build sky-position index so that the
+  //    neighbor search checks only galaxies in nearby RA/DEC cells
+  //    instead of every galaxy in the DEC stripe.
+  //
+  // The index stores only occupied cells, sorted by cell key, so that
+  // memory scales with NGAL and a cell lookup is a binary search.
+
+  int  MSKOPT   = INPUTS.HOSTLIB_MSKOPT ;
+  int  NGAL     = HOSTLIB.NGAL_STORE ;
+  int  IVAR_RA  = HOSTLIB.IVAR_RA ;
+  int  IVAR_DEC = HOSTLIB.IVAR_DEC ;
+  int  MEMI     = NGAL * sizeof(int);
+  int  MEMD     = NGAL * sizeof(double);
+  double RAD    = RADIAN ;
+
+  int    igal, isort, iband, NBAND, NCELL, icell_ra, ORDER_SORT = +1 ;
+  double H, DEC, DECMAX, *KEY, KEY_LAST ;
+  clock_t t0 = clock();
+  char fnam[] = "init_SKYINDEX_HOSTLIB" ;
+
+  // ----------- BEGIN ------------
+
+  HOSTLIB_SKYINDEX.USE          = false ;
+  HOSTLIB_SKYINDEX.NCELL        = 0 ;
+  HOSTLIB_SKYINDEX.NBR_PTR      = NULL ;
+  HOSTLIB_SKYINDEX.NCALL_SEARCH = 0 ;
+  HOSTLIB_SKYINDEX.NCALL_NBR    = 0 ;
+  HOSTLIB_SKYINDEX.NCALL_DDLR   = 0 ;
+  HOSTLIB_SKYINDEX.NGAL_CHECK   = 0 ;
+  HOSTLIB_SKYINDEX.T_INIT   = HOSTLIB_SKYINDEX.T_SEARCH = 0.0 ;
+  HOSTLIB_SKYINDEX.T_NBR    = HOSTLIB_SKYINDEX.T_DDLR   = 0.0 ;
+
+  if ( (MSKOPT & HOSTLIB_MSKOPT_SKYINDEX) == 0 ) { return; }
+
+  HOSTLIB_SKYINDEX.USE = true ;
+
+  if ( HOSTLIB.IVAR_NBR_LIST > 0 ) { init_NBR_SKYINDEX_HOSTLIB(); }
+
+  if ( (MSKOPT & HOSTLIB_MSKOPT_PLUSNBR) == 0 ) { goto DONE; }
+
+  if ( IVAR_RA < 0 || IVAR_DEC < 0 ) {
+    sprintf(c1err,"Must include galaxy coords to build sky index.");
+    sprintf(c2err,"Check VARNAMES in HOSTLIB");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  // cell size is the neighbor-search radius
+  H     = HOSTLIB_NBR_WRITE.SEPNBR_MAX / 3600.0 ;
+  NBAND = (int)ceil(180.0/H) ;
+  HOSTLIB_SKYINDEX.CELLSIZE  = H ;
+  HOSTLIB_SKYINDEX.NBAND_DEC = NBAND ;
+  HOSTLIB_SKYINDEX.NCELL_RA  = (int*)malloc(NBAND*sizeof(int));
+
+  for(iband=0; iband < NBAND; iband++ ) {
+    // largest |DEC| in this band sets the narrowest RA cell
+    DEC    = -90.0 + H*(double)iband ;
+    DECMAX = fmax( fabs(DEC), fabs(DEC+H) );
+    if ( DECMAX > 90.0 ) { DECMAX = 90.0; }
+    NCELL  = (int)( 360.0*cos(RAD*DECMAX)/H );
+    if ( NCELL < 1 ) { NCELL = 1; }
+    if ( NCELL >= MXCELL_SKYINDEX_HOSTLIB ) 
+      { NCELL = MXCELL_SKYINDEX_HOSTLIB - 1; }
+    HOSTLIB_SKYINDEX.NCELL_RA[iband] = NCELL ;
+  }
+
+  // compute cell key for each galaxy, then sort by key
+  KEY = (double*)malloc(MEMD);
+  HOSTLIB_SKYINDEX.CELL_IGAL = (int*)malloc(MEMI);
+  HOSTLIB_SKYINDEX.CELL_KEY  = (double*)malloc(MEMD);
+  HOSTLIB_SKYINDEX.CELL_PTR  = (int*)malloc(MEMI+sizeof(int));
+
+  for(igal=0; igal < NGAL; igal++ ) {
+    DEC   = HOSTLIB.VALUE_ZSORTED[IVAR_DEC][igal] ;
+    iband = (int)((DEC+90.0)/H) ;
+    if ( iband < 0      ) { iband = 0; }
+    if ( iband >= NBAND ) { iband = NBAND-1; }
+    KEY[igal] = key_SKYINDEX_HOSTLIB(iband, 
+				     HOSTLIB.VALUE_ZSORTED[IVAR_RA][igal],
+				     &icell_ra);
+  }
+
+  sortDouble(NGAL, KEY, ORDER_SORT, HOSTLIB_SKYINDEX.CELL_IGAL);
+
+  NCELL = 0;  KEY_LAST = -1.0 ;
+  for(isort=0; isort < NGAL; isort++ ) {
+    igal = HOSTLIB_SKYINDEX.CELL_IGAL[isort] ;
+    if ( KEY[igal] != KEY_LAST ) {
+      HOSTLIB_SKYINDEX.CELL_KEY[NCELL] = KEY[igal] ;
+      HOSTLIB_SKYINDEX.CELL_PTR[NCELL] = isort ;
+      NCELL++ ;  KEY_LAST = KEY[igal];
+    }
+  }
+  HOSTLIB_SKYINDEX.CELL_PTR[NCELL] = NGAL ;
+  HOSTLIB_SKYINDEX.NCELL = NCELL ;
+  free(KEY);
+
+  printf("\t Sky index: %d occupied cells (%.2f arcsec) in %d DEC bands\n",
+	 NCELL, 3600.0*H, NBAND);
+  fflush(stdout);
+
+ DONE:
+  HOSTLIB_SKYINDEX.T_INIT = (double)(clock()-t0) / (double)CLOCKS_PER_SEC ;
+
+  return ;
+
+} // end init_SKYINDEX_HOSTLIB
+
+
+// ========================================
+void init_NBR_SKYINDEX_HOSTLIB(void) {
+
+  // Created Oct 16 2026
+  // Parse NBR_LIST for each galaxy once, and store z-sorted IGAL of
+  // each neighbor in CSR format, so that GEN_SNHOST_NBR does not need
+  // to split and translate the NBR_LIST string for each event.
+  // Translation of row numbers is the same as in GEN_SNHOST_NBR.
+
+  int  NGAL = HOSTLIB.NGAL_STORE ;
+  int  igal, i, NNBR_READ, NNBR_TOT, rowNum, IGAL_STORE, MXNBR_TOT ;
+  long long GALID ;
+  char NBR_LIST[MXCHAR_NBR_LIST] ;
+  char NO_NBR[] = "-1" ;
+  char fnam[] = "init_NBR_SKYINDEX_HOSTLIB" ;
+
+  // ----------- BEGIN ------------
+
+  // same restriction as in GEN_SNHOST_NBR; leave NBR_PTR=NULL
+  // so that GEN_SNHOST_NBR aborts when neighbors are used.
+  if ( INPUTS.HOSTLIB_MAXREAD < MXROW_HOSTLIB ) { return; }
+
+  MXNBR_TOT = NGAL ;
+  HOSTLIB_SKYINDEX.NBR_PTR  = (int*)malloc((NGAL+1)*sizeof(int));
+  HOSTLIB_SKYINDEX.NBR_IGAL = (int*)malloc(MXNBR_TOT*sizeof(int));
+  NNBR_TOT = 0 ;
+
+  for(igal=0; igal < NGAL; igal++ ) {
+    HOSTLIB_SKYINDEX.NBR_PTR[igal] = NNBR_TOT ;
+
+    sprintf(NBR_LIST, "%s", HOSTLIB.NBR_ZSORTED[igal] );
+    if ( strcmp(NBR_LIST,NO_NBR) == 0 ) { continue ; }
+
+    splitString2(NBR_LIST, COMMA, MXNBR_LIST, &NNBR_READ, TMPWORD_HOSTLIB);
+    if ( NNBR_READ > MXNBR_LIST-1 ) { NNBR_READ = MXNBR_LIST-1; }
+
+    for(i=0; i < NNBR_READ; i++ ) {
+      sscanf(TMPWORD_HOSTLIB[i], "%d", &rowNum);
+      if ( rowNum < 0 || rowNum > HOSTLIB.NGAL_READ ) {
+	GALID = get_GALID_HOSTLIB(igal);
+	sprintf(c1err,"Invalid rowNum=%d (NGAL_READ=%d)", 
+		rowNum, HOSTLIB.NGAL_READ);
+	sprintf(c2err,"GALID=%lld NBR_LIST=%s", 
+		GALID, HOSTLIB.NBR_ZSORTED[igal]);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err);       
+      }
+
+      IGAL_STORE = HOSTLIB.LIBINDEX_READ[rowNum];
+      if ( IGAL_STORE < 0 ) { continue; } // neighbor was cut from sample
+
+      if ( NNBR_TOT == MXNBR_TOT ) {
+	MXNBR_TOT *= 2 ;
+	HOSTLIB_SKYINDEX.NBR_IGAL = 
+	  (int*)realloc(HOSTLIB_SKYINDEX.NBR_IGAL, MXNBR_TOT*sizeof(int));
+      }
+      HOSTLIB_SKYINDEX.NBR_IGAL[NNBR_TOT] = 
+	HOSTLIB.LIBINDEX_ZSORT[IGAL_STORE] ;
+      NNBR_TOT++ ;
+    }
+  }
+  HOSTLIB_SKYINDEX.NBR_PTR[NGAL] = NNBR_TOT ;
+
+  printf("\t Parsed %d NBR_LIST entries for %d galaxies.\n", 
+	 NNBR_TOT, NGAL);
+  fflush(stdout);
+
+  return ;
+
+} // end init_NBR_SKYINDEX_HOSTLIB
+
+
+// ========================================
+double key_SKYINDEX_HOSTLIB(int iband, double RA, int *icell_ra) {
+
+  // Created Oct 16 2026
+  // Return sky-index key for DEC band iband and RA (deg);
+  // also return RA-cell index icell_ra.
+
+  int    NCELL = HOSTLIB_SKYINDEX.NCELL_RA[iband] ;
+  double RA_LOCAL = fmod(RA,360.0);
+  int    icell ;
+  // ----------- BEGIN ------------
+  if ( RA_LOCAL < 0.0 ) { RA_LOCAL += 360.0; }
+  icell = (int)( RA_LOCAL * (double)NCELL / 360.0 );
+  if ( icell >= NCELL ) { icell = NCELL-1; }
+  *icell_ra = icell;
+  return( (double)iband * (double)MXCELL_SKYINDEX_HOSTLIB + (double)icell );
+} // end key_SKYINDEX_HOSTLIB
+
+
+// ========================================
+int search_SKYINDEX_HOSTLIB(double RA, double DEC, double SEPMAX, 
+			    int IGAL_SKIP, int MXLIST, 
+			    int *IGAL_LIST, double *SEP_LIST) {
+
+  // Created Oct 16 2026
+  // Use sky index to find galaxies within SEPMAX (arcsec) of RA,DEC.
+  // Inputs:
+  //   RA,DEC    : search center (deg)
+  //   SEPMAX    : search radius (arcsec)
+  //   IGAL_SKIP : z-sorted IGAL to exclude (e.g., galaxy at RA,DEC)
+  //   MXLIST    : max size of output lists; if there are more, keep
+  //               the MXLIST nearest galaxies.
+  //
+  // Outputs:
+  //   IGAL_LIST : z-sorted IGAL of each neighbor (not sorted by SEP)
+  //   SEP_LIST  : angular separation (arcsec) for each neighbor
+  //
+  // Function returns number of neighbors.
+
+  int    IVAR_RA  = HOSTLIB.IVAR_RA ;
+  int    IVAR_DEC = HOSTLIB.IVAR_DEC ;
+  int    NBAND    = HOSTLIB_SKYINDEX.NBAND_DEC ;
+  double H        = HOSTLIB_SKYINDEX.CELLSIZE ;
+  double SEPDEG   = SEPMAX / 3600.0 ;
+  double RAD      = RADIAN ;
+  double ASEC_PER_DEG = 3600.0 ;
+
+  int    NNBR = 0, NB, iband, iband0, NCELL_RA, icell, ic, ic1, ic2, ic_wrap;
+  int    lo, hi, mid, isort, igal, i, imax ;
+  double DECABS, dRA, WIDTH, KEY, SEP, RA_GAL, DEC_GAL ;
+  clock_t t0 = clock();
+  // ----------- BEGIN ------------
+
+  HOSTLIB_SKYINDEX.NCALL_SEARCH++ ;
+
+  NB     = (int)ceil(SEPDEG/H) ;
+  iband0 = (int)((DEC+90.0)/H) ;
+
+  DECABS = fabs(DEC) + SEPDEG ;
+  if ( DECABS < 89.9 ) 
+    { dRA = SEPDEG / cos(RAD*DECABS); }
+  else
+    { dRA = 360.0 ; } // near pole -> check all RA
+
+  for(iband = iband0-NB; iband <= iband0+NB; iband++ ) {
+    if ( iband < 0 || iband >= NBAND ) { continue; }
+
+    NCELL_RA = HOSTLIB_SKYINDEX.NCELL_RA[iband] ;
+    WIDTH    = 360.0 / (double)NCELL_RA ;
+    if ( 2.0*dRA >= 360.0 - WIDTH ) 
+      { ic1 = 0;  ic2 = NCELL_RA-1; }
+    else {
+      ic1 = (int)floor( (RA-dRA)/WIDTH );
+      ic2 = (int)floor( (RA+dRA)/WIDTH );
+    }
+
+    for(ic=ic1; ic <= ic2; ic++ ) {
+      ic_wrap = ((ic % NCELL_RA) + NCELL_RA) % NCELL_RA ;
+      KEY = (double)iband*(double)MXCELL_SKYINDEX_HOSTLIB + (double)ic_wrap;
+
+      // binary search for occupied cell with this key
+      lo = 0;  hi = HOSTLIB_SKYINDEX.NCELL - 1;  icell = -9;
+      while ( lo <= hi ) {
+	mid = (lo+hi)/2 ;
+	if      ( HOSTLIB_SKYINDEX.CELL_KEY[mid] < KEY ) { lo = mid+1; }
+	else if ( HOSTLIB_SKYINDEX.CELL_KEY[mid] > KEY ) { hi = mid-1; }
+	else    { icell = mid;  break; }
+      }
+      if ( icell < 0 ) { continue; }
+
+      for(isort = HOSTLIB_SKYINDEX.CELL_PTR[icell]; 
+	  isort < HOSTLIB_SKYINDEX.CELL_PTR[icell+1]; isort++ ) {
+	igal = HOSTLIB_SKYINDEX.CELL_IGAL[isort] ;
+	if ( igal == IGAL_SKIP ) { continue; }
+	HOSTLIB_SKYINDEX.NGAL_CHECK++ ;
+
+	DEC_GAL = HOSTLIB.VALUE_ZSORTED[IVAR_DEC][igal] ;
+	if ( fabs(DEC_GAL-DEC) > SEPDEG ) { continue; }
+	RA_GAL  = HOSTLIB.VALUE_ZSORTED[IVAR_RA][igal] ;
+	SEP     = angSep(RA, DEC, RA_GAL, DEC_GAL, ASEC_PER_DEG);
+	if ( SEP > SEPMAX ) { continue; }
+
+	if ( NNBR < MXLIST ) 
+	  { IGAL_LIST[NNBR] = igal;  SEP_LIST[NNBR] = SEP;  NNBR++ ; }
+	else {
+	  // list is full: replace farthest neighbor if this one is closer
+	  imax = 0 ;
+	  for(i=1; i < NNBR; i++ ) 
+	    { if ( SEP_LIST[i] > SEP_LIST[imax] ) { imax = i; } }
+	  if ( SEP < SEP_LIST[imax] ) 
+	    { IGAL_LIST[imax] = igal;  SEP_LIST[imax] = SEP; }
+	}
+      } // end isort
+    } // end ic
+  } // end iband
+
+  HOSTLIB_SKYINDEX.T_SEARCH += 
+    (double)(clock()-t0) / (double)CLOCKS_PER_SEC ;
+
+  return(NNBR) ;
+
+} // end search_SKYINDEX_HOSTLIB
+
+
+// ========================================
+void summary_SKYINDEX_HOSTLIB(void) {
+
+  // Created Oct 16 2026
+  // Print sky-index info and timing counters.
+
+  int    NCALL ;
+  double XN ;
+  // ----------- BEGIN ------------
+
+  if ( !HOSTLIB_SKYINDEX.USE ) { return; }
+
+  printf("\n HOSTLIB sky-index summary: \n");
+  printf("\t Init time: %.3f sec  (NCELL=%d) \n",
+	 HOSTLIB_SKYINDEX.T_INIT, HOSTLIB_SKYINDEX.NCELL );
+
+  NCALL = HOSTLIB_SKYINDEX.NCALL_SEARCH ;
+  if ( NCALL > 0 ) {
+    XN = (double)HOSTLIB_SKYINDEX.NGAL_CHECK / (double)NCALL ;
+    printf("\t NBR search: %8d calls, %.3f sec, <NGAL checked>=%.1f \n",
+	   NCALL, HOSTLIB_SKYINDEX.T_SEARCH, XN );
+  }
+
+  NCALL = HOSTLIB_SKYINDEX.NCALL_NBR ;
+  if ( NCALL > 0 ) {
+    printf("\t GEN_SNHOST_NBR      : %8d calls, %.3f sec \n",
+	   NCALL, HOSTLIB_SKYINDEX.T_NBR );
+    printf("\t DDLR calc + sorting : %8d calls, %.3f sec \n",
+	   HOSTLIB_SKYINDEX.NCALL_DDLR, HOSTLIB_SKYINDEX.T_DDLR );
+  }
+  fflush(stdout);
+
+  return ;
+
+} // end summary_SKYINDEX_HOSTLIB
+
+
 
 // ==================================
 bool snr_detect_HOSTLIB(int IGAL) {
@@ -9121,6 +9928,7 @@ void rewrite_HOSTLIB(HOSTLIB_APPEND_DEF *HOSTLIB_APPEND) {
   // Passed here via *HOSTLIB_APPEND.
   // 
   // July 16 2021: write DOCANA keys to FP_NEW
+  // Oct 16 2026: abort for binary HOSTLIB
 
   char *SUFFIX       = HOSTLIB_APPEND->FILENAME_SUFFIX; // or new HOSTLIB
   int  NLINE_COMMENT = HOSTLIB_APPEND->NLINE_COMMENT;
@@ -9135,6 +9943,12 @@ void rewrite_HOSTLIB(HOSTLIB_APPEND_DEF *HOSTLIB_APPEND) {
 
   // -------------- BEGIN --------------
 
+  if ( HOSTLIB_BINARY.USE ) {
+    sprintf(c1err,"Cannot append columns to binary HOSTLIB");
+    sprintf(c2err,"Use text HOSTLIB_FILE instead of '%s'", HLIB_ORIG);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
   // create local string with name of HOSTLIB
   sprintf(HLIB_TMP,"%s%s", HLIB_ORIG, SUFFIX ); 
 
@@ -9687,6 +10501,7 @@ void rewrite_HOSTLIB_plusNbr(void) {
 
   // write out monitor info
   monitor_HOSTLIB_plusNbr(1,&HOSTLIB_APPEND);
+  summary_SKYINDEX_HOSTLIB();
 
   // execute re-write
   rewrite_HOSTLIB(&HOSTLIB_APPEND);
@@ -9703,6 +10518,9 @@ void get_LINE_APPEND_HOSTLIB_plusNbr(int igal_unsort, char *LINE_APPEND) {
 
   // Return LINE_APPEND = original line for igal_unsort plus list of
   // neighbors.
+  //
+  // Oct 16 2026: if sky index exists, use search_SKYINDEX_HOSTLIB
+  //   instead of walking along the DEC-sorted list.
 
 #define MXNNBR_STORE 100         // max number of neighbors to track
   double SEPNBR_MAX      = HOSTLIB_NBR_WRITE.SEPNBR_MAX ;
@@ -9748,6 +10566,25 @@ void get_LINE_APPEND_HOSTLIB_plusNbr(int igal_unsort, char *LINE_APPEND) {
   LINE_STDOUT[0] = 0 ;
   NNBR = NTRY = 0 ; NPASS_DEC = 1;  ISORT_CHANGE=1;
 
+  // Oct 2026: check option to search only nearby cells of sky index
+  if ( HOSTLIB_SKYINDEX.NCELL > 0 ) {
+    int IGAL_ZLIST[MXNNBR_STORE];
+    NNBR = search_SKYINDEX_HOSTLIB(RA_GAL, DEC_GAL, SEPNBR_MAX, igal_zsort,
+				   MXNNBR_STORE, IGAL_ZLIST, SEP_NBR_LIST);
+    for(j=0; j < NNBR; j++ ) {
+      igal2_zsort   = IGAL_ZLIST[j];
+      IGAL_LIST[j]  = HOSTLIB.LIBINDEX_UNSORT[igal2_zsort];
+      GALID_LIST[j] = 
+	(long long)HOSTLIB.VALUE_ZSORTED[IVAR_GALID][igal2_zsort] ;
+    }
+    NTRY = NNBR ;
+    if ( NNBR > HOSTLIB_NBR_WRITE.NNBR_MAX ) { 
+      HOSTLIB_NBR_WRITE.NNBR_MAX = NNBR; 
+      HOSTLIB_NBR_WRITE.GALID_atNNBR_MAX = GALID;
+    }
+    NPASS_DEC = 0 ; // skip DEC-sorted search below
+  }
+
   while ( NPASS_DEC > 0 ) {
     NPASS_DEC = 0;
 
@@ -10014,3 +10851,237 @@ void rewrite_HOSTLIB_plusAppend(char *append_file) {
 
 } // end rewrite_HOSTLIB_plusAppend
 
+
+// ==============================
+void rewrite_HOSTLIB_BINARY(void) {
+
+  // Created Oct 16 2026
+  // Write binary version of HOSTLIB (+HOSTBINARY option) that can be 
+  // used as HOSTLIB_FILE to skip text parsing and sorting at each 
+  // sim start; see HOSTLIB_BINARY_HEAD_DEF for format.
+  // HOSTLIB has already been read without cuts (HOSTLIB_USE=2), but 
+  // only for the columns needed by this sim job. Here the text file is
+  // read again to store all columns, and the rows are written in the
+  // redshift-sorted order from sortz_HOSTLIB (LIBINDEX_UNSORT).
+  // A few text lines are parsed with a simple fgets so that the text
+  // header is stored exactly as in the original file.
+
+  int  NROW     = HOSTLIB.NGAL_STORE ;
+  int  NVAR_ALL = HOSTLIB.NVAR_ALL ;
+  int  ICOL_FIELD    = -9 ;
+  int  ICOL_NBR_LIST = -9 ;
+  int  ICOL_GALID    = HOSTLIB.IVAR_ALL[HOSTLIB.IVAR_GALID] ;
+
+  HOSTLIB_BINARY_HEAD_DEF HEAD ;
+  FILE  *FP_ORIG, *FP_NEW ;
+  int    gzipFlag, irow, irow_orig, igal_zsort, icol, LEN, MEMHEAD ;
+  long long GALID, GALID_orig, LEN_STRING, *STRPTR ;
+  double xval[MXVAR_HOSTLIB], *VALUE_ALL, *COL ;
+  char  **FIELD_ALL = NULL, **NBR_ALL = NULL, *HEADTEXT, *ptrSuffix ;
+  char   FIELD[MXCHAR_FIELDNAME], NBR_LIST[MXCHAR_NBR_LIST], c_get[200] ;
+  char   LINE[MXCHAR_LINE_HOSTLIB], HLIB_TMP[MXPATHLEN], DUMPATH[MXPATHLEN];
+  char   HLIB_NEW[MXPATHLEN], HLIB_NEW_TMP[MXPATHLEN+20] ;
+  char   zero[8] = { 0, 0, 0, 0, 0, 0, 0, 0 } ;
+  char fnam[] = "rewrite_HOSTLIB_BINARY" ;
+
+  // --------------- BEGIN ---------------
+
+  print_banner(fnam);
+
+  if ( HOSTLIB_BINARY.USE ) {
+    sprintf(c1err,"HOSTLIB_FILE is already binary");
+    sprintf(c2err,"Check HOSTLIB_FILE='%s'", INPUTS.HOSTLIB_FILE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+  if ( HOSTLIB.NGAL_READ != NROW ) {
+    sprintf(c1err,"Stored %d of %d HOSTLIB rows", NROW, HOSTLIB.NGAL_READ);
+    sprintf(c2err,"Binary HOSTLIB requires all rows (remove HOSTLIB_MAXREAD)");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+  if ( INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_SWAPZPHOT ) {
+    sprintf(c1err,"Cannot write binary HOSTLIB with SWAPZPHOT option");
+    sprintf(c2err,"because rows are sorted by true redshift.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+  if ( INPUTS.HOSTLIB_ABMAG_FORCE > -8.0 ) {
+    sprintf(c1err,"Cannot write binary HOSTLIB with HOSTLIB_ABMAG_FORCE");
+    sprintf(c2err,"Remove HOSTLIB_ABMAG_FORCE key.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  if ( HOSTLIB.IVAR_FIELD > 0 ) 
+    { ICOL_FIELD = HOSTLIB.IVAR_ALL[HOSTLIB.IVAR_FIELD] ; }
+  if ( HOSTLIB.IVAR_NBR_LIST > 0 ) 
+    { ICOL_NBR_LIST = HOSTLIB.IVAR_ALL[HOSTLIB.IVAR_NBR_LIST] ; }
+
+  // - - - - - - - - - - - - 
+  // store text header up to first GAL key; end with GAL key so that
+  // header readers stop as for text HOSTLIB.
+  FP_ORIG = open_TEXTgz(HOSTLIB.FILENAME, "rt", &gzipFlag );
+  if ( !FP_ORIG ) {
+    sprintf(c1err,"Could not open original HOSTLIB_FILE");
+    sprintf(c2err,"'%s' ", HOSTLIB.FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  MEMHEAD  = 100000;  LEN = 0 ;
+  HEADTEXT = (char*) malloc(MEMHEAD*sizeof(char)) ;  HEADTEXT[0] = 0 ;
+  while ( fgets(LINE, MXCHAR_LINE_HOSTLIB, FP_ORIG) != NULL ) {
+    c_get[0] = 0 ;  sscanf(LINE, "%s", c_get);
+    if ( strcmp(c_get,"GAL:") == 0 ) { break; }
+    if ( LEN + strlen(LINE) + 10 > MEMHEAD ) {
+      MEMHEAD  += 100000 ;
+      HEADTEXT  = (char*) realloc(HEADTEXT, MEMHEAD*sizeof(char) );
+    }
+    strcat(HEADTEXT+LEN, LINE);  LEN += strlen(LINE);
+  }
+  strcat(HEADTEXT+LEN, "GAL:\n");  LEN += strlen("GAL:\n");
+  if(gzipFlag ) { pclose(FP_ORIG); }  else { fclose(FP_ORIG); }
+
+  // - - - - - - - - - - - - 
+  // read all columns for all rows in original order
+  printf("\t Read all %d columns for %d rows ... \n", NVAR_ALL, NROW);
+  fflush(stdout);
+
+  VALUE_ALL = (double*) malloc( (long long)NVAR_ALL*NROW*sizeof(double) );
+  if ( ICOL_FIELD    >= 0 ) { FIELD_ALL = (char**)malloc(NROW*sizeof(char*));}
+  if ( ICOL_NBR_LIST >= 0 ) { NBR_ALL   = (char**)malloc(NROW*sizeof(char*));}
+
+  FP_ORIG = open_TEXTgz(HOSTLIB.FILENAME, "rt", &gzipFlag );
+  irow    = 0 ;
+  while( irow < NROW && fscanf(FP_ORIG, "%s", c_get) != EOF ) {
+    if ( strcmp(c_get,"GAL:") != 0 ) { continue; }
+
+    read_galRow_HOSTLIB(FP_ORIG, NVAR_ALL, xval, FIELD, NBR_LIST ); 
+    for(icol=0; icol < NVAR_ALL; icol++ ) 
+      { VALUE_ALL[(long long)icol*NROW + irow] = xval[icol]; }
+
+    if ( FIELD_ALL != NULL ) {
+      FIELD_ALL[irow] = (char*) malloc( (strlen(FIELD)+1)*sizeof(char) );
+      sprintf(FIELD_ALL[irow], "%s", FIELD);
+    }
+    if ( NBR_ALL != NULL ) {
+      NBR_ALL[irow] = (char*) malloc( (strlen(NBR_LIST)+1)*sizeof(char) );
+      sprintf(NBR_ALL[irow], "%s", NBR_LIST);
+    }
+
+    // make sure GALID matches
+    igal_zsort = HOSTLIB.LIBINDEX_ZSORT[irow] ;
+    GALID      = get_GALID_HOSTLIB(igal_zsort);
+    GALID_orig = (long long)xval[ICOL_GALID] ;
+    if ( GALID != GALID_orig ) {
+      sprintf(c1err,"GALID mis-match for row=%d", irow);
+      sprintf(c2err,"GALID(orig)=%lld, but stored GALID=%lld",
+	      GALID_orig, GALID ) ;
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    }
+    irow++ ;
+  }
+  if(gzipFlag ) { pclose(FP_ORIG); }  else { fclose(FP_ORIG); }
+
+  if ( irow != NROW ) {
+    sprintf(c1err,"Re-read %d GAL rows, but expected %d", irow, NROW);
+    sprintf(c2err,"Check '%s'", HOSTLIB.FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  // - - - - - - - - - - - - 
+  // string offsets for redshift-sorted rows
+  STRPTR     = (long long*) malloc( 2*(NROW+1)*sizeof(long long) );
+  LEN_STRING = 0 ;
+  for(irow=0; irow < NROW; irow++ ) {
+    irow_orig = HOSTLIB.LIBINDEX_UNSORT[irow] ;
+    STRPTR[2*irow+0] = STRPTR[2*irow+1] = -1 ;
+    if ( FIELD_ALL != NULL ) 
+      { STRPTR[2*irow+0] = LEN_STRING; 
+	LEN_STRING += strlen(FIELD_ALL[irow_orig]) + 1 ; }
+    if ( NBR_ALL != NULL ) 
+      { STRPTR[2*irow+1] = LEN_STRING; 
+	LEN_STRING += strlen(NBR_ALL[irow_orig]) + 1 ; }
+  }
+
+  // - - - - - - - - - - - - 
+  // fill header with 8-byte aligned offsets
+#define ALIGN8_HOSTLIB_BINARY(X) ( ((X)+7) & ~7LL )
+  memset(&HEAD, 0, sizeof(HEAD));
+  sprintf(HEAD.MAGIC, "%s", MAGIC_HOSTLIB_BINARY);
+  HEAD.NVAR_ALL        = NVAR_ALL ;
+  HEAD.NROW            = NROW ;
+  HEAD.ICOL_FIELD      = ICOL_FIELD ;
+  HEAD.ICOL_NBR_LIST   = ICOL_NBR_LIST ;
+  HEAD.OFFSET_HEAD     = ALIGN8_HOSTLIB_BINARY((long long)sizeof(HEAD));
+  HEAD.LEN_HEAD        = LEN ;
+  HEAD.OFFSET_VALUE    = ALIGN8_HOSTLIB_BINARY(HEAD.OFFSET_HEAD + LEN);
+  HEAD.OFFSET_ROWINDEX = HEAD.OFFSET_VALUE + 
+    (long long)NVAR_ALL*NROW*sizeof(double);
+  HEAD.OFFSET_STRPTR   = 
+    ALIGN8_HOSTLIB_BINARY(HEAD.OFFSET_ROWINDEX + 
+			  (long long)NROW*sizeof(int) );
+  HEAD.OFFSET_STRING   = HEAD.OFFSET_STRPTR + 
+    2LL*NROW*sizeof(long long) ;
+  HEAD.LEN_STRING      = LEN_STRING ;
+
+  // - - - - - - - - - - - - 
+  // output file name: remove path and .gz, add suffix;
+  // write tmp file and rename so that other jobs never see partial file.
+  sprintf(HLIB_TMP,"%s", INPUTS.HOSTLIB_FILE );
+  ptrSuffix = strstr(HLIB_TMP,".gz");
+  if ( ptrSuffix != NULL && strlen(ptrSuffix) == 3 ) { *ptrSuffix = 0; }
+  strcat(HLIB_TMP, SUFFIX_HOSTLIB_BINARY);
+  extract_MODELNAME(HLIB_TMP, DUMPATH, HLIB_NEW);
+  sprintf(HLIB_NEW_TMP, "%s.tmp%d", HLIB_NEW, (int)getpid() );
+
+  FP_NEW = fopen(HLIB_NEW_TMP, "wb");
+  if ( !FP_NEW ) {
+    sprintf(c1err,"Could not open binary HOSTLIB");
+    sprintf(c2err,"'%s' ", HLIB_NEW_TMP);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  fwrite(&HEAD, sizeof(HEAD), 1, FP_NEW);
+  while ( ftell(FP_NEW) < HEAD.OFFSET_HEAD ) { fwrite(zero,1,1,FP_NEW); }
+  fwrite(HEADTEXT, sizeof(char), LEN, FP_NEW);
+  while ( ftell(FP_NEW) < HEAD.OFFSET_VALUE ) { fwrite(zero,1,1,FP_NEW); }
+
+  // columns in redshift-sorted order
+  COL = (double*) malloc( (NROW+1)*sizeof(double) );
+  for(icol=0; icol < NVAR_ALL; icol++ ) {
+    for(irow=0; irow < NROW; irow++ ) {
+      irow_orig = HOSTLIB.LIBINDEX_UNSORT[irow] ;
+      COL[irow] = VALUE_ALL[(long long)icol*NROW + irow_orig];
+    }
+    fwrite(COL, sizeof(double), NROW, FP_NEW);
+  }
+
+  fwrite(HOSTLIB.LIBINDEX_UNSORT, sizeof(int), NROW, FP_NEW);
+  while ( ftell(FP_NEW) < HEAD.OFFSET_STRPTR ) { fwrite(zero,1,1,FP_NEW); }
+  fwrite(STRPTR, sizeof(long long), 2*NROW, FP_NEW);
+
+  for(irow=0; irow < NROW; irow++ ) {
+    irow_orig = HOSTLIB.LIBINDEX_UNSORT[irow] ;
+    if ( FIELD_ALL != NULL ) 
+      { fwrite(FIELD_ALL[irow_orig], 1, strlen(FIELD_ALL[irow_orig])+1, 
+	       FP_NEW); }
+    if ( NBR_ALL != NULL ) 
+      { fwrite(NBR_ALL[irow_orig], 1, strlen(NBR_ALL[irow_orig])+1, 
+	       FP_NEW); }
+  }
+
+  if ( fclose(FP_NEW) != 0 || rename(HLIB_NEW_TMP,HLIB_NEW) != 0 ) {
+    sprintf(c1err,"Failed writing binary HOSTLIB");
+    sprintf(c2err,"'%s' ", HLIB_NEW);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+  }
+
+  printf("\n  Created '%s' \n", HLIB_NEW);
+  printf("  Wrote %d rows x %d columns (%.1f MB)\n", 
+	 NROW, NVAR_ALL, 
+	 (double)(HEAD.OFFSET_STRING + LEN_STRING)/1.0E6 );
+  fflush(stdout);
+
+  exit(0);
+
+  return ;
+
+} // end rewrite_HOSTLIB_BINARY
+
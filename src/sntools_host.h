@@ -45,6 +45,12 @@
 
  May 5 2022: MXCHAR_LINE_HOSTLIB->900
 
+ Oct 16 2026: define HOSTLIB_MSKOPT_SKYINDEX and HOSTLIB_SKYINDEX struct
+              for sky-position index used in neighbor searches.
+ Oct 16 2026: add SAMEHOST.IGAL_NEXTFREE for fast USEONCE host selection.
+ Oct 16 2026: define HOSTLIB_MSKOPT_WRITEBIN and HOSTLIB_BINARY struct
+              for binary (mmap) HOSTLIB.
+
 ==================================================== */
 
 #define HOSTLIB_MSKOPT_USE           1 // internally set if HOSTLIB_FILE
@@ -65,6 +71,8 @@
 #define HOSTLIB_MSKOPT_PLUSMAGS   8192  // compute & add host mags from SED
 #define HOSTLIB_MSKOPT_PLUSNBR   16384  // append list of nbr to HOSTLIB
 #define HOSTLIB_MSKOPT_ZPHOT_QGAUSS 32768  // write Gauss quantiles for zPHOT
+#define HOSTLIB_MSKOPT_SKYINDEX  65536  // RA/DEC index for NBR search
+#define HOSTLIB_MSKOPT_WRITEBIN 131072  // write binary HOSTLIB and quit
 
 #define HOSTLIB_1DINDEX_ID 10    // ID for 1DINDEX transformations
 
@@ -336,6 +344,69 @@ struct {
 } HOSTLIB_NBR_WRITE ;
 
 
+// Oct 16 2026: optional sky-position index (HOSTLIB_MSKOPT_SKYINDEX).
+// DEC bands have height CELLSIZE, and each band is split into RA cells
+// with width >= CELLSIZE/cos(DEC), so a search radius <= CELLSIZE
+// needs only the neighboring cells. Only occupied cells are stored,
+// sorted by cell key, so that a cell lookup is a binary search.
+// For the sim, NBR_LIST strings are also parsed once at init.
+#define MXCELL_SKYINDEX_HOSTLIB 20000000   // max number of RA cells per band
+struct {
+  bool   USE ;
+  double CELLSIZE ;      // deg (>= neighbor search radius)
+  int    NBAND_DEC ;     // number of DEC bands from -90 to +90
+  int   *NCELL_RA ;      // number of RA cells per DEC band
+  int    NCELL ;         // number of occupied cells
+  double *CELL_KEY ;     // sorted key = iband*MXCELL + icell_ra
+  int   *CELL_PTR ;      // gals in icell are CELL_IGAL[CELL_PTR[icell]...]
+  int   *CELL_IGAL ;     // z-sorted IGAL grouped by cell
+
+  // NBR_LIST parsed at init; z-sorted IGAL (CSR format)
+  int   *NBR_PTR ;       // NBR of IGAL are NBR_IGAL[NBR_PTR[IGAL]...]
+  int   *NBR_IGAL ;
+
+  // diagnostic counters for summary
+  int       NCALL_SEARCH, NCALL_NBR, NCALL_DDLR ;
+  long long NGAL_CHECK ;       // number of galaxies checked in searches
+  double    T_INIT, T_SEARCH, T_NBR, T_DDLR ; // CPU seconds
+} HOSTLIB_SKYINDEX ;
+
+
+// Oct 16 2026: binary HOSTLIB written by +HOSTBINARY option.
+// All columns are stored as double (column-major) in redshift-sorted
+// order, followed by the original row index for each sorted row, and
+// FIELD/NBR_LIST strings. The text header (everything before the first
+// GAL key) is stored as-is so that read_head_HOSTLIB parses it from
+// memory. File is mmap'd MAP_PRIVATE so that jobs on the same node
+// share the page cache.
+#define MAGIC_HOSTLIB_BINARY   "SNANA_HOSTLIB_BINARY_V1"
+#define SUFFIX_HOSTLIB_BINARY  ".BIN"
+typedef struct {
+  char      MAGIC[32] ;
+  int       NVAR_ALL, NROW ;
+  int       ICOL_FIELD, ICOL_NBR_LIST ;  // string column or -9
+  long long OFFSET_HEAD, LEN_HEAD ;      // text header
+  long long OFFSET_VALUE ;               // NVAR_ALL x NROW doubles
+  long long OFFSET_ROWINDEX ;            // NROW ints: orig row number
+  long long OFFSET_STRPTR ;              // 2 x NROW: FIELD,NBR_LIST offsets
+  long long OFFSET_STRING, LEN_STRING ;  // null-terminated strings
+} HOSTLIB_BINARY_HEAD_DEF ;
+
+struct {
+  bool   USE ;           // HOSTLIB_FILE is binary
+  bool   ZERO_COPY ;     // VALUE_ZSORTED points into mmap'd file
+  int    IROW_MIN ;      // first stored row (sorted) if ZERO_COPY
+  char   FILENAME[MXPATHLEN] ;
+  char  *MAP ;
+  size_t MAPSIZE ;
+  HOSTLIB_BINARY_HEAD_DEF *HEAD ;
+  double    *VALUE ;     // VALUE[icol*NROW + irow]
+  int       *ROWINDEX ;
+  long long *STRPTR ;
+  char      *STRING ;
+} HOSTLIB_BINARY ;
+
+
 struct {
   double ZWIN[2], RAWIN[2], DECWIN[2];
 } HOSTLIB_CUTS;
@@ -344,6 +415,7 @@ struct {
 struct SAMEHOST_DEF {
   int REUSE_FLAG ;          // 1-> re-use host
   unsigned short  *NUSE ;     // number of times each host is used.
+  int  *IGAL_NEXTFREE ;       // USEONCE: skip-pointer to next unused host
 
   // define array to store all PEAKMJDs for each host; allows re-using
   // host after NDAYDIF_SAMEGAL. Note 2-byte integers to save memory
@@ -656,6 +728,13 @@ void   GEN_SNHOST_POS(int IGAL);
 void   SIMLIB_SNHOST_POS(int IGAL, SERSIC_DEF *SERSIC, int DEBUG_MODE);
 void   GEN_SNHOST_ANGLE(double a, double b, double *ANGLE);
 void   GEN_SNHOST_NBR(int IGAL);
+void   init_SKYINDEX_HOSTLIB(void);
+void   init_NBR_SKYINDEX_HOSTLIB(void);
+double key_SKYINDEX_HOSTLIB(int iband, double RA, int *icell_ra);
+int    search_SKYINDEX_HOSTLIB(double RA, double DEC, double SEPMAX, 
+			       int IGAL_SKIP, int MXLIST, 
+			       int *IGAL_LIST, double *SEP_LIST);
+void   summary_SKYINDEX_HOSTLIB(void);
 void   GEN_SNHOST_DDLR(int i_nbr);
 void   SORT_SNHOST_byDDLR(void);
 void   reset_SNHOSTGAL_DDLR_SORT(int MAXNBR);
@@ -673,6 +752,7 @@ void   GEN_SNHOST_LOGMASS(void); // Feb 2020
 void   GEN_SNHOST_PROPERTY(int ivar_property); 
 int    USEHOST_GALID(int IGAL) ;
 void   FREEHOST_GALID(int IGAL) ;
+int    nextFree_SAMEHOST(int IGAL);
 void   checkAbort_noHOSTLIB(void) ;
 void   checkAbort_HOSTLIB(void) ;
 
@@ -688,6 +768,7 @@ void   init_REQUIRED_HOSTVAR(void) ;
 int    load_VARNAME_STORE(char *varName) ;
 void   open_HOSTLIB(FILE **fp);
 void   close_HOSTLIB(FILE *fp);
+int    open_HOSTLIB_BINARY(FILE **fp);
 
 void   init_HOSTLIB_WGTMAP(int OPT_INIT, int IGAL_START, int IGAL_END);
 void   read_HOSTLIB_WGTMAP(void);
@@ -708,6 +789,9 @@ void   read_head_HOSTLIB(FILE *fp);
 bool   match_varname_HOSTLIB(char *varName0, char *varName1);
 void   checkAlternateVarNames_HOSTLIB(char *varName) ;
 void   read_gal_HOSTLIB(FILE *fp);
+int    read_gal_HOSTLIB_BINARY(void);
+void   load_row_HOSTLIB_BINARY(int irow, double *xval, char *FIELD,
+			       char *NBR_LIST);
 void   read_galRow_HOSTLIB(FILE *fp, int nval, double *values, 
 			   char *field, char *nbr_list  );
 int    passCuts_HOSTLIB(double *xval);
@@ -785,6 +869,7 @@ void   rewrite_HOSTLIB_plusMags(void);
 void   monitor_HOSTLIB_plusNbr(int OPT, HOSTLIB_APPEND_DEF *HOSTLIB_APPEND);
 
 void   rewrite_HOSTLIB_plusAppend(char *append_file);
+void   rewrite_HOSTLIB_BINARY(void);
 
 double integmag_hostSpec(int IFILT_OBS, double z, int DUMPFLAG);
 
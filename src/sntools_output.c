@@ -73,6 +73,9 @@
  May 30 2020: include sndata.h and remove a few redundant define statements
                in sntools_outout.h
 
+ Oct 16 2026: init READTABLE_CACHE in TABLEFILE_INIT; see optional
+              binary cache for TEXT tables in sntools_output_text.c
+
 ************************************************/
 
 #include <stdio.h>
@@ -84,6 +87,8 @@
 #include <math.h>
 #include <ctype.h>
 #include <sys/stat.h>
+#include <sys/mman.h>  // Oct 2026: mmap for READTABLE_CACHE
+#include <fcntl.h>
 
 // #include "sntools.h"
 #include "sndata.h"
@@ -141,6 +146,9 @@ void TABLEFILE_INIT(void) {
 
   // ------ misc inits -------
   OUTLIER_INFO.USEFLAG = 0 ;
+  READTABLE_CACHE.USE  = READTABLE_CACHE.NHIT = 0 ;
+  READTABLE_CACHE.NMISS = READTABLE_CACHE.NWRITE = 0 ;
+  READTABLE_CACHE.LAST_FILE[0] = 0 ;
   NLINE_TABLECOMMENT = 0 ;
 
   for(o=0; o < MXOPENFLAG; o++ ) {
@@ -30,6 +30,9 @@
  May 02 2020: add spectra format for MARZ (FITS with particular extensions)
  May 30 2020: MXSPEC_SPECPAK -> MXSPECTRA from sndata.h
 
+ Oct 16 2026: define READTABLE_CACHE struct for optional binary
+              columnar cache of TEXT tables (see sntools_output_text.c)
+
 *******************************************/
 
 
@@ -170,6 +173,21 @@ struct READTABLE_POINTERS {
 } READTABLE_POINTERS ;
 
 
+// Oct 16 2026: optional binary columnar cache (sidecar file) for
+//  TEXT tables; first read writes [FILENAME].SNCACHE, and later reads
+//  map the sidecar instead of parsing text. Sidecar is valid only if
+//  size, mtime and checksum of the source file match.
+#define SUFFIX_READTABLE_CACHE  "SNCACHE"
+#define MAGIC_READTABLE_CACHE   "SNTABLE_CACHE_V1"
+struct {
+  int  USE ;                       // 1 -> read/write cache sidecar
+  int  NHIT, NMISS, NWRITE ;       // stats for summary
+  char LAST_FILE[MXCHAR_FILENAME]; // memo of last checksum calc
+  long long int LAST_SIZE, LAST_MTIME ;
+  unsigned long long int LAST_CHECKSUM ;
+} READTABLE_CACHE ;
+
+
 // -------------------------------------------------
 // SNLCPAK global declarations for light curves
 
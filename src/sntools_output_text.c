@@ -59,6 +59,8 @@
 //
 // Jan 4 2021: MXCHAR_LINE -> 3200 (was 2500)
 // Sep 07 2021: abort if found too few variables (SNTABLE_READ_EXEC_TEXT)
+// Oct 16 2026: optional binary columnar cache for reading tables;
+//              see SNTABLE_READ_CACHE_TEXT and SNTABLE_WRITE_CACHE_TEXT
 //
 // **********************************************
 
@@ -126,6 +128,23 @@ struct TABLEINFO_TEXT {
 } TABLEINFO_TEXT ;
 
 
+// Oct 16 2026: header and column descriptor for binary cache sidecar
+typedef struct {
+  char MAGIC[24];
+  long long int SIZE_SRC, MTIME_SRC ;
+  unsigned long long int CHECKSUM_SRC ;
+  int  NROW, NCOL ;
+} HEADER_CACHE_TEXT ;
+
+typedef struct {
+  char VARNAME[MXCHAR_VARNAME];
+  int  ICAST ;
+  int  NDICT, LENDICT ;    // for char column
+  long long int OFFSET ;   // byte offset of column block from file start
+  long long int NBYTE ;    // size of column block
+} COLUMN_CACHE_TEXT ;
+
+
 // -----------------------------
 
 #ifdef __cplusplus
@@ -178,6 +197,14 @@ extern"C" {
   int  SNTABLE_READ_EXEC_TEXT(void);
   void SNTABLE_CLOSE_TEXT(void) ;
 
+  int  checksum_CACHE_TEXT(char *FILENAME, char *FILENAME_CACHE,
+			   HEADER_CACHE_TEXT *HEADER);
+  int  NBYTE_ICAST_CACHE_TEXT(int ICAST);
+  int  NEVT_CACHE_TEXT(char *FILENAME);
+  int  SNTABLE_READ_CACHE_TEXT(char *FILENAME);
+  void SNTABLE_WRITE_CACHE_TEXT(char *FILENAME, int NROW);
+  void SNTABLE_SUMMARY_CACHE_TEXT(void);
+
   int validRowKey_TEXT(char *string) ;
 
   int count_varnames_TEXT();
@@ -986,6 +1013,7 @@ int SNTABLE_NEVT_TEXT(char *FILENAME) {
   // Dec 20 2017: huge speed-up reading lines instead of words.
   //
   // Apr 17 2019: rewind -> snana_rewind
+  // Oct 16 2026: check READTABLE_CACHE
 
   int NROW, LENF, GZIPFLAG ;
   FILE *fp ;
@@ -997,6 +1025,13 @@ int SNTABLE_NEVT_TEXT(char *FILENAME) {
   NROW = 0 ;
   LENF = strlen(FILENAME) ;
 
+  // Oct 16 2026: NROW from valid cache sidecar avoids reading text
+  if ( READTABLE_CACHE.USE && LENF > 0 ) {
+    NROW = NEVT_CACHE_TEXT(FILENAME);
+    if ( NROW >= 0 ) { return NROW; }
+    NROW = 0 ;
+  }
+
   if ( LENF > 0 ) 
     { fp = open_TEXTgz(FILENAME,TEXTMODE_rt, &GZIPFLAG); }
   else
@@ -1164,6 +1199,8 @@ int SNTABLE_READ_EXEC_TEXT(void) {
   // Jun  29 2021; check GZIPFLAG_TEXT for using pclose or fclose
   // Sep  07 2021: abort if ivar < NVAR_TOT 
   //    (e.g., if split jobs with different NVAR are merged)
+  // Oct  16 2026: if READTABLE_CACHE.USE, read binary sidecar when
+  //    valid, or write sidecar after parsing text.
   //
 
   int NROW = 0 ;
@@ -1181,6 +1218,15 @@ int SNTABLE_READ_EXEC_TEXT(void) {
   
   // ------------ BEGIN -----------  
    
+  if ( READTABLE_CACHE.USE ) {
+    NROW = SNTABLE_READ_CACHE_TEXT(FILENAME_TEXT);
+    if ( NROW >= 0 ) { 
+      SNTABLE_CLOSE_TEXT();  SNTABLE_SUMMARY_CACHE_TEXT();
+      return(NROW); 
+    }
+    NROW = 0 ;
+  }
+
   // get key name of ID varname such as CID, GALID, etc.
   sprintf(KEYNAME_ID,"%s", READTABLE_POINTERS.VARNAME[0] ); 
 
@@ -1299,6 +1345,11 @@ int SNTABLE_READ_EXEC_TEXT(void) {
   NAME_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT][0] = 0 ;
   USE_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT]     = 0;
 
+  if ( READTABLE_CACHE.USE ) { 
+    SNTABLE_WRITE_CACHE_TEXT(FILENAME_TEXT,NROW); 
+    SNTABLE_SUMMARY_CACHE_TEXT();
+  }
+
   return(NROW) ;
 
 } // end of SNTABLE_READ_EXEC_TEXT
@@ -1308,11 +1359,469 @@ void SNTABLE_CLOSE_TEXT(void) {
   // can call this function after SNTABLE_NEVT
   // so that there is no need to read entire file.
 
-  fclose(PTRFILE_TEXT); // Feb 13 2021
+  // Oct 16 2026: pclose for gzipped file
+
+  if ( GZIPFLAG_TEXT ) 
+    { pclose(PTRFILE_TEXT); }
+  else
+    { fclose(PTRFILE_TEXT); } // Feb 13 2021
   NAME_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT][0] = 0 ;
   USE_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT]     = 0;
 } 
 
+// =========================================================
+// Oct 16 2026: optional binary columnar cache for TEXT tables.
+//
+// Layout of [FILENAME].SNCACHE sidecar:
+//   HEADER_CACHE_TEXT
+//   COLUMN_CACHE_TEXT[NCOL]
+//   column blocks, each 8-byte aligned:
+//     numeric : NROW values with ICAST of stored column
+//     char    : int IDICT[NROW] followed by char DICT[NDICT][LENDICT]
+//
+// Numeric columns are stored in the cast used by the first read;
+// a later read can use a cached double column for any numeric cast,
+// otherwise the cast must match. The sidecar is ignored (and
+// re-written) if size/mtime/checksum of the source file changes,
+// or if a requested column is missing.
+// =========================================================
+int checksum_CACHE_TEXT(char *FILENAME, char *FILENAME_CACHE,
+			HEADER_CACHE_TEXT *HEADER) {
+
+  // Created Oct 16 2026
+  // For input text FILENAME (or FILENAME.gz), load HEADER with
+  // size, mtime, and 64-bit FNV-1a checksum of the source file,
+  // and return name of cache sidecar in FILENAME_CACHE.
+  // The checksum of the last file is memorized so that calls from
+  // SNTABLE_NEVT and SNTABLE_READ_EXEC read the source only once.
+  // Function returns 1 on success, 0 if source file cannot be found.
+
+  struct stat statbuf ;
+  char   FILENAME_SRC[MXCHAR_FILENAME+4];
+  unsigned char *BUF ;
+  unsigned long long int HASH = 14695981039346656037ULL ;
+  size_t NRD, i ;
+  FILE  *fp ;
+  int    MXBUF = 1<<20 ;
+  // ------------ BEGIN ------------
+
+  sprintf(FILENAME_SRC, "%s", FILENAME);
+  if ( stat(FILENAME_SRC,&statbuf) != 0 ) {
+    sprintf(FILENAME_SRC, "%s.gz", FILENAME);
+    if ( stat(FILENAME_SRC,&statbuf) != 0 ) { return(0); }
+  }
+
+  sprintf(FILENAME_CACHE, "%s.%s", FILENAME_SRC, SUFFIX_READTABLE_CACHE);
+
+  memset(HEADER, 0, sizeof(HEADER_CACHE_TEXT) );
+  sprintf(HEADER->MAGIC, "%s", MAGIC_READTABLE_CACHE);
+  HEADER->SIZE_SRC  = (long long int)statbuf.st_size ;
+  HEADER->MTIME_SRC = (long long int)statbuf.st_mtime ;
+
+  if ( strcmp(READTABLE_CACHE.LAST_FILE,FILENAME_SRC) == 0    &&
+       READTABLE_CACHE.LAST_SIZE  == HEADER->SIZE_SRC         &&
+       READTABLE_CACHE.LAST_MTIME == HEADER->MTIME_SRC  ) {
+    HEADER->CHECKSUM_SRC = READTABLE_CACHE.LAST_CHECKSUM ;
+    return(1);
+  }
+
+  fp = fopen(FILENAME_SRC, "rb");
+  if ( !fp ) { return(0); }
+
+  BUF = (unsigned char*)malloc(MXBUF);
+  while ( (NRD = fread(BUF, 1, MXBUF, fp)) > 0 ) {
+    for(i=0; i < NRD; i++ ) 
+      { HASH ^= (unsigned long long int)BUF[i];  HASH *= 1099511628211ULL; }
+  }
+  fclose(fp);  free(BUF);
+
+  HEADER->CHECKSUM_SRC = HASH ;
+
+  sprintf(READTABLE_CACHE.LAST_FILE, "%s", FILENAME_SRC);
+  READTABLE_CACHE.LAST_SIZE     = HEADER->SIZE_SRC ;
+  READTABLE_CACHE.LAST_MTIME    = HEADER->MTIME_SRC ;
+  READTABLE_CACHE.LAST_CHECKSUM = HASH ;
+
+  return(1);
+
+} // end checksum_CACHE_TEXT
+
+
+// =========================================================
+int NBYTE_ICAST_CACHE_TEXT(int ICAST) {
+  // Created Oct 16 2026: return number of bytes per value for ICAST
+  if      ( ICAST == ICAST_D ) { return sizeof(double); }
+  else if ( ICAST == ICAST_F ) { return sizeof(float); }
+  else if ( ICAST == ICAST_I ) { return sizeof(int); }
+  else if ( ICAST == ICAST_S ) { return sizeof(short int); }
+  else if ( ICAST == ICAST_L ) { return sizeof(long long int); }
+  else                         { return 0; }
+} // end NBYTE_ICAST_CACHE_TEXT
+
+
+// =========================================================
+int NEVT_CACHE_TEXT(char *FILENAME) {
+
+  // Created Oct 16 2026
+  // Return number of rows stored in valid cache sidecar for
+  // text FILENAME; return -1 if there is no valid sidecar.
+
+  HEADER_CACHE_TEXT HEADER_SRC, HEADER ;
+  char FILENAME_CACHE[MXCHAR_FILENAME+20];
+  FILE *fp ;
+  int  NRD ;
+  // ------------ BEGIN ------------
+
+  if ( !checksum_CACHE_TEXT(FILENAME, FILENAME_CACHE, &HEADER_SRC) ) 
+    { return(-1); }
+
+  fp = fopen(FILENAME_CACHE, "rb");
+  if ( !fp ) { return(-1); }
+  NRD = fread(&HEADER, sizeof(HEADER_CACHE_TEXT), 1, fp);
+  fclose(fp);
+
+  if ( NRD != 1 ) { return(-1); }
+  if ( strcmp(HEADER.MAGIC,HEADER_SRC.MAGIC) != 0   ) { return(-1); }
+  if ( HEADER.SIZE_SRC     != HEADER_SRC.SIZE_SRC     ) { return(-1); }
+  if ( HEADER.MTIME_SRC    != HEADER_SRC.MTIME_SRC    ) { return(-1); }
+  if ( HEADER.CHECKSUM_SRC != HEADER_SRC.CHECKSUM_SRC ) { return(-1); }
+
+  return(HEADER.NROW);
+
+} // end NEVT_CACHE_TEXT
+
+
+// =========================================================
+int SNTABLE_READ_CACHE_TEXT(char *FILENAME) {
+
+  // Created Oct 16 2026
+  // If a valid cache sidecar exists for text FILENAME and it
+  // contains every column requested by SNTABLE_READPREP_VARDEF,
+  // mmap sidecar and fill user arrays. Functions returns NROW,
+  // or -1 if sidecar cannot be used (then caller parses text).
+
+  HEADER_CACHE_TEXT HEADER_SRC, *HEADER ;
+  COLUMN_CACHE_TEXT *COLUMN, *COL, *COL_IVAR[MXVAR_TABLE] ;
+  char   FILENAME_CACHE[MXCHAR_FILENAME+20], *VARNAME, *ADDR, *DICT ;
+  struct stat statbuf ;
+  int    fd, NROW, NCOL, NVAR_TOT, ivar, icol, irow, nptr, ICAST ;
+  int    NBYTE, *IDICT, VALID = 0 ;
+  double *DCACHE ;
+  char   fnam[] = "SNTABLE_READ_CACHE_TEXT" ;
+  // ------------ BEGIN ------------
+
+  NVAR_TOT = READTABLE_POINTERS.NVAR_TOT ;
+  if ( READTABLE_POINTERS.FP_DUMP != NULL ) { return(-1); }
+  if ( READTABLE_POINTERS.MXLEN   <= 0    ) { return(-1); }
+
+  if ( !checksum_CACHE_TEXT(FILENAME, FILENAME_CACHE, &HEADER_SRC) ) 
+    { return(-1); }
+
+  fd = open(FILENAME_CACHE, O_RDONLY);
+  if ( fd < 0 ) { READTABLE_CACHE.NMISS++ ;  return(-1); }
+
+  if ( fstat(fd,&statbuf) != 0 || 
+       statbuf.st_size < (off_t)sizeof(HEADER_CACHE_TEXT) ) 
+    { close(fd);  READTABLE_CACHE.NMISS++ ;  return(-1); }
+
+  ADDR = (char*)mmap(NULL, statbuf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if ( ADDR == MAP_FAILED ) { READTABLE_CACHE.NMISS++ ;  return(-1); }
+
+  HEADER = (HEADER_CACHE_TEXT*)ADDR ;
+  COLUMN = (COLUMN_CACHE_TEXT*)(ADDR + sizeof(HEADER_CACHE_TEXT));
+  NROW   = HEADER->NROW ;
+  NCOL   = HEADER->NCOL ;
+
+  // check that sidecar matches source file
+  if ( strcmp(HEADER->MAGIC,HEADER_SRC.MAGIC) != 0       ) { goto DONE; }
+  if ( HEADER->SIZE_SRC     != HEADER_SRC.SIZE_SRC       ) { goto DONE; }
+  if ( HEADER->MTIME_SRC    != HEADER_SRC.MTIME_SRC      ) { goto DONE; }
+  if ( HEADER->CHECKSUM_SRC != HEADER_SRC.CHECKSUM_SRC   ) { goto DONE; }
+  if ( NROW > READTABLE_POINTERS.MXLEN                   ) { goto DONE; }
+  if ( (long long int)statbuf.st_size < 
+       (long long int)(sizeof(HEADER_CACHE_TEXT) + 
+		       NCOL*sizeof(COLUMN_CACHE_TEXT))   ) { goto DONE; }
+
+  // find cached column for each requested variable
+  for(ivar=0; ivar < NVAR_TOT; ivar++ ) {
+    COL_IVAR[ivar] = NULL ;
+    if ( READTABLE_POINTERS.NPTR[ivar] == 0 ) { continue; }
+    VARNAME = READTABLE_POINTERS.VARNAME[ivar] ;
+    ICAST   = READTABLE_POINTERS.ICAST_STORE[ivar] ;
+    for(icol=0; icol < NCOL; icol++ ) {
+      COL = &COLUMN[icol];
+      if ( strcmp(COL->VARNAME,VARNAME) != 0 ) { continue; }
+      if ( COL->OFFSET + COL->NBYTE > (long long int)statbuf.st_size ) 
+	{ continue; }
+      if ( COL->ICAST == ICAST || 
+	   (COL->ICAST == ICAST_D && ICAST != ICAST_C) ) 
+	{ COL_IVAR[ivar] = COL; }
+    }
+    if ( COL_IVAR[ivar] == NULL ) { goto DONE; }
+  }
+
+  // all requested columns are in sidecar; fill user arrays
+  for(ivar=0; ivar < NVAR_TOT; ivar++ ) {
+    COL = COL_IVAR[ivar] ;
+    if ( COL == NULL ) { continue; }
+    ICAST  = READTABLE_POINTERS.ICAST_STORE[ivar] ;
+    NBYTE  = NBYTE_ICAST_CACHE_TEXT(ICAST);
+    DCACHE = (double*)(ADDR + COL->OFFSET);
+
+    for(nptr=0; nptr < READTABLE_POINTERS.NPTR[ivar]; nptr++ ) {
+
+      if ( ICAST == ICAST_C ) {
+	IDICT = (int*)(ADDR + COL->OFFSET);
+	DICT  = ADDR + COL->OFFSET + 
+	  ((NROW*sizeof(int) + 7)/8)*8 ; // start of dictionary
+	for(irow=0; irow < NROW; irow++ ) {
+	  sprintf(READTABLE_POINTERS.PTRVAL_C[nptr][ivar][irow], "%s",
+		  DICT + (long long int)IDICT[irow]*COL->LENDICT );
+	}
+      }
+      else if ( COL->ICAST == ICAST ) {
+	// same cast -> direct copy of column block
+	if ( ICAST == ICAST_D ) 
+	  { memcpy(READTABLE_POINTERS.PTRVAL_D[nptr][ivar], DCACHE, 
+		   NROW*NBYTE); }
+	else if ( ICAST == ICAST_F ) 
+	  { memcpy(READTABLE_POINTERS.PTRVAL_F[nptr][ivar], DCACHE, 
+		   NROW*NBYTE); }
+	else if ( ICAST == ICAST_I ) 
+	  { memcpy(READTABLE_POINTERS.PTRVAL_I[nptr][ivar], DCACHE, 
+		   NROW*NBYTE); }
+	else if ( ICAST == ICAST_S ) 
+	  { memcpy(READTABLE_POINTERS.PTRVAL_S[nptr][ivar], DCACHE, 
+		   NROW*NBYTE); }
+	else if ( ICAST == ICAST_L ) 
+	  { memcpy(READTABLE_POINTERS.PTRVAL_L[nptr][ivar], DCACHE, 
+		   NROW*NBYTE); }
+      }
+      else {
+	// convert cached double column
+	for(irow=0; irow < NROW; irow++ ) {
+	  if ( ICAST == ICAST_F ) 
+	    { READTABLE_POINTERS.PTRVAL_F[nptr][ivar][irow] = 
+		(float)DCACHE[irow]; }
+	  else if ( ICAST == ICAST_I ) 
+	    { READTABLE_POINTERS.PTRVAL_I[nptr][ivar][irow] = 
+		(int)DCACHE[irow]; }
+	  else if ( ICAST == ICAST_S ) 
+	    { READTABLE_POINTERS.PTRVAL_S[nptr][ivar][irow] = 
+		(short int)DCACHE[irow]; }
+	  else if ( ICAST == ICAST_L ) 
+	    { READTABLE_POINTERS.PTRVAL_L[nptr][ivar][irow] = 
+		(long long int)DCACHE[irow]; }
+	}
+      }
+    } // end nptr
+  } // end ivar
+
+  VALID = 1 ;
+
+ DONE:
+  munmap(ADDR, statbuf.st_size);
+
+  if ( !VALID ) { READTABLE_CACHE.NMISS++ ;  return(-1); }
+
+  READTABLE_CACHE.NHIT++ ;
+  printf("   %s: read %d rows from %s \n", fnam, NROW, FILENAME_CACHE);
+  fflush(stdout);
+
+  return(NROW);
+
+} // end SNTABLE_READ_CACHE_TEXT
+
+
+// =========================================================
+void SNTABLE_WRITE_CACHE_TEXT(char *FILENAME, int NROW) {
+
+  // Created Oct 16 2026
+  // After text FILENAME has been parsed into user arrays, write
+  // columns that were read into cache sidecar so that the next
+  // read can skip the text parsing. Char columns (e.g., CID, FIELD)
+  // are stored as a dictionary of unique strings plus an int index
+  // per row. Sidecar is written to a temp file and renamed so that
+  // simultaneous jobs never see a partial file.
+  // Failure to write is not fatal; e.g., read-only directory.
+
+  HEADER_CACHE_TEXT  HEADER ;
+  COLUMN_CACHE_TEXT  COLUMN[MXVAR_TABLE] ;
+  int    IVAR_COL[MXVAR_TABLE], *IDICT[MXVAR_TABLE];
+  char  *DICT[MXVAR_TABLE];
+  char   FILENAME_CACHE[MXCHAR_FILENAME+20];
+  char   FILENAME_TMP[MXCHAR_FILENAME+40];
+  char   ZERO[8] = { 0,0,0,0,0,0,0,0 } ;
+  int    NVAR_TOT = READTABLE_POINTERS.NVAR_TOT ;
+  int    NCOL = 0, ivar, icol, irow, ICAST, LEN, LENDICT, NDICT ;
+  int    NHASH, *HASHTABLE, ih, NPAD, NWR = 0, NWR_EXPECT = 0 ;
+  long long int OFFSET ;
+  unsigned long long int H ;
+  char  **CPTR, *c ;
+  FILE  *fp ;
+  char   fnam[] = "SNTABLE_WRITE_CACHE_TEXT" ;
+  // ------------ BEGIN ------------
+
+  if ( NROW <= 0 ) { return; }
+  if ( READTABLE_POINTERS.FP_DUMP != NULL ) { return; }
+  if ( READTABLE_POINTERS.MXLEN   <= 0    ) { return; }
+
+  if ( !checksum_CACHE_TEXT(FILENAME, FILENAME_CACHE, &HEADER) ) 
+    { return; }
+
+  OFFSET = 0 ;
+  memset(COLUMN, 0, sizeof(COLUMN) );
+
+  for(ivar=0; ivar < NVAR_TOT; ivar++ ) {
+    if ( READTABLE_POINTERS.NPTR[ivar] == 0 ) { continue; }
+    ICAST = READTABLE_POINTERS.ICAST_STORE[ivar] ;
+    icol  = NCOL ;
+    IVAR_COL[icol] = ivar ;
+    IDICT[icol] = NULL ;  DICT[icol] = NULL ;
+    sprintf(COLUMN[icol].VARNAME, "%s", READTABLE_POINTERS.VARNAME[ivar]);
+    COLUMN[icol].ICAST = ICAST ;
+
+    if ( ICAST == ICAST_C ) {
+      // build dictionary of unique strings with open-addressing hash
+      CPTR    = READTABLE_POINTERS.PTRVAL_C[0][ivar] ;
+      LENDICT = 1 ;
+      for(irow=0; irow < NROW; irow++ ) {
+	LEN = strlen(CPTR[irow]) + 1 ;
+	if ( LEN > LENDICT ) { LENDICT = LEN; }
+      }
+      NHASH = 1;  while ( NHASH < 2*NROW ) { NHASH *= 2; }
+      HASHTABLE   = (int*)malloc(NHASH*sizeof(int));
+      for(ih=0; ih < NHASH; ih++ ) { HASHTABLE[ih] = -1; }
+      IDICT[icol] = (int*) malloc(NROW*sizeof(int));
+      DICT[icol]  = (char*)calloc((long long int)NROW*LENDICT,1);
+      NDICT = 0 ;
+      for(irow=0; irow < NROW; irow++ ) {
+	H = 14695981039346656037ULL ;
+	for(c=CPTR[irow]; *c != 0; c++ ) 
+	  { H ^= (unsigned char)(*c);  H *= 1099511628211ULL; }
+	ih = (int)(H & (NHASH-1)) ;
+	while ( HASHTABLE[ih] >= 0 && 
+		strcmp(&DICT[icol][(long long int)HASHTABLE[ih]*LENDICT],
+		       CPTR[irow]) != 0 ) 
+	  { ih = (ih+1) & (NHASH-1); }
+	if ( HASHTABLE[ih] < 0 ) {
+	  HASHTABLE[ih] = NDICT ;
+	  sprintf(&DICT[icol][(long long int)NDICT*LENDICT],"%s",CPTR[irow]);
+	  NDICT++ ;
+	}
+	IDICT[icol][irow] = HASHTABLE[ih] ;
+      }
+      free(HASHTABLE);
+      COLUMN[icol].NDICT   = NDICT ;
+      COLUMN[icol].LENDICT = LENDICT ;
+      COLUMN[icol].NBYTE   = ((NROW*sizeof(int) + 7)/8)*8 + 
+	(long long int)NDICT*LENDICT ;
+    }
+    else {
+      COLUMN[icol].NBYTE = (long long int)NROW*NBYTE_ICAST_CACHE_TEXT(ICAST);
+    }
+    NCOL++ ;
+  }
+
+  HEADER.NROW = NROW ;
+  HEADER.NCOL = NCOL ;
+
+  // offsets are 8-byte aligned for mmap on read-back
+  OFFSET = sizeof(HEADER_CACHE_TEXT) + NCOL*sizeof(COLUMN_CACHE_TEXT) ;
+  for(icol=0; icol < NCOL; icol++ ) {
+    OFFSET = ((OFFSET + 7)/8)*8 ;
+    COLUMN[icol].OFFSET = OFFSET ;
+    OFFSET += COLUMN[icol].NBYTE ;
+  }
+
+  sprintf(FILENAME_TMP, "%s.tmp%d", FILENAME_CACHE, (int)getpid() );
+  fp = fopen(FILENAME_TMP, "wb");
+  if ( !fp ) {
+    printf("   %s: cannot write %s (skip cache) \n", fnam, FILENAME_TMP);
+    fflush(stdout);
+    goto CLEANUP ;
+  }
+
+  NWR += fwrite(&HEADER, sizeof(HEADER_CACHE_TEXT), 1, fp);
+  NWR += fwrite(COLUMN,  sizeof(COLUMN_CACHE_TEXT), NCOL, fp);
+  NWR_EXPECT = 1 + NCOL ;
+  OFFSET = sizeof(HEADER_CACHE_TEXT) + NCOL*sizeof(COLUMN_CACHE_TEXT) ;
+
+  for(icol=0; icol < NCOL; icol++ ) {
+    ivar  = IVAR_COL[icol] ;
+    ICAST = COLUMN[icol].ICAST ;
+    NPAD  = (int)(COLUMN[icol].OFFSET - OFFSET);
+    if ( NPAD > 0 ) { fwrite(ZERO, 1, NPAD, fp); }
+
+    if ( ICAST == ICAST_C ) {
+      NWR += fwrite(IDICT[icol], sizeof(int), NROW, fp);
+      NPAD = ((NROW*sizeof(int) + 7)/8)*8 - NROW*sizeof(int) ;
+      if ( NPAD > 0 ) { fwrite(ZERO, 1, NPAD, fp); }
+      NWR += fwrite(DICT[icol], COLUMN[icol].LENDICT, 
+		    COLUMN[icol].NDICT, fp);
+      NWR_EXPECT += NROW + COLUMN[icol].NDICT ;
+    }
+    else {
+      if ( ICAST == ICAST_D ) 
+	{ NWR += fwrite(READTABLE_POINTERS.PTRVAL_D[0][ivar], 
+			sizeof(double), NROW, fp); }
+      else if ( ICAST == ICAST_F ) 
+	{ NWR += fwrite(READTABLE_POINTERS.PTRVAL_F[0][ivar], 
+			sizeof(float), NROW, fp); }
+      else if ( ICAST == ICAST_I ) 
+	{ NWR += fwrite(READTABLE_POINTERS.PTRVAL_I[0][ivar], 
+			sizeof(int), NROW, fp); }
+      else if ( ICAST == ICAST_S ) 
+	{ NWR += fwrite(READTABLE_POINTERS.PTRVAL_S[0][ivar], 
+			sizeof(short int), NROW, fp); }
+      else if ( ICAST == ICAST_L ) 
+	{ NWR += fwrite(READTABLE_POINTERS.PTRVAL_L[0][ivar], 
+			sizeof(long long int), NROW, fp); }
+      NWR_EXPECT += NROW ;
+    }
+    OFFSET = COLUMN[icol].OFFSET + COLUMN[icol].NBYTE ;
+  }
+
+  if ( fclose(fp) != 0 || NWR != NWR_EXPECT || 
+       rename(FILENAME_TMP,FILENAME_CACHE) != 0 ) {
+    printf("   %s: failed to write %s (skip cache) \n", fnam, FILENAME_CACHE);
+    fflush(stdout);
+    remove(FILENAME_TMP);
+    goto CLEANUP ;
+  }
+
+  READTABLE_CACHE.NWRITE++ ;
+  printf("   %s: wrote %d columns x %d rows to %s \n", 
+	 fnam, NCOL, NROW, FILENAME_CACHE);
+  fflush(stdout);
+
+ CLEANUP:
+  for(icol=0; icol < NCOL; icol++ ) {
+    if ( IDICT[icol] != NULL ) { free(IDICT[icol]); }
+    if ( DICT[icol]  != NULL ) { free(DICT[icol]);  }
+  }
+
+  return ;
+
+} // end SNTABLE_WRITE_CACHE_TEXT
+
+
+// =========================================================
+void SNTABLE_SUMMARY_CACHE_TEXT(void) {
+
+  // Created Oct 16 2026
+  // One-line summary of cache-sidecar usage after table is closed;
+  // counts are cumulative over all tables read by this job.
+
+  printf("   READTABLE_CACHE summary: NHIT=%d  NMISS=%d  NWRITE=%d \n",
+	 READTABLE_CACHE.NHIT, READTABLE_CACHE.NMISS, 
+	 READTABLE_CACHE.NWRITE );
+  fflush(stdout);
+
+} // end SNTABLE_SUMMARY_CACHE_TEXT
+
+
 // =========================================
 int validRowKey_TEXT(char *string) {
 
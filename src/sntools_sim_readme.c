@@ -490,6 +490,9 @@ void README_DOCANA_OUTPUT_SUMMARY(int *iline) {
   if ( INPUTS.HOSTLIB_USE && NGENLC_WRITE > 0 )
     { readme_docana_hostmatch(&i, pad); }
 
+  // Oct 2026: CPU and call count for each driver stage
+  readme_docana_timers_stage(&i, pad);
+
 
   *iline = i;
   return;
@@ -497,6 +500,43 @@ void README_DOCANA_OUTPUT_SUMMARY(int *iline) {
 } // end README_DOCANA_OUTPUT_SUMMARY
 
 
+// ========================================
+void readme_docana_timers_stage(int *iline, char *pad) {
+
+  // Created Oct 16 2026
+  // Write table of call count and wall time for each driver stage
+  // (TIMERS_STAGE) as YAML dictionary with [NCALL, WALL_SEC, USEC_PER_CALL].
+  // Stage times are inclusive; e.g., EVENT includes SIMLIB & HOSTLIB.
+
+  int  i = *iline;
+  int  istage ;
+  long long NCALL ;
+  double TSUM, USEC ;
+  char *cptr, key[40] ;
+
+  // ----------- BEGIN ------------
+
+  i++; cptr = VERSION_INFO.README_DOC[i] ;
+  sprintf(cptr,"%sWALL_STAGE_SUMMARY:   # [NCALL, WALL_SEC, USEC_PER_CALL]",
+	  pad);
+
+  for(istage=0; istage < NSTAGE_TIMER; istage++ ) {
+    NCALL = TIMERS_STAGE.NCALL[istage];
+    TSUM  = TIMERS_STAGE.TSUM[istage];
+    USEC  = 0.0 ;
+    if ( NCALL > 0 ) { USEC = 1.0E6 * TSUM / (double)NCALL ; }
+    sprintf(key, "%s:", STAGENAME_TIMER[istage]);
+    i++; cptr = VERSION_INFO.README_DOC[i] ;
+    sprintf(cptr,"%s  %-12s [%lld, %.3f, %.1f]", 
+	    pad, key, NCALL, TSUM, USEC);
+  }
+
+  *iline = i;
+  return;
+
+} // end readme_docana_timers_stage
+
+
 // ========================================
 void readme_docana_hostmatch(int *iline, char *pad) {
   
@@ -1001,6 +1041,12 @@ void readme_docana_misc(int *iline, char *pad) {
   VERSION_INFO_load(&i, pad, "RANSEED:", noComment, 
 		    lenkey, true, nval1, &dval, 0.0,1.0E9, -1.0); 
 
+  if ( INPUTS.CBRNG_RAN > 0 ) {
+    dval = (double)INPUTS.CBRNG_RAN ;
+    VERSION_INFO_load(&i, pad, "CBRNG_RAN:", "counter-based randoms", 
+		      lenkey, true, nval1, &dval, 0.0,10.0, -1.0); 
+  }
+
   dval = (double)INPUTS.DEBUG_FLAG ;
   VERSION_INFO_load(&i, pad, "DEBUG_FLAG:", noComment, 
 		    lenkey, true, nval1, &dval, 0.0,1.0E9, -1.0); 
@@ -47,6 +47,12 @@
     + use new MATCH_SEARCHEFF_FIELD(field_map) function to handle
       overlaps.
 
+  Oct 16 2026:
+    + DETECT efficiency curves use uniform-grid lookup table
+      (init_SEARCHEFF_DETECT_TABLE) instead of bin search per epoch.
+    + DETECT and PHOTPROB map index is resolved once per FIELD
+      (set_SEARCHEFF_MAPINDEX) instead of string-matching each epoch.
+
 ************************************/
 
 #include "sntools.h"
@@ -341,7 +347,14 @@ int init_SEARCHEFF_PIPELINE(char *survey) {
 
   // check info for each map and set README comments
   NMAP = INPUTS_SEARCHEFF.NMAP_DETECT;
-  for ( imap=0; imap < NMAP; imap++ )  { check_SEARCHEFF_DETECT(imap); }
+  for ( imap=0; imap < NMAP; imap++ )  { 
+    check_SEARCHEFF_DETECT(imap); 
+    init_SEARCHEFF_DETECT_TABLE(imap); // Oct 2026
+  }
+
+  // Oct 2026: reset FIELD -> IMAP lookup 
+  SEARCHEFF_MAPINDEX.NFIELD = 0 ;
+  SEARCHEFF_MAPINDEX.IFIELD = -9 ;
 
   NMAP = INPUTS_SEARCHEFF.NMAP_PHOTPROB;
   for ( imap=0; imap < NMAP; imap++ )  { check_SEARCHEFF_PHOTPROB(imap); }
@@ -790,6 +803,103 @@ void check_SEARCHEFF_DETECT(int imap) {
 } // end of check_SEARCHEFF_DETECT
 
 
+// *********************************************
+void init_SEARCHEFF_DETECT_TABLE(int imap) {
+
+  // Created Oct 16 2026
+  // Compile efficiency curve for this DETECT map into a uniform-grid
+  // lookup table. The cell size is the smallest VAL-bin size so that
+  // each cell contains at most one VAL-bin boundary, and the cell index
+  // is computed directly from VAL (no bin search). Each cell stores the
+  // lower VAL-bin index for the cell's lower edge. Interpolation is
+  // still done on the original curve, so EFF is unchanged.
+  // 
+  // If VAL is not increasing, NBIN_TABLE=0 -> fall back to interp_1DFUN.
+
+  int     NBIN   = SEARCHEFF_DETECT[imap].NBIN ;
+  double *VAL    = SEARCHEFF_DETECT[imap].VAL ;
+
+  int     ibin, icell, NCELL ;
+  double  VALMIN, VALMAX, DVAL, DVAL_MIN, VAL_CELL ;
+  //  char fnam[] = "init_SEARCHEFF_DETECT_TABLE" ;
+
+  // ------------ BEGIN -------------
+
+  SEARCHEFF_DETECT[imap].NBIN_TABLE   = 0 ;
+  SEARCHEFF_DETECT[imap].IBIN_TABLE   = NULL ;
+  if ( NBIN < 2 ) { return ; }
+
+  VALMIN   = VAL[0];  VALMAX = VAL[NBIN-1] ;
+  DVAL_MIN = VALMAX - VALMIN ;
+  for(ibin=0; ibin < NBIN-1; ibin++ ) {
+    DVAL = VAL[ibin+1] - VAL[ibin] ;
+    if ( DVAL <= 0.0 ) { return ; } // not monotonic; use bin search
+    if ( DVAL < DVAL_MIN ) { DVAL_MIN = DVAL; }
+  }
+
+  NCELL = (int)ceil( (VALMAX-VALMIN)/DVAL_MIN - 1.0E-9 ) ;
+  if ( NCELL < 1 ) { NCELL = 1; }
+  if ( NCELL > MXBIN_SEARCHEFF_DETECT_TABLE ) 
+    { NCELL = MXBIN_SEARCHEFF_DETECT_TABLE ; }
+
+  DVAL = (VALMAX-VALMIN) / (double)NCELL ;
+  SEARCHEFF_DETECT[imap].IBIN_TABLE = (int*) malloc(NCELL*sizeof(int));
+
+  ibin = 0 ;
+  for(icell=0; icell < NCELL; icell++ ) {
+    VAL_CELL = VALMIN + DVAL * (double)icell ;
+    while ( ibin < NBIN-2 && VAL_CELL >= VAL[ibin+1] ) { ibin++ ; }
+    SEARCHEFF_DETECT[imap].IBIN_TABLE[icell] = ibin ;
+  }
+
+  SEARCHEFF_DETECT[imap].NBIN_TABLE   = NCELL ;
+  SEARCHEFF_DETECT[imap].VALMIN_TABLE = VALMIN ;
+  SEARCHEFF_DETECT[imap].DVAL_TABLE   = DVAL ;
+
+  return ;
+
+} // end init_SEARCHEFF_DETECT_TABLE
+
+
+// *********************************************
+double interp_SEARCHEFF_DETECT_TABLE(int imap, double VAL) {
+
+  // Created Oct 16 2026
+  // Return linear interpolation of EFF at VAL for DETECT map imap,
+  // using uniform-grid lookup table to find VAL-bin.
+  // Assumes VAL is within map range (checked by calling function).
+  // Result matches interp_1DFUN with OPT=1.
+
+  int     NBIN   = SEARCHEFF_DETECT[imap].NBIN ;
+  int     NCELL  = SEARCHEFF_DETECT[imap].NBIN_TABLE ;
+  double *VAL_LIST = SEARCHEFF_DETECT[imap].VAL ;
+  double *EFF_LIST = SEARCHEFF_DETECT[imap].EFF ;
+  int     icell, ibin ;
+  double  val0, val1, eff0, eff1, frac ;
+
+  // ------------ BEGIN -------------
+
+  icell = (int)( (VAL - SEARCHEFF_DETECT[imap].VALMIN_TABLE) / 
+		 SEARCHEFF_DETECT[imap].DVAL_TABLE ) ;
+  if ( icell < 0      ) { icell = 0 ; }
+  if ( icell >= NCELL ) { icell = NCELL-1 ; }
+
+  // table gives lower bin at cell edge; step at most one bin here
+  // unless NCELL was truncated, or for round-off at cell edge.
+  ibin = SEARCHEFF_DETECT[imap].IBIN_TABLE[icell] ;
+  while ( ibin < NBIN-2 && VAL >= VAL_LIST[ibin+1] ) { ibin++ ; }
+  while ( ibin > 0      && VAL <  VAL_LIST[ibin]   ) { ibin-- ; }
+
+  val0 = VAL_LIST[ibin];  val1 = VAL_LIST[ibin+1];
+  eff0 = EFF_LIST[ibin];  eff1 = EFF_LIST[ibin+1];
+  frac = (VAL - val0)/(val1-val0) ;
+
+  return ( eff0 + frac*(eff1-eff0) );
+
+} // end interp_SEARCHEFF_DETECT_TABLE
+
+
+
 // *********************************************
 void check_SEARCHEFF_PHOTPROB(int imap) {
   
@@ -1796,6 +1906,8 @@ int gen_SEARCHEFF_PIPELINE(int ID, MJD_DETECT_DEF *MJD_DETECT) {
   //
   // Oct 18 2021: load MJD_DETECT-FIRST[LAST]
   //
+  // Oct 16 2026: call set_SEARCHEFF_MAPINDEX for FIELD -> map lookup
+  //
 
   int NMJD_DETECT, NDETECT, imask, NOBS, MARK, DETECT_MARK, IMAP ;
   int IFILTOBS, obs, OVP, obsLast, istore, LFIND, FIRST=0;
@@ -1815,6 +1927,8 @@ int gen_SEARCHEFF_PIPELINE(int ID, MJD_DETECT_DEF *MJD_DETECT) {
     return gen_SEARCHEFF_DEBUG("PIPELINE", RAN, &EFF) ;
   }
 
+  // resolve map index for this event's FIELD
+  set_SEARCHEFF_MAPINDEX();
 
   NMJD_DETECT = 0;
   MJD_LAST    = SEARCHEFF_DATA.MJD[0] ;
@@ -2042,6 +2156,9 @@ double GETEFF_PIPELINE_DETECT(int obs) {
   // Feb 15 2022: add more info for isnan abort.
   // Jun 15 2022: check opt for single-exposure detections instead of coadd
   // Nov 30 2022: check for FIELD dependence
+  // Oct 16 2026: 
+  //   + get IMAP from SEARCHEFF_MAPINDEX instead of string matching
+  //   + interpolate with uniform-grid lookup table
 
   int NMAP                = INPUTS_SEARCHEFF.NMAP_DETECT ;
   int APPLY_DETECT_SINGLE = INPUTS_SEARCHEFF.APPLY_DETECT_SINGLE ;
@@ -2050,11 +2167,10 @@ double GETEFF_PIPELINE_DETECT(int obs) {
   double EFF_atmax, EFF_atmin, VAL_atmax, VAL_atmin, VAL ;
   double ZERO = 0.0, ONE  = 1.0 ;
 
-  int CID, ifilt_obs, NPE_SAT, NBIN_EFF, imap, IMAP, NMAP_FOUND=0;
+  int CID, ifilt_obs, NPE_SAT, NBIN_EFF, IMAP, IFIELD, NMAP_FOUND=0;
   int OPT_INTERP  = 1;   // 1=linear;  2=quadratic
-  bool MATCH_FILTER, MATCH_FIELD;
 
-  char cfilt[4], *field_map, *filt_map;
+  char cfilt[4];
   char fnam[] ="GETEFF_PIPELINE_DETECT" ;
 
   // ---------- BEGIN ---------
@@ -2066,21 +2182,13 @@ double GETEFF_PIPELINE_DETECT(int obs) {
   EFF       = 0.0 ;
 
   // find map corresponding to filter and [optional] FIELD
-  ifilt_obs = SEARCHEFF_DATA.IFILTOBS[obs] ;  IMAP=-9;
+  ifilt_obs = SEARCHEFF_DATA.IFILTOBS[obs] ;
   sprintf(cfilt,"%c", FILTERSTRING[ifilt_obs] );
 
-  for(imap=0; imap < NMAP; imap++ ) {
-    field_map     = SEARCHEFF_DETECT[imap].FIELDLIST;
-    filt_map      = SEARCHEFF_DETECT[imap].FILTERLIST ;
-    MATCH_FILTER  = ( strstr(filt_map,cfilt) != NULL );
-    if ( strlen(field_map) > 0 ) 
-      { MATCH_FIELD   = MATCH_SEARCHEFF_FIELD(field_map); }
-    else
-      { MATCH_FIELD = true; }
-
-    if ( MATCH_FILTER && MATCH_FIELD ) 	
-      {  IMAP = imap;   NMAP_FOUND++; }
-  }
+  if ( SEARCHEFF_MAPINDEX.IFIELD < 0 ) { set_SEARCHEFF_MAPINDEX(); }
+  IFIELD     = SEARCHEFF_MAPINDEX.IFIELD ;
+  IMAP       = SEARCHEFF_MAPINDEX.IMAP_DETECT[IFIELD][ifilt_obs] ;
+  NMAP_FOUND = SEARCHEFF_MAPINDEX.NMATCH_DETECT[IFIELD][ifilt_obs] ;
 
   // if no maps are found for this filter, there are two possibilities:
   // 1) there are no maps at all --> return EFF=1
@@ -2163,9 +2271,14 @@ double GETEFF_PIPELINE_DETECT(int obs) {
   if ( VAL < VAL_atmin ) { return EFF_atmin ; }
 
   // interpolate
-  EFF = interp_1DFUN (OPT_INTERP, VAL, NBIN_EFF, 
-		      SEARCHEFF_DETECT[IMAP].VAL,
-		      SEARCHEFF_DETECT[IMAP].EFF, fnam);
+  if ( SEARCHEFF_DETECT[IMAP].NBIN_TABLE > 0 ) {
+    EFF = interp_SEARCHEFF_DETECT_TABLE(IMAP, VAL); 
+  }
+  else {
+    EFF = interp_1DFUN (OPT_INTERP, VAL, NBIN_EFF, 
+			SEARCHEFF_DETECT[IMAP].VAL,
+			SEARCHEFF_DETECT[IMAP].EFF, fnam);
+  }
 
   // - - - - - 
   if ( APPLY_DETECT_SINGLE && XNEXPOSE > 1.0 ) {
@@ -2201,9 +2314,8 @@ void setObs_for_PHOTPROB(int DETECT_FLAG, int obs) {
   char  *FIELD     = SEARCHEFF_DATA.FIELDNAME ; 
 
   int  NSTORE = OBS_PHOTPROB.NSTORE;
-  int  imap, IMAP, NMATCH;
-  bool MATCH_FIELD, MATCH_FILT ;
-  char FILT[2], *FIELD_TMP, *FILT_TMP;
+  int  IMAP, NMATCH, IFIELD;
+  char FILT[2];
   char fnam[]      = "setObs_for_PHOTPROB" ;
 
   // ------------ BEGIN ------------
@@ -2213,21 +2325,11 @@ void setObs_for_PHOTPROB(int DETECT_FLAG, int obs) {
 
   sprintf(FILT, "%c", FILTERSTRING[IFILTOBS] );
 
-  // find map for this filter and field.
-  NMATCH = 0 ;  IMAP=-9;
-  for(imap=0; imap < NMAP; imap++ ) {
-    MATCH_FIELD = MATCH_FILT = false ;
-    FIELD_TMP  = SEARCHEFF_PHOTPROB[imap].FIELDLIST;
-    FILT_TMP   = SEARCHEFF_PHOTPROB[imap].FILTERLIST ;
-
-    MATCH_FIELD = MATCH_SEARCHEFF_FIELD(FIELD_TMP); // Feb 2021
-
-    if ( strcmp(FILT_TMP,ALL) ==0 )        { MATCH_FILT=1; }
-    if ( strstr(FILT_TMP,FILT ) != NULL  ) { MATCH_FILT=1; }
-
-    if ( MATCH_FIELD && MATCH_FILT ) { IMAP = imap;  NMATCH++ ; }
-
-  } // end imap loop
+  // find map for this filter and field (Oct 2026: use lookup)
+  if ( SEARCHEFF_MAPINDEX.IFIELD < 0 ) { set_SEARCHEFF_MAPINDEX(); }
+  IFIELD = SEARCHEFF_MAPINDEX.IFIELD ;
+  IMAP   = SEARCHEFF_MAPINDEX.IMAP_PHOTPROB[IFIELD][IFILTOBS] ;
+  NMATCH = SEARCHEFF_MAPINDEX.NMATCH_PHOTPROB[IFIELD][IFILTOBS] ;
 
   if(NMATCH==0 )  { return; }
 
@@ -2782,6 +2884,104 @@ bool MATCH_SEARCHEFF_FIELD(char *field_map) {
 } // end MATCH_SEARCHEFF_FIELD
 
 
+// ===============================================
+void set_SEARCHEFF_MAPINDEX(void) {
+
+  // Created Oct 16 2026
+  // Set SEARCHEFF_MAPINDEX.IFIELD for current event based on
+  // first overlap field (same field used by MATCH_SEARCHEFF_FIELD).
+  // If this field has not been seen, resolve DETECT and PHOTPROB
+  // map index for every filter and store. If storage is full, 
+  // re-use last slot.
+
+  char *field_data = SEARCHEFF_DATA.FIELDLIST_OVP[0];
+  int  NFIELD      = SEARCHEFF_MAPINDEX.NFIELD ;
+  int  ifield ;
+  //  char fnam[] = "set_SEARCHEFF_MAPINDEX" ;
+
+  // ---------- BEGIN ----------
+
+  for(ifield=0; ifield < NFIELD; ifield++ ) {
+    if ( strcmp(SEARCHEFF_MAPINDEX.FIELD[ifield],field_data) == 0 ) 
+      { SEARCHEFF_MAPINDEX.IFIELD = ifield;  return; }
+  }
+
+  // new field
+  if ( NFIELD < MXFIELD_SEARCHEFF_MAPINDEX ) 
+    { ifield = NFIELD;  SEARCHEFF_MAPINDEX.NFIELD++ ; }
+  else
+    { ifield = MXFIELD_SEARCHEFF_MAPINDEX - 1; }
+
+  sprintf(SEARCHEFF_MAPINDEX.FIELD[ifield], "%s", field_data);
+  load_SEARCHEFF_MAPINDEX(ifield);
+  SEARCHEFF_MAPINDEX.IFIELD = ifield ;
+
+  return ;
+
+} // end set_SEARCHEFF_MAPINDEX
+
+
+// ===============================================
+void load_SEARCHEFF_MAPINDEX(int ifield) {
+
+  // Created Oct 16 2026
+  // For current event FIELD, store DETECT and PHOTPROB map index
+  // and number of matches for each filter. Logic is moved from 
+  // GETEFF_PIPELINE_DETECT and setObs_for_PHOTPROB; NMATCH>1 abort 
+  // is still done there so that only observed filters can abort.
+
+  int  NMAP_DETECT   = INPUTS_SEARCHEFF.NMAP_DETECT ;
+  int  NMAP_PHOTPROB = INPUTS_SEARCHEFF.NMAP_PHOTPROB ;
+  int  NFILT         = strlen(FILTERSTRING);
+  int  ifilt_obs, imap, IMAP, NMATCH ;
+  bool MATCH_FILT, MATCH_FIELD ;
+  char cfilt[4], *field_map, *filt_map ;
+
+  // ---------- BEGIN ----------
+
+  for(ifilt_obs=0; ifilt_obs < MXFILTINDX; ifilt_obs++ ) {
+    SEARCHEFF_MAPINDEX.IMAP_DETECT[ifield][ifilt_obs]     = -9 ;
+    SEARCHEFF_MAPINDEX.NMATCH_DETECT[ifield][ifilt_obs]   =  0 ;
+    SEARCHEFF_MAPINDEX.IMAP_PHOTPROB[ifield][ifilt_obs]   = -9 ;
+    SEARCHEFF_MAPINDEX.NMATCH_PHOTPROB[ifield][ifilt_obs] =  0 ;
+    if ( ifilt_obs >= NFILT ) { continue; }
+
+    sprintf(cfilt,"%c", FILTERSTRING[ifilt_obs] );
+
+    // DETECT maps: empty FIELDLIST matches all fields
+    NMATCH = 0;  IMAP = -9 ;
+    for(imap=0; imap < NMAP_DETECT; imap++ ) {
+      field_map   = SEARCHEFF_DETECT[imap].FIELDLIST;
+      filt_map    = SEARCHEFF_DETECT[imap].FILTERLIST ;
+      MATCH_FILT  = ( strstr(filt_map,cfilt) != NULL );
+      if ( strlen(field_map) > 0 ) 
+	{ MATCH_FIELD = MATCH_SEARCHEFF_FIELD(field_map); }
+      else
+	{ MATCH_FIELD = true; }
+      if ( MATCH_FILT && MATCH_FIELD ) { IMAP = imap;  NMATCH++ ; }
+    }
+    SEARCHEFF_MAPINDEX.IMAP_DETECT[ifield][ifilt_obs]   = IMAP ;
+    SEARCHEFF_MAPINDEX.NMATCH_DETECT[ifield][ifilt_obs] = NMATCH ;
+
+    // PHOTPROB maps: FILTERLIST can be ALL
+    NMATCH = 0;  IMAP = -9 ;
+    for(imap=0; imap < NMAP_PHOTPROB; imap++ ) {
+      field_map   = SEARCHEFF_PHOTPROB[imap].FIELDLIST;
+      filt_map    = SEARCHEFF_PHOTPROB[imap].FILTERLIST ;
+      MATCH_FIELD = MATCH_SEARCHEFF_FIELD(field_map);
+      MATCH_FILT  = ( strcmp(filt_map,ALL) == 0 || 
+		      strstr(filt_map,cfilt) != NULL ) ;
+      if ( MATCH_FIELD && MATCH_FILT ) { IMAP = imap;  NMATCH++ ; }
+    }
+    SEARCHEFF_MAPINDEX.IMAP_PHOTPROB[ifield][ifilt_obs]   = IMAP ;
+    SEARCHEFF_MAPINDEX.NMATCH_PHOTPROB[ifield][ifilt_obs] = NMATCH ;
+  }
+
+  return ;
+
+} // end load_SEARCHEFF_MAPINDEX
+
+
 // *******************************************
 double interp_SEARCHEFF_zHOST_LEGACY(void) {
 
@@ -2865,6 +3065,7 @@ double LOAD_PHOTPROB_VAR(int OBS, int IMAP, int IVAR) {
   // OBS is the observation index.
   //
   // Feb 14 2020: add REDSHIFT dependence
+  // Oct 16 2026: use IVARABS stored at init instead of parsing VARNAME
 
   double VALMIN  = SEARCHEFF_PHOTPROB[IMAP].VALMIN[IVAR] ;
   double VALMAX  = SEARCHEFF_PHOTPROB[IMAP].VALMAX[IVAR] ;
@@ -2885,7 +3086,7 @@ double LOAD_PHOTPROB_VAR(int OBS, int IMAP, int IVAR) {
   if ( SNR < 0.1 ) { SNR=0.1; }
 
   VARNAME = SEARCHEFF_PHOTPROB[IMAP].VARNAMES[IVAR] ;
-  IVARABS = IVARABS_SEARCHEFF_PHOTPROB(VARNAME) ;
+  IVARABS = SEARCHEFF_PHOTPROB[IMAP].IVARABS[IVAR] ;
 
   if ( IVARABS == IVARABS_PHOTPROB_SNR ) 
     { VAL = SNR ; }
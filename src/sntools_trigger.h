@@ -12,6 +12,11 @@
 
   Feb 05 2021: define FIELDLIST_OVP and NFIELD_OVP
 
+  Oct 16 2026: 
+    + add uniform-grid lookup table to SEARCHEFF_DETECT
+    + new SEARCHEFF_MAPINDEX struct to resolve FIELD/filter -> IMAP
+      once per field instead of string matches for each epoch.
+
  **************************************************/
 
 
@@ -28,6 +33,7 @@
 
 #define  MXMAP_SEARCHEFF_DETECT   50  
 #define  MXROW_SEARCHEFF_DETECT   10000
+#define  MXBIN_SEARCHEFF_DETECT_TABLE 20000 // max cells in lookup table
 
 #define  MXMAP_SEARCHEFF_PHOTPROB     10
 #define  MXROW_SEARCHEFF_PHOTPROB  10000
@@ -146,6 +152,12 @@ struct SEARCHEFF_PIPELINE {
   double *VAL, *EFF ;
   int    NLINE_README;
   char   README[20][MXPATHLEN];
+
+  // Oct 2026: uniform-grid lookup table; each cell of size DVAL_TABLE
+  // points to lower VAL-bin so that bin search is replaced by index math.
+  int    NBIN_TABLE ;
+  double VALMIN_TABLE, DVAL_TABLE ;
+  int    *IBIN_TABLE ;
 } SEARCHEFF_DETECT[MXMAP_SEARCHEFF_DETECT+1] ;
 
 
@@ -241,6 +253,21 @@ struct {
 } SEARCHEFF_zHOST_LEGACY[MXMAP_SEARCHEFF_zHOST] ;
 
 
+// Oct 2026: resolve FIELD and filter to DETECT & PHOTPROB map index
+// once per field (FIELDLIST_OVP[0]); subsequent events/epochs in the
+// same field use integer lookup instead of strstr on map lists.
+#define MXFIELD_SEARCHEFF_MAPINDEX 40
+struct {
+  int  NFIELD ;
+  int  IFIELD ;  // index for current event
+  char FIELD[MXFIELD_SEARCHEFF_MAPINDEX][20];
+  int  IMAP_DETECT[MXFIELD_SEARCHEFF_MAPINDEX][MXFILTINDX] ;
+  int  NMATCH_DETECT[MXFIELD_SEARCHEFF_MAPINDEX][MXFILTINDX] ;
+  int  IMAP_PHOTPROB[MXFIELD_SEARCHEFF_MAPINDEX][MXFILTINDX] ;
+  int  NMATCH_PHOTPROB[MXFIELD_SEARCHEFF_MAPINDEX][MXFILTINDX] ;
+} SEARCHEFF_MAPINDEX ;
+
+
 // Oct 2021 - definw MJDs associated with pipeline detections
 typedef struct {
   double TRIGGER, FIRST, LAST;
@@ -323,6 +350,10 @@ double interp_SEARCHEFF_zHOST_LEGACY(void);
 double interp_SEARCHEFF_zHOST(void);
 
 void   check_SEARCHEFF_DETECT(int imap );
+void   init_SEARCHEFF_DETECT_TABLE(int imap);
+double interp_SEARCHEFF_DETECT_TABLE(int imap, double VAL);
+void   set_SEARCHEFF_MAPINDEX(void);
+void   load_SEARCHEFF_MAPINDEX(int ifield);
 void   check_SEARCHEFF_PHOTPROB(int imap );
 double LOAD_SPECEFF_VAR(int imap, int ivar);
 void   LOAD_PHOTPROB_CDF(int NVAR_CDF, double *WGTLIST );
@@ -114,6 +114,23 @@
  Sep 27 2022 RK - write rho_wom
  Dec 6 2022 RK - remove obsolete fitswrite option
 
+ Oct 16 2026 
+    + new -nthread <n> option splits chi2 grid (wfit_minimize) and 
+      prob-normalization (wfit_normalize) into n pthreads. Each thread 
+      has private buffers for get_chi2wOM, and thread results are 
+      combined in thread order so that output does not depend on 
+      thread timing.
+    + new -nstep_coarse <n> option computes chi2 on coarse grid, then
+      recursively refines only where prob > prob_refine (-prob_refine);
+      chi2 at remaining grid nodes is interpolated.
+    + speed_flag_chi2 += 4 -> compute r(z) for all SN with one cumulative
+      Simpson integral on sorted z grid (init_disttable, fill_disttable).
+      Optional (not in default); overrides +=2 interp trick. 
+      CPU_summary shows benchmark vs. codist per SN.
+    + speed_flag_chi2 += 8 -> with -mucov_file, compute chi2 from 
+      projections of inverse cov onto logz knots of mu_cos(z); 
+      O(NKNOT^2) per grid node instead of O(NSN^2).
+
 *****************************************************************************/
 
 #include <stdlib.h>
@@ -129,15 +146,25 @@
 #include "sntools_cosmology.h"
 #include "sntools_output.h"
 
+#define USE_THREAD   // Oct 2026: used for -nthread option
+
+#ifdef USE_THREAD
+#include <pthread.h>
+#endif
+
 // ======== global params ==========
 
 #define MXSN 100000 // max number of SN to read & fit
 #define MEMC_FILENAME 1000*sizeof(char)
+#define MXTHREAD  64   // max number of threads for -nthread option
 
 // bit-mask options for speed_flag_chio2
 #define SPEED_MASK_OFFDIAG 1  // skip off-diag calc if chi2(diag)>threshold
 #define SPEED_MASK_INTERP  2  // interplate r(z) and mu_cos(z)
+#define SPEED_MASK_DISTTABLE 4 // cumulative r(z) table (overrides INTERP)
 #define SPEED_FLAG_CHI2_DEFAULT  SPEED_MASK_OFFDIAG + SPEED_MASK_INTERP
+#define DZMAX_DISTTABLE  0.01  // max z-interval in r(z) table
+#define SPEED_MASK_LOWRANK  8  // use_mucov: low-rank chi2 with mu_cos knots
 
 // Define variable names to read in hubble diagram file.
 // VARLIST_DEFAULT_XXX means that any variable is valid for XXX.
@@ -162,9 +189,15 @@ struct INPUTS {
   int  blind_seed; // used to pick large random number for sin arg
   int  debug_flag ;
 
+  int   nthread ;  // number of pthreads for chi2 grid (default=1)
+  int   nstep_coarse ;  // >1 -> coarse grid step for refine_chi2grid
+  double prob_refine ;  // refine coarse cells with prob > prob_refine
+
   int   speed_flag_chi2; // default = 1; set to 0 to disable
   bool  USE_SPEED_OFFDIAG; // internal: skip off-diag calc if chi2(diag)>threshold
   bool  USE_SPEED_INTERP;  // internal: intero r(z) and mu(z)
+  bool  USE_SPEED_DISTTABLE; // internal: r(z) from cumulative table
+  bool  USE_SPEED_LOWRANK;   // internal: low-rank chi2 with cov matrix
 
   int fitnumber;   // default=1; legacy for iterative fit after sigint calc
 
@@ -214,9 +247,22 @@ struct  {
   int     n_exec_interp; // number of interpolate calls for r(z) and mu_cos(z)
   int     n_logz_interp; // number of logz bins for interpolation
   double *logz_list_interp, *z_list_interp, logz_bin_interp; 
-  double *rz_list_interp, *mucos_list_interp;
   double  rz_dif_max ;
 
+  // Oct 2026: cumulative r(z) table (see init_disttable)
+  int     NPT_DISTTABLE ;  // number of z points; even=node, odd=midpoint
+  double *z_disttable, *lnz1_disttable, *zz1_disttable ; // [NPT]
+  int    *ipt_disttable ;  // [NSN] table index for each SN
+  double  t_codist_bench, t_disttable_bench, rz_dif_bench ; // msec/cosmo
+
+  // Oct 2026: low-rank chi2 with cov matrix (see init_mucov_lowrank)
+  int     NKNOT_LOWRANK ;                    // number of logz knots
+  double *z_lowrank, *mucos_ref_lowrank ;    // [NKNOT]
+  int    *iknot_lowrank ;                    // [NSN] knot below SN z
+  double *frac_lowrank ;                     // [NSN] interp fraction
+  double  chi2_d0_lowrank, B_d0_lowrank, C_lowrank ; 
+  double *b_lowrank, *u_lowrank, *A_lowrank ; // [NKNOT],[NKNOT],[NKNOT^2]
+
   // - - - -
   double *w0_prob, *wa_prob, *omm_prob;
   double *w0_sort, *wa_sort;
@@ -250,6 +296,7 @@ struct  {
   double sigmu_int, muoff_final, FoM_final ;
 
   int NWARN;
+  int NBIN_EVAL_CHI2GRID ; // number of grid nodes with chi2 calc
 
 } WORKSPACE ;
 
@@ -275,6 +322,29 @@ typedef struct  {
 } Cosparam ;
 
 
+// Oct 2026: define typedef for threads that compute chi2 grid
+typedef struct {
+  int id_thread, nthread;
+  int ilist_min, ilist_max; // range of list index 
+  int *ibin_list ;          // list of 1D grid index (NULL -> ibin=ilist)
+
+  // thread-private buffers for get_chi2wOM
+  double *rz_list, *dmu_list ;                 // [NSN]
+  double *rz_list_interp, *mucos_list_interp ; // [n_logz_interp]
+  double *Einv_disttable, *rz_disttable ;      // [NPT_DISTTABLE]
+  double *dmucos_lowrank ;                     // [NKNOT_LOWRANK]
+
+  // thread-local results
+  time_t t0 ;               // start time for stdout updates
+  int    ibin_extchi_min ;  // 1D grid index at min extchi
+  double snchi_min,  extchi_min ;
+  double snprobtot,  extprobtot ;
+
+} thread_chi2grid_def ;
+
+thread_chi2grid_def THREAD_CHI2GRID[MXTHREAD] ;
+
+
 
 struct {
   double R, sigR;    // CMB R shift parameter and error
@@ -374,13 +444,30 @@ void parse_VARLIST(FILE *fp);
 void read_mucov_sys(char *inFile);
 void dump_MUCOV(char *comment);
 void invert_mucovar(double sqmurms_add);
+void init_mucov_lowrank(void);
 void check_invertMatrix(int N, double *COV, double *COVINV );
 void set_stepsizes(void);
 void set_Ndof(void);
 void init_rz_interp(void);
-void exec_rz_interp(int k, Cosparam *cospar, double *rz, double *dmu);
+void exec_rz_interp(int k, Cosparam *cospar, thread_chi2grid_def *thread,
+		    double *rz, double *dmu);
+void init_disttable(void);
+void fill_disttable(Cosparam *cptr, thread_chi2grid_def *thread);
+void benchmark_disttable(void);
+void get_chi2sums_lowrank(Cosparam *cptr, thread_chi2grid_def *thread,
+			  double *chi_hat, double *Bsum, double *Csum);
 void check_refit(void);
 
+void malloc_thread_chi2grid(int opt);
+void exec_thread_chi2grid(int NLIST, int *IBIN_LIST, 
+			  void *(*FUN)(void *), char *callFun) ;
+void reduce_thread_chi2grid(int *ibin_min);
+void refine_chi2grid(int *ibin_min);
+bool corner_chi2grid(int icorner, int *lo, int *hi, int *ind);
+void get_ibin3d_chi2grid(int ibin, int *i, int *kk, int *j);
+void *thread_chi2grid_minimize(void *thread);
+void *thread_chi2grid_normalize(void *thread);
+
 void wfit_minimize(void);
 void prep_speed_offdiag(double extchi_tmp);
 void wfit_normalize(void);
@@ -392,7 +479,8 @@ void wfit_Covariance(void);
 
 
 void get_chi2wOM(double w0, double wa, double OM, double sqmurms_add,
-		   double *mu_off, double *chi2sn, double *chi2tot );
+		 int id_thread,
+		 double *mu_off, double *chi2sn, double *chi2tot );
 void getname(char *basename, char *tempname, int nrun);
 
 double get_DMU_chi2wOM(double z, double rz, double mu); 
@@ -492,6 +580,9 @@ int main(int argc,char *argv[]){
     
     read_fitres(INPUTS.infile); 
 
+    // setup sorted z grid for cumulative r(z) table
+    init_disttable();
+
     // for large samples, setup logz grid to interpolate rz(z)
     init_rz_interp();
 
@@ -500,6 +591,11 @@ int main(int argc,char *argv[]){
   
     // read optional mu-cov matrix (e..g, Cov_syst)
     read_mucov_sys(INPUTS.mucov_file);
+
+    // low-rank chi2 only with non-zero cov matrix and knots
+    INPUTS.USE_SPEED_LOWRANK = ( INPUTS.USE_SPEED_LOWRANK && 
+				 INPUTS.use_mucov         && 
+				 WORKSPACE.NKNOT_LOWRANK > 0 );
    
     // compute grid step size per floated variable
     set_stepsizes();
@@ -507,6 +603,10 @@ int main(int argc,char *argv[]){
     // compute number of degrees of freedom
     set_Ndof(); 
 
+    // allocate thread-private buffers for chi2 grid
+    malloc_thread_chi2grid(+1);
+
+    if ( INPUTS.fitnumber == 1 ) { benchmark_disttable(); }
 
     t_end_init = time(NULL);
  
@@ -540,6 +640,7 @@ int main(int argc,char *argv[]){
     // check option to repeat fit with updated snrms = sigmu_int
     check_refit();
 
+    malloc_thread_chi2grid(-1);
 
     INPUTS.fitnumber++ ;
 
@@ -568,6 +669,9 @@ void init_stuff(void) {
   INPUTS.blind_seed = 48901 ;
 
   INPUTS.speed_flag_chi2 = SPEED_FLAG_CHI2_DEFAULT ;
+  INPUTS.nthread         = 1 ; // 1 -> no thread
+  INPUTS.nstep_coarse    = 0 ; // 0 -> compute chi2 at every grid node
+  INPUTS.prob_refine     = 1.0E-6 ;
 
   INPUTS.OMEGA_MATTER_SIM = OMEGA_MATTER_DEFAULT ;
 
@@ -676,7 +780,13 @@ void print_wfit_help(void) {
     "   -mucovar\t\t [Legacy key for previous]",
     "   -varname_muerr\t column name with distance errors (default=MUERR)",
     "   -refit\tfit once for sigint then refit with snrms=sigint.", 
-    "   -speed_flag_chi2   +=1->offdiag trick, +=2->interp trick"
+    "   -speed_flag_chi2   +=1->offdiag trick, +=2->interp trick",
+    "                      +=4->r(z) table (overrides interp; opt-in)",
+    "                      +=8->low-rank chi2 for -mucov_file",
+    "   -nthread\tnumber of pthreads to compute chi2 grid [default: 1]",
+    "   -nstep_coarse\tcompute chi2 on coarse grid with this step,",
+    "     \t\t then refine where prob > prob_refine [default: 0->off]",
+    "   -prob_refine\tprob threshold for -nstep_coarse [default: 1E-6]"
     "\n",
     " Grid spacing:",
     " wCDM Fit:",
@@ -885,6 +995,14 @@ void parse_args(int argc, char **argv) {
       else if (strcasecmp(argv[iarg]+1,"speed_flag_chi2")==0)
 	{ INPUTS.speed_flag_chi2 = atoi(argv[++iarg]); }      
 
+      else if (strcasecmp(argv[iarg]+1,"nthread")==0)
+	{ INPUTS.nthread = atoi(argv[++iarg]); }      
+
+      else if (strcasecmp(argv[iarg]+1,"nstep_coarse")==0)
+	{ INPUTS.nstep_coarse = atoi(argv[++iarg]); }      
+      else if (strcasecmp(argv[iarg]+1,"prob_refine")==0)
+	{ INPUTS.prob_refine = atof(argv[++iarg]); }      
+
       else {
 	printf("Bad arg: %s\n", argv[iarg]);
 	exit(EXIT_ERRCODE_wfit);
@@ -897,6 +1015,15 @@ void parse_args(int argc, char **argv) {
   char var_w[20], str_marg_min[20];
 	   
   INPUTS.USE_SPEED_OFFDIAG = (INPUTS.speed_flag_chi2 & SPEED_MASK_OFFDIAG)>0;
+  INPUTS.USE_SPEED_LOWRANK = (INPUTS.speed_flag_chi2 & SPEED_MASK_LOWRANK)>0;
+
+  if ( INPUTS.nthread < 1 ) { INPUTS.nthread = 1; }
+  if ( INPUTS.nthread > MXTHREAD ) {
+    sprintf(c1err,"nthread=%d exceeds bound MXTHREAD=%d", 
+	    INPUTS.nthread, MXTHREAD);
+    sprintf(c2err,"Reduce -nthread argument.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
 
   printf(" ****************************************\n");
   if ( INPUTS.dofit_w0wa )  { 
@@ -1766,6 +1893,9 @@ void init_rz_interp(void) {
 
   WORKSPACE.n_exec_interp = 0;
 
+  if ( INPUTS.USE_SPEED_DISTTABLE ) 
+    { INPUTS.USE_SPEED_INTERP = false;  return; } // Oct 2026
+
   if ( NSN > 1000 ) 
     { INPUTS.USE_SPEED_INTERP  = (INPUTS.speed_flag_chi2 & SPEED_MASK_INTERP )>0; }
   else
@@ -1787,8 +1917,7 @@ void init_rz_interp(void) {
   WORKSPACE.logz_bin_interp   = logz_bin ;
   WORKSPACE.logz_list_interp  = (double*)malloc(MEMD);
   WORKSPACE.z_list_interp     = (double*)malloc(MEMD);
-  WORKSPACE.rz_list_interp    = (double*)malloc(MEMD);
-  WORKSPACE.mucos_list_interp = (double*)malloc(MEMD);
+  // Oct 2026: rz & mucos lists are thread-private; see malloc_thread_chi2grid
   
   printf("\n# ========================================================= \n");
   printf(" load %d logz bins (%.5f <= z <= %.5f) to interpolate rz(z)\n", 
@@ -1811,11 +1940,15 @@ void init_rz_interp(void) {
 
 } // end init_rz_interp
 
-void exec_rz_interp(int k, Cosparam *cparloc, double *rz, double *mucos) {
+void exec_rz_interp(int k, Cosparam *cparloc, thread_chi2grid_def *thread,
+		    double *rz, double *mucos) {
 
   // Created Apr 22 2022
   // return interpolated rz and dmu for SN index k
   // cparloc is used only as a diagnostic for first few chi2 loops.
+  //
+  // Oct 16 2026: pass *thread to use thread-private rz & mucos lists;
+  //              diagnostic is done only for id_thread=0.
 
   int    n_logz   = WORKSPACE.n_logz_interp;
   double logz_min = WORKSPACE.logz_list_interp[0];
@@ -1840,23 +1973,25 @@ void exec_rz_interp(int k, Cosparam *cparloc, double *rz, double *mucos) {
   if ( iz < n_logz-1 ) {
     frac = (logz - WORKSPACE.logz_list_interp[iz])/logz_bin;
 
-    rz0    = WORKSPACE.rz_list_interp[iz];
-    rz1    = WORKSPACE.rz_list_interp[iz+1];
+    rz0    = thread->rz_list_interp[iz];
+    rz1    = thread->rz_list_interp[iz+1];
     rz_loc = rz0 + frac*(rz1-rz0); 
 
-    mucos0    = WORKSPACE.mucos_list_interp[iz];
-    mucos1    = WORKSPACE.mucos_list_interp[iz+1];
+    mucos0    = thread->mucos_list_interp[iz];
+    mucos1    = thread->mucos_list_interp[iz+1];
     mucos_loc = mucos0 + frac*(mucos1-mucos0); 
   }
   else {
-    rz_loc    = WORKSPACE.rz_list_interp[iz]; // last z-bin
-    mucos_loc = WORKSPACE.mucos_list_interp[iz]; // last z-bin
+    rz_loc    = thread->rz_list_interp[iz]; // last z-bin
+    mucos_loc = thread->mucos_list_interp[iz]; // last z-bin
   }
   
   // load output function args
   *rz    = rz_loc;
   *mucos = mucos_loc;
 
+  if ( thread->id_thread > 0 ) { return; }
+
   if ( k == HD.NSN-1 ) { WORKSPACE.n_exec_interp++ ; }
 
   // print diagnostic for first few events.
@@ -1877,6 +2012,192 @@ void exec_rz_interp(int k, Cosparam *cparloc, double *rz, double *mucos) {
   return;
 } // end exec_rz_interp
 
+// ==================================
+void init_disttable(void) {
+
+  // Created Oct 16 2026
+  // Setup cosmology-independent part of r(z) table used in get_chi2wOM:
+  // sorted grid of unique SN redshifts (starting at z=0), with extra
+  // nodes inserted so that no interval exceeds DZMAX_DISTTABLE.
+  // Table points alternate between nodes (even index) and interval
+  // midpoints (odd index) for Simpson integration in fill_disttable.
+  // The z-dependent factors of E(z) are computed here once, so that 
+  // per-cosmology cost is one exp+sqrt per table point.
+
+  int    NSN = HD.NSN ;
+  int    *INDEX_SORT, NNODE=0, MXNODE, ipt, isort, k, n, i ;
+  double *z_node, z, z_last, dz, z1 ;
+  char fnam[] = "init_disttable" ;
+
+  // ----------- BEGIN ------------
+
+  INPUTS.USE_SPEED_DISTTABLE = 
+    (INPUTS.speed_flag_chi2 & SPEED_MASK_DISTTABLE) > 0 ;
+  if ( !INPUTS.USE_SPEED_DISTTABLE ) { return; }
+
+  // free table from previous fit (-refit)
+  if ( WORKSPACE.NPT_DISTTABLE > 0 ) {
+    free(WORKSPACE.z_disttable);   free(WORKSPACE.ipt_disttable);
+    free(WORKSPACE.lnz1_disttable); free(WORKSPACE.zz1_disttable);
+  }
+
+  INDEX_SORT = (int*) malloc(NSN * sizeof(int));
+  sortDouble(NSN, HD.z, +1, INDEX_SORT);
+
+  MXNODE = NSN + (int)(HD.zmax/DZMAX_DISTTABLE) + 2 ;
+  z_node = (double*) malloc(MXNODE * sizeof(double));
+  WORKSPACE.ipt_disttable = (int*) malloc(NSN * sizeof(int));
+
+  z_node[NNODE++] = 0.0 ;
+  for(isort=0; isort < NSN; isort++ ) {
+    k      = INDEX_SORT[isort];
+    z      = HD.z[k];
+    z_last = z_node[NNODE-1];
+    if ( z > z_last ) {
+      n  = (int)ceil( (z - z_last)/DZMAX_DISTTABLE );
+      dz = (z - z_last) / (double)n ;
+      for(i=1; i < n; i++ ) { z_node[NNODE++] = z_last + (double)i*dz; }
+      z_node[NNODE++] = z ;
+    }
+    WORKSPACE.ipt_disttable[k] = 2*(NNODE-1) ;
+  }
+
+  if ( NNODE > MXNODE ) {
+    sprintf(c1err,"NNODE=%d exceeds MXNODE=%d", NNODE, MXNODE);
+    sprintf(c2err,"zmax=%f  DZMAX=%f", HD.zmax, DZMAX_DISTTABLE);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  // load nodes and midpoints
+  WORKSPACE.NPT_DISTTABLE  = 2*NNODE - 1 ;
+  n = WORKSPACE.NPT_DISTTABLE * sizeof(double);
+  WORKSPACE.z_disttable    = (double*) malloc(n);
+  WORKSPACE.lnz1_disttable = (double*) malloc(n);
+  WORKSPACE.zz1_disttable  = (double*) malloc(n);
+
+  for(ipt=0; ipt < WORKSPACE.NPT_DISTTABLE; ipt++ ) {
+    i = ipt/2 ;
+    if ( ipt%2 == 0 ) { z = z_node[i]; }
+    else              { z = 0.5*(z_node[i] + z_node[i+1]); }
+    z1 = 1.0 + z;
+    WORKSPACE.z_disttable[ipt]    = z ;
+    WORKSPACE.lnz1_disttable[ipt] = log(z1) ;
+    WORKSPACE.zz1_disttable[ipt]  = z/z1 ;
+  }
+
+  printf("\n# ========================================================= \n");
+  printf(" load r(z) table with %d nodes (%d SN, dzmax=%.3f) \n", 
+	 NNODE, NSN, DZMAX_DISTTABLE );
+  fflush(stdout);
+
+  free(INDEX_SORT);  free(z_node);
+
+  return;
+
+} // end init_disttable
+
+
+// ==================================
+void fill_disttable(Cosparam *cptr, thread_chi2grid_def *thread) {
+
+  // Created Oct 16 2026
+  // For input cosmology, evaluate 1/E(z) at each table point and 
+  // load cumulative Simpson integral thread->rz_disttable[ipt] = r(z)
+  // at each node (even ipt). r(z) for SN k is 
+  //    rz_disttable[WORKSPACE.ipt_disttable[k]]
+  //
+  // E(z) follows EofZ, but uses cached ln(1+z) and z/(1+z).
+
+  int    NPT   = WORKSPACE.NPT_DISTTABLE ;
+  double *Einv = thread->Einv_disttable ;
+  double *rz   = thread->rz_disttable ;
+  double omr   = 0.9E-4 ;  // must match EofZ
+  double omm   = cptr->omm * (1.0 - omr) ;
+  double ome   = cptr->ome * (1.0 - omr) ;
+  double omk   = 1.0 - cptr->omm - cptr->ome ;
+  double w0    = cptr->w0, wa = cptr->wa ;
+  double pw    = 3.0*(1.0 + w0 + wa);
+  double lnz1, z1, z1_pow2, arg, dz ;
+  int ipt ;
+
+  // ----------- BEGIN ------------
+
+  for(ipt=0; ipt < NPT; ipt++ ) {
+    lnz1    = WORKSPACE.lnz1_disttable[ipt];
+    z1      = 1.0 + WORKSPACE.z_disttable[ipt];
+    z1_pow2 = z1*z1 ;
+    arg     = 
+      omm * z1_pow2 * z1 +  
+      omk * z1_pow2 + 
+      ome * exp(pw*lnz1 - 3.0*wa*WORKSPACE.zz1_disttable[ipt]) +
+      omr * z1_pow2 * z1_pow2 ;
+    if ( arg < 0.01 ) { arg = 0.01; }
+    Einv[ipt] = 1.0/sqrt(arg);
+  }
+
+  rz[0] = 0.0 ;
+  for(ipt=2; ipt < NPT; ipt += 2 ) {
+    dz      = WORKSPACE.z_disttable[ipt] - WORKSPACE.z_disttable[ipt-2] ;
+    rz[ipt] = rz[ipt-2] + 
+      dz * ( Einv[ipt-2] + 4.0*Einv[ipt-1] + Einv[ipt] ) / 6.0 ;
+  }
+
+  return;
+
+} // end fill_disttable
+
+
+// ==================================
+void benchmark_disttable(void) {
+
+  // Created Oct 16 2026
+  // Compare CPU time per cosmology to compute r(z) for each SN using
+  // codist (integral per SN) vs. fill_disttable (one cumulative integral).
+  // Results are stored in WORKSPACE and printed in CPU_summary.
+
+  int    NSN    = HD.NSN ;
+  int    NBENCH = 20 ;
+  thread_chi2grid_def *thread = &THREAD_CHI2GRID[0];
+  double rz, rz_dif, rz_dif_max = 0.0 ;
+  double t_codist = 0.0, t_table = 0.0 ;
+  clock_t t0 ;
+  Cosparam cpar ;
+  int ib, k ;
+
+  // ----------- BEGIN ------------
+
+  if ( !INPUTS.USE_SPEED_DISTTABLE ) { return; }
+
+  for(ib=0; ib < NBENCH; ib++ ) {
+    cpar.omm = 0.2 + 0.2*(double)ib/(double)NBENCH ;
+    cpar.ome = 1.0 - cpar.omm ;
+    cpar.w0  = -1.2 + 0.4*(double)ib/(double)NBENCH ;
+    cpar.wa  = 0.0 ;
+
+    t0 = clock();
+    for(k=0; k < NSN; k++ ) { thread->rz_list[k] = codist(HD.z[k],&cpar); }
+    t_codist += (double)(clock() - t0) ;
+
+    t0 = clock();
+    fill_disttable(&cpar, thread);
+    t_table += (double)(clock() - t0) ;
+
+    for(k=0; k < NSN; k++ ) {
+      rz     = thread->rz_disttable[WORKSPACE.ipt_disttable[k]] ;
+      rz_dif = fabs(rz/thread->rz_list[k] - 1.0);
+      if ( rz_dif > rz_dif_max ) { rz_dif_max = rz_dif; }
+    }
+  }
+
+  WORKSPACE.t_codist_bench    = 1000.0 * t_codist / CLOCKS_PER_SEC / NBENCH;
+  WORKSPACE.t_disttable_bench = 1000.0 * t_table  / CLOCKS_PER_SEC / NBENCH;
+  WORKSPACE.rz_dif_bench      = rz_dif_max ;
+
+  return;
+
+} // end benchmark_disttable
+
+
 // ==================================
 void check_refit(void) {
   
@@ -1905,36 +2226,571 @@ void check_refit(void) {
 
 } // end check_refit
 
+// ==================================
+void malloc_thread_chi2grid(int opt) {
+
+  // Created Oct 16 2026
+  // opt > 0 -> malloc thread-private buffers used by get_chi2wOM
+  // opt < 0 -> free
+  // Buffers for id_thread=0 are also used for serial calls to
+  // get_chi2wOM (e.g., get_minwOM).
+
+  int NSN    = HD.NSN ;
+  int n_logz = WORKSPACE.n_logz_interp ;
+  int MEMD_SN   = NSN * sizeof(double);
+  int MEMD_LOGZ = n_logz * sizeof(double);
+  int MEMD_DISTTABLE = WORKSPACE.NPT_DISTTABLE * sizeof(double);
+  int t;
+  thread_chi2grid_def *thread ;
+
+  // ------------ BEGIN ------------
+
+  for ( t = 0; t < INPUTS.nthread; t++ ) {
+    thread = &THREAD_CHI2GRID[t];
+    if ( opt > 0 ) {
+      thread->id_thread = t ;
+      thread->nthread   = INPUTS.nthread ;
+      thread->rz_list   = (double*) malloc(MEMD_SN);
+      thread->dmu_list  = (double*) malloc(MEMD_SN);
+      thread->rz_list_interp    = NULL ;
+      thread->mucos_list_interp = NULL ;
+      if ( INPUTS.USE_SPEED_INTERP ) {
+	thread->rz_list_interp    = (double*) malloc(MEMD_LOGZ);
+	thread->mucos_list_interp = (double*) malloc(MEMD_LOGZ);
+      }
+      thread->Einv_disttable = thread->rz_disttable = NULL ;
+      thread->dmucos_lowrank = NULL ;
+      if ( INPUTS.USE_SPEED_LOWRANK ) {
+	thread->dmucos_lowrank = 
+	  (double*) malloc(WORKSPACE.NKNOT_LOWRANK*sizeof(double));
+      }
+      if ( INPUTS.USE_SPEED_DISTTABLE ) {
+	thread->Einv_disttable = (double*) malloc(MEMD_DISTTABLE);
+	thread->rz_disttable   = (double*) malloc(MEMD_DISTTABLE);
+      }
+    }
+    else {
+      free(thread->rz_list);  free(thread->dmu_list);
+      if ( thread->rz_list_interp != NULL ) {
+	free(thread->rz_list_interp);  free(thread->mucos_list_interp);
+      }
+      if ( thread->rz_disttable != NULL ) {
+	free(thread->Einv_disttable);  free(thread->rz_disttable);
+      }
+      if ( thread->dmucos_lowrank != NULL ) 
+	{ free(thread->dmucos_lowrank); }
+    }
+  }
+
+  return;
+
+} // end malloc_thread_chi2grid
+
+
+// ==================================
+void exec_thread_chi2grid(int NLIST, int *IBIN_LIST, 
+			  void *(*FUN)(void *), char *callFun) {
+
+  // Created Oct 16 2026
+  // Split list of NLIST grid bins into INPUTS.nthread contiguous ranges
+  // [ilist_min,ilist_max) and execute FUN for each range. 
+  // IBIN_LIST[ilist] is the 1D index of w0 x wa x omm grid; 
+  // if IBIN_LIST=NULL, ibin=ilist (i.e., full grid for NLIST=NBTOT).
+  // For nthread=1, FUN is called directly without pthread.
+  // Calling function combines thread-local results afterwards.
+
+  int nthread = INPUTS.nthread ;
+  int NBIN_per_thread, t, rc, NERR ;
+  thread_chi2grid_def *thread ;
+#ifdef USE_THREAD
+  pthread_t pthread[MXTHREAD];
+#endif
+  char fnam[] = "exec_thread_chi2grid" ;
+
+  // ----------- BEGIN ------------
+
+  NBIN_per_thread = (NLIST + nthread - 1) / nthread ; // integer ceil
+
+  for ( t = 0; t < nthread; t++ ) {
+    thread = &THREAD_CHI2GRID[t];
+    thread->ibin_list  = IBIN_LIST ;
+    thread->ilist_min  = t     * NBIN_per_thread ;
+    thread->ilist_max  = (t+1) * NBIN_per_thread ;
+    if ( thread->ilist_min > NLIST ) { thread->ilist_min = NLIST; }
+    if ( thread->ilist_max > NLIST ) { thread->ilist_max = NLIST; }
+    thread->t0 = time(NULL);
+
+    if ( nthread == 1 ) 
+      { FUN(thread); }
+#ifdef USE_THREAD
+    else 
+      { rc = pthread_create(&pthread[t], NULL, FUN, thread); }
+#endif
+  }
+
+#ifdef USE_THREAD
+  // for threads, wait for them all to finish
+  if ( nthread > 1 ) {
+    NERR = 0 ;
+    for ( t = 0; t < nthread; t++ ) { 
+      rc = pthread_join(pthread[t], NULL); 
+      if ( rc != 0 ) {
+	NERR++; 
+	printf(" ERROR: thread return errcode=%d for t=%d\n", rc,t); }
+    }
+
+    if ( NERR > 0 ) {
+      sprintf(c1err,"%d thread return code errors", NERR);
+      sprintf(c2err,"called by %s", callFun );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);  
+    }  
+  }
+#endif
+
+  return ;
+
+} // end exec_thread_chi2grid
+
+
+// ==================================
+void get_ibin3d_chi2grid(int ibin, int *i, int *kk, int *j) {
+  // Created Oct 16 2026
+  // Convert 1D grid index into w0 (i), wa (kk) and omm (j) indices;
+  // omm index varies fastest to match legacy loop order.
+  int NB_omm = INPUTS.omm_steps ;
+  int NB_wa  = INPUTS.wa_steps ;
+  *j  = ibin % NB_omm ;
+  *kk = (ibin / NB_omm) % NB_wa ;
+  *i  = ibin / (NB_omm * NB_wa) ;
+} // end get_ibin3d_chi2grid
+
+
+// ==================================
+void *thread_chi2grid_minimize(void *thread) {
+
+  // Created Oct 16 2026 [code moved from wfit_minimize]
+  // Compute chi2 for each grid bin in thread range, and store 
+  // thread-local chi2min.
+
+  thread_chi2grid_def *THREAD = (thread_chi2grid_def *)thread;
+  int  id_thread = THREAD->id_thread ;
+  int  ilist_min = THREAD->ilist_min ;
+  int  ilist_max = THREAD->ilist_max ;
+  int  *ibin_list = THREAD->ibin_list ;
+  int  NBTOT     = ilist_max - ilist_min ;
+  int  ilist, ibin, i, kk, j, NB=0 ;
+  bool UPDATE_STDOUT;
+  double snchi_tmp, extchi_tmp, muoff_tmp;
+  Cosparam cpar;
+
+  // ----------- BEGIN ------------
+
+  THREAD->snchi_min       = 1.0e20 ;
+  THREAD->extchi_min      = 1.0e20 ;
+  THREAD->ibin_extchi_min = -9 ;
+
+  for ( ilist = ilist_min; ilist < ilist_max; ilist++ ) {
+
+    if ( ibin_list == NULL ) { ibin = ilist; }
+    else                     { ibin = ibin_list[ilist]; }
+
+    get_ibin3d_chi2grid(ibin, &i, &kk, &j);
+    cpar.w0  = INPUTS.w0_min + i*INPUTS.w0_stepsize;
+    cpar.wa  = (INPUTS.wa_min + kk*INPUTS.wa_stepsize);
+    cpar.omm = INPUTS.omm_min + j*INPUTS.omm_stepsize; 
+    cpar.ome = 1 - cpar.omm;
+	
+    get_chi2wOM ( cpar.w0, cpar.wa, cpar.omm, INPUTS.sqsnrms, id_thread,
+		  &muoff_tmp, &snchi_tmp, &extchi_tmp ); 
+
+    WORKSPACE.snchi3d[i][kk][j]  = snchi_tmp ; 
+    WORKSPACE.extchi3d[i][kk][j] = extchi_tmp ;
+	  
+    // Keep track of minimum chi2 
+    if ( snchi_tmp < THREAD->snchi_min ) 
+      { THREAD->snchi_min = snchi_tmp ; }
+	
+    if ( extchi_tmp < THREAD->extchi_min )  { 
+      THREAD->extchi_min      = extchi_tmp ;  
+      THREAD->ibin_extchi_min = ibin ;
+    }
+
+    // stdout update with timing information (first thread only)
+    NB++;
+    if ( id_thread > 0 ) { continue; }
+
+    if ( NB < 1000 ) 
+      { UPDATE_STDOUT = ( NB % 100 == 0 ); }
+    else if ( NB < 10000 ) 
+      { UPDATE_STDOUT = ( NB % 1000 == 0 ); }
+    else
+      { UPDATE_STDOUT = ( NB % 10000 == 0 ); }
+
+    if ( UPDATE_STDOUT ) {
+      time_t t_update = time(NULL);
+      double dt = t_update - THREAD->t0 ;
+      printf("\t finished chi2 bin %8d of %8d  (%.0f sec)\n",
+	     NB, NBTOT, dt); fflush(stdout) ;
+    }
+
+  } // end ilist
+
+  return NULL;
+
+} // end thread_chi2grid_minimize
+
+
+// ==================================
+void *thread_chi2grid_normalize(void *thread) {
+
+  // Created Oct 16 2026 [code moved from wfit_normalize]
+  // Convert chi2 to prob for each grid bin in thread range,
+  // and store thread-local prob sums.
+
+  thread_chi2grid_def *THREAD = (thread_chi2grid_def *)thread;
+  int  ilist_min = THREAD->ilist_min ;
+  int  ilist_max = THREAD->ilist_max ;
+  int  ibin, i, kk, j ;
+  double chidif ;
+
+  // ----------- BEGIN ------------
+
+  THREAD->snprobtot = THREAD->extprobtot = 0.0 ;
+
+  for ( ibin = ilist_min; ibin < ilist_max; ibin++ ) {
+    get_ibin3d_chi2grid(ibin, &i, &kk, &j);
+
+    // Probability distribution from SNe alone 
+    chidif = WORKSPACE.snchi3d[i][kk][j] - WORKSPACE.snchi_min ;
+    WORKSPACE.snprob3d[i][kk][j] = exp(-0.5*chidif);
+    THREAD->snprobtot += WORKSPACE.snprob3d[i][kk][j];
+      
+    // Probability distribution of SNe + external prior
+    chidif = WORKSPACE.extchi3d[i][kk][j] - WORKSPACE.extchi_min ;
+    WORKSPACE.extprob3d[i][kk][j] = exp(-0.5*chidif);
+    THREAD->extprobtot += WORKSPACE.extprob3d[i][kk][j];
+  }
+
+  return NULL;
+
+} // end thread_chi2grid_normalize
+
+
+// ==================================
+void reduce_thread_chi2grid(int *ibin_min) {
+
+  // Created Oct 16 2026
+  // Combine thread results from thread_chi2grid_minimize in thread 
+  // order. Since each thread covers a contiguous range of the list, 
+  // strict '<' picks the same min-bin as a single loop over the list.
+  // WORKSPACE chi2 minima are updated, and *ibin_min is updated only 
+  // if extchi_min decreases.
+
+  int t;
+  // ----------- BEGIN ------------
+
+  for ( t = 0; t < INPUTS.nthread; t++ ) {
+    thread_chi2grid_def *thread = &THREAD_CHI2GRID[t];
+    if ( thread->snchi_min < WORKSPACE.snchi_min ) 
+      { WORKSPACE.snchi_min = thread->snchi_min ; }
+
+    if ( thread->extchi_min < WORKSPACE.extchi_min ) { 
+      WORKSPACE.extchi_min = thread->extchi_min ;  
+      *ibin_min            = thread->ibin_extchi_min ;
+    }
+  }
+
+  return;
+
+} // end reduce_thread_chi2grid
+
+
+// ==================================
+void refine_chi2grid(int *ibin_min) {
+
+  // Created Oct 16 2026
+  // Coarse-to-fine alternative to computing chi2 at every grid node.
+  // Start with coarse cells whose corners are every nstep_coarse grid 
+  // bins (plus last bin) along each axis. At each refinement level,
+  // chi2 is computed at cell corners not yet evaluated; then each cell
+  // is split in half along each axis if its most probable corner has 
+  // prob/probmax > prob_refine for either SN-only or SN+prior chi2.
+  // Cells that are not split are leaves, and chi2 at their interior 
+  // grid nodes is interpolated (multi-linear) from corner chi2.
+  // Output is the same fully populated snchi3d & extchi3d grid as for
+  // the default evaluation at every node.
+  //
+  // Output: *ibin_min = 1D grid index at min extchi.
+
+  int    NBIN_AXIS[3] = { INPUTS.w0_steps, INPUTS.wa_steps, INPUTS.omm_steps};
+  int    NBTOT  = NBIN_AXIS[0] * NBIN_AXIS[1] * NBIN_AXIS[2];
+  int    nstep  = INPUTS.nstep_coarse ;
+  double dchi2_refine = -2.0 * log(INPUTS.prob_refine) ;
+
+#define STATUS_CHI2GRID_PENDING  1
+#define STATUS_CHI2GRID_EVAL     2
+#define STATUS_CHI2GRID_INTERP   3
+  typedef struct { int lo[3], hi[3]; } CELL_DEF ;
+
+  char     *STATUS    = (char*) calloc(NBTOT, sizeof(char));
+  int      *IBIN_LIST = (int *) malloc(NBTOT * sizeof(int));
+  CELL_DEF *CELL_LIST = NULL, *CELL_NEXT = NULL, *LEAF_LIST = NULL, *CELL ;
+  int  NCELL=0, NCELL_NEXT=0, NLEAF=0, MXCELL=0, MXCELL_NEXT=0, MXLEAF=0;
+  int  NBREAK[3], *BREAK[3], ILO[3], IHI[3], IND[3], ISPLIT[3] ;
+  int  iaxis, ib0, ib1, ib2, icell, icorner, isub, ibin, NLIST, NEVAL=0, NINTERP=0;
+  int  level = 0, i, kk, j ;
+  bool split ;
+  double dchi2, dchi2_min, dchi2_max, f[3], wgt, snchi, extchi ;
+  char fnam[] = "refine_chi2grid" ;
+
+  // ----------- BEGIN ------------
+
+  printf("   Coarse grid every %d bins; refine where prob > %.1le "
+	 "(dchi2 < %.1f)\n", nstep, INPUTS.prob_refine, dchi2_refine );
+  fflush(stdout);
+
+  // coarse cell boundaries along each axis
+  for(iaxis=0; iaxis < 3; iaxis++ ) {
+    BREAK[iaxis]  = (int*) malloc( (NBIN_AXIS[iaxis]/nstep+2)*sizeof(int));
+    NBREAK[iaxis] = 0 ;
+    for(i=0; i < NBIN_AXIS[iaxis]; i += nstep ) 
+      { BREAK[iaxis][NBREAK[iaxis]++] = i; }
+    if ( BREAK[iaxis][NBREAK[iaxis]-1] != NBIN_AXIS[iaxis]-1 ) 
+      { BREAK[iaxis][NBREAK[iaxis]++] = NBIN_AXIS[iaxis]-1; }
+    // number of cells along axis; single-bin axis has one cell lo=hi
+    ILO[iaxis] = ( NBREAK[iaxis] > 1 ) ? NBREAK[iaxis]-1 : 1 ;
+  }
+
+  MXCELL    = ILO[0] * ILO[1] * ILO[2] ;
+  CELL_LIST = (CELL_DEF*) malloc(MXCELL * sizeof(CELL_DEF));
+  for(ib0=0; ib0 < ILO[0]; ib0++ ) {
+    for(ib1=0; ib1 < ILO[1]; ib1++ ) {
+      for(ib2=0; ib2 < ILO[2]; ib2++ ) {
+	CELL = &CELL_LIST[NCELL++];
+	IND[0] = ib0;  IND[1] = ib1;  IND[2] = ib2;
+	for(iaxis=0; iaxis < 3; iaxis++ ) {
+	  CELL->lo[iaxis] = BREAK[iaxis][IND[iaxis]] ;
+	  if ( NBREAK[iaxis] > 1 ) 
+	    { CELL->hi[iaxis] = BREAK[iaxis][IND[iaxis]+1] ; }
+	  else
+	    { CELL->hi[iaxis] = CELL->lo[iaxis] ; }
+	}
+      }
+    }
+  }
+
+  // - - - - - - - 
+  while ( NCELL > 0 ) {
+
+    // compute chi2 at cell corners that are not yet evaluated
+    NLIST = 0 ;
+    for(icell=0; icell < NCELL; icell++ ) {
+      CELL = &CELL_LIST[icell];
+      for(icorner=0; icorner < 8; icorner++ ) {
+	if ( !corner_chi2grid(icorner, CELL->lo, CELL->hi, IND) ) {continue;}
+	ibin = (IND[0]*NBIN_AXIS[1] + IND[1])*NBIN_AXIS[2] + IND[2] ;
+	if ( STATUS[ibin] == 0 ) {
+	  STATUS[ibin] = STATUS_CHI2GRID_PENDING ;
+	  IBIN_LIST[NLIST++] = ibin ;
+	}
+      }
+    }
+
+    printf("\t refine level %d: %d cells, compute chi2 at %d nodes\n",
+	   level, NCELL, NLIST);  fflush(stdout);
+
+    if ( NLIST > 0 ) {
+      exec_thread_chi2grid(NLIST, IBIN_LIST, thread_chi2grid_minimize, fnam);
+      reduce_thread_chi2grid(ibin_min);
+      for(i=0; i < NLIST; i++ ) { STATUS[IBIN_LIST[i]] = STATUS_CHI2GRID_EVAL;}
+      NEVAL += NLIST ;
+    }
+
+    // split cells near max prob; others become leaves
+    NCELL_NEXT = 0 ;
+    for(icell=0; icell < NCELL; icell++ ) {
+      CELL  = &CELL_LIST[icell];
+      split = false ;
+      for(iaxis=0; iaxis < 3; iaxis++ ) {
+	ISPLIT[iaxis] = ( CELL->hi[iaxis] - CELL->lo[iaxis] > 1 ) ;
+	if ( ISPLIT[iaxis] ) { split = true; }
+      }
+      if ( !split ) { continue; } // all nodes are corners -> done
+
+      // Find min dchi2 among corners. Steep chi2 change across cell
+      // can hide a narrow valley between corners, so subtract the 
+      // corner spread for a conservative estimate of min dchi2 in cell.
+      dchi2_min = 1.0E20 ;  dchi2_max = -1.0E20 ;
+      for(icorner=0; icorner < 8; icorner++ ) {
+	if ( !corner_chi2grid(icorner, CELL->lo, CELL->hi, IND) ) {continue;}
+	dchi2 = WORKSPACE.extchi3d[IND[0]][IND[1]][IND[2]] - 
+	  WORKSPACE.extchi_min;
+	if ( dchi2 < dchi2_min ) { dchi2_min = dchi2; }
+	if ( dchi2 > dchi2_max ) { dchi2_max = dchi2; }
+	dchi2 = WORKSPACE.snchi3d[IND[0]][IND[1]][IND[2]] - 
+	  WORKSPACE.snchi_min;
+	if ( dchi2 < dchi2_min ) { dchi2_min = dchi2; }
+	if ( dchi2 > dchi2_max ) { dchi2_max = dchi2; }
+      }
+
+      if ( dchi2_min - (dchi2_max - dchi2_min) > dchi2_refine ) {
+	if ( NLEAF == MXLEAF ) {
+	  MXLEAF    = 2*MXLEAF + 100 ;
+	  LEAF_LIST = (CELL_DEF*) realloc(LEAF_LIST, MXLEAF*sizeof(CELL_DEF));
+	}
+	LEAF_LIST[NLEAF++] = *CELL ;
+	continue ;
+      }
+
+      // split into 2^Nsplit sub-cells
+      for(isub=0; isub < 8; isub++ ) {
+	bool valid = true ;
+	for(iaxis=0; iaxis < 3; iaxis++ ) {
+	  int bit = (isub >> iaxis) & 1 ;
+	  int mid = ( CELL->lo[iaxis] + CELL->hi[iaxis] ) / 2 ;
+	  if ( !ISPLIT[iaxis] ) {
+	    if ( bit ) { valid = false; }
+	    ILO[iaxis] = CELL->lo[iaxis];  IHI[iaxis] = CELL->hi[iaxis];
+	  }
+	  else if ( bit == 0 ) 
+	    { ILO[iaxis] = CELL->lo[iaxis];  IHI[iaxis] = mid; }
+	  else
+	    { ILO[iaxis] = mid;  IHI[iaxis] = CELL->hi[iaxis]; }
+	}
+	if ( !valid ) { continue; }
+
+	if ( NCELL_NEXT == MXCELL_NEXT ) {
+	  MXCELL_NEXT = 2*MXCELL_NEXT + 100 ;
+	  CELL_NEXT   = (CELL_DEF*) realloc(CELL_NEXT, 
+					    MXCELL_NEXT*sizeof(CELL_DEF));
+	}
+	for(iaxis=0; iaxis < 3; iaxis++ ) {
+	  CELL_NEXT[NCELL_NEXT].lo[iaxis] = ILO[iaxis];
+	  CELL_NEXT[NCELL_NEXT].hi[iaxis] = IHI[iaxis];
+	}
+	NCELL_NEXT++ ;
+      }
+    } // end icell
+
+    // next level
+    CELL = CELL_LIST;  CELL_LIST = CELL_NEXT;  CELL_NEXT = CELL;
+    i = MXCELL;  MXCELL = MXCELL_NEXT;  MXCELL_NEXT = i;
+    NCELL = NCELL_NEXT ;
+    level++ ;
+  } // end while
+
+
+  // - - - - - - - 
+  // interpolate chi2 at interior nodes of leaf cells
+  for(icell=0; icell < NLEAF; icell++ ) {
+    CELL = &LEAF_LIST[icell];
+    for(i=CELL->lo[0]; i <= CELL->hi[0]; i++ ) {
+      for(kk=CELL->lo[1]; kk <= CELL->hi[1]; kk++ ) {
+	for(j=CELL->lo[2]; j <= CELL->hi[2]; j++ ) {
+	  ibin = (i*NBIN_AXIS[1] + kk)*NBIN_AXIS[2] + j ;
+	  if ( STATUS[ibin] != 0 ) { continue; }
+
+	  IND[0] = i;  IND[1] = kk;  IND[2] = j;
+	  for(iaxis=0; iaxis < 3; iaxis++ ) {
+	    f[iaxis] = 0.0 ;
+	    if ( CELL->hi[iaxis] > CELL->lo[iaxis] ) {
+	      f[iaxis] = (double)(IND[iaxis] - CELL->lo[iaxis]) / 
+		(double)(CELL->hi[iaxis] - CELL->lo[iaxis]) ;
+	    }
+	  }
+
+	  snchi = extchi = 0.0 ;
+	  for(icorner=0; icorner < 8; icorner++ ) {
+	    if ( !corner_chi2grid(icorner, CELL->lo, CELL->hi, ILO) ) 
+	      { continue; }
+	    wgt = 1.0 ;
+	    for(iaxis=0; iaxis < 3; iaxis++ ) {
+	      if ( (icorner >> iaxis) & 1 ) { wgt *= f[iaxis]; }
+	      else                          { wgt *= (1.0-f[iaxis]); }
+	    }
+	    snchi  += wgt * WORKSPACE.snchi3d[ILO[0]][ILO[1]][ILO[2]] ;
+	    extchi += wgt * WORKSPACE.extchi3d[ILO[0]][ILO[1]][ILO[2]] ;
+	  }
+	  WORKSPACE.snchi3d[i][kk][j]  = snchi ;
+	  WORKSPACE.extchi3d[i][kk][j] = extchi ;
+	  STATUS[ibin] = STATUS_CHI2GRID_INTERP ;
+	  NINTERP++ ;
+	}
+      }
+    }
+  } // end icell
+
+  if ( NEVAL + NINTERP != NBTOT ) {
+    sprintf(c1err,"NEVAL(%d) + NINTERP(%d) != NBTOT(%d)", 
+	    NEVAL, NINTERP, NBTOT);
+    sprintf(c2err,"Something is wrong with grid refinement.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  printf("   Computed chi2 at %d of %d grid nodes (%.1f%%); "
+	 "interpolated %d nodes.\n",
+	 NEVAL, NBTOT, 100.0*(double)NEVAL/(double)NBTOT, NINTERP);
+  fflush(stdout);
+
+  WORKSPACE.NBIN_EVAL_CHI2GRID = NEVAL ;
+
+  free(STATUS); free(IBIN_LIST);
+  free(CELL_LIST); free(CELL_NEXT); free(LEAF_LIST);
+  for(iaxis=0; iaxis < 3; iaxis++ ) { free(BREAK[iaxis]); }
+
+  return;
+
+} // end refine_chi2grid
+
+
+bool corner_chi2grid(int icorner, int *lo, int *hi, int *ind) {
+  // Created Oct 16 2026
+  // Load ind[0:2] = grid indices of cell corner icorner (0-7);
+  // bit iaxis of icorner selects lo or hi along axis iaxis.
+  // Return false for duplicate corner along axis with lo=hi.
+  int iaxis, bit;
+  for(iaxis=0; iaxis < 3; iaxis++ ) {
+    bit = (icorner >> iaxis) & 1 ;
+    if ( bit && hi[iaxis] == lo[iaxis] ) { return false; }
+    ind[iaxis] = ( bit ) ? hi[iaxis] : lo[iaxis] ;
+  }
+  return true;
+} // end corner_chi2grid
+
+
 // ==================================
 void wfit_minimize(void) {
 
   // Created Oct 2 2021
   // Driver function to minimize chi2 on grid,
   // Outputs loaded to WORKSPACE struct.
+  //
+  // Oct 16 2026: move grid loop into thread_chi2grid_minimize 
+  //              to enable -nthread option.
+  //              If nstep_coarse > 1, call refine_chi2grid.
 
   int Ndof                 = WORKSPACE.Ndof;
   double sig_chi2min_naive = WORKSPACE.sig_chi2min_naive ;
   bool   USE_SPEED_OFFDIAG = INPUTS.USE_SPEED_OFFDIAG ;
   
   int    use_mucov         = INPUTS.use_mucov;
-  Cosparam cpar;
   Cosparam cpar_fixed;
   double snchi_tmp, extchi_tmp, muoff_tmp;
-  bool UPDATE_STDOUT;
-  int  i, kk, j;
   int  imin = -9, kmin = -9, jmin = -9;
   char fnam[] = "wfit_minimize" ;
 
   // ---------- BEGIN --------------
 
   int NBTOT = INPUTS.w0_steps * INPUTS.wa_steps * INPUTS.omm_steps;
-  int NB=0;
 
   printf("\n# ======================================= \n");
   printf(" Get prob at %d grid points, and approx mimimized values: \n", 
 	 NBTOT );
   printf("\t USE_SPEED_OFFDIAG = %d \n", INPUTS.USE_SPEED_OFFDIAG);
   printf("\t USE_SPEED_INTERP  = %d \n", INPUTS.USE_SPEED_INTERP);
+  printf("\t USE_SPEED_DISTTABLE = %d \n", INPUTS.USE_SPEED_DISTTABLE);
+  printf("\t USE_SPEED_LOWRANK = %d \n", INPUTS.USE_SPEED_LOWRANK);
+  printf("\t nthread           = %d \n", INPUTS.nthread);
   fflush(stdout);
     
   // prep speed trick
@@ -1943,7 +2799,7 @@ void wfit_minimize(void) {
 
     INPUTS.USE_SPEED_OFFDIAG = false; // disable speed flag for approx min chi2 
     cpar_fixed.w0 = -1.0; cpar_fixed.wa=0.0; cpar_fixed.omm=0.3; 
-    get_chi2wOM(cpar_fixed.w0,cpar_fixed.wa, cpar_fixed.omm, INPUTS.sqsnrms, 
+    get_chi2wOM(cpar_fixed.w0,cpar_fixed.wa, cpar_fixed.omm, INPUTS.sqsnrms, 0,
 		&muoff_tmp, &snchi_tmp, &extchi_tmp ); 
     printf("    Very approx chi2min(SNonly,SN+prior: w0=-1,wa=0,omm=0.3) "
 	   "= %.1f %.1f \n", snchi_tmp, extchi_tmp);
@@ -1954,51 +2810,19 @@ void wfit_minimize(void) {
   }
 
   // - - - - - - - - 
-  time_t t0 = time(NULL);  // monitor time to build prob grid
-
-  for( i=0; i < INPUTS.w0_steps; i++){
-    cpar.w0 = INPUTS.w0_min + i*INPUTS.w0_stepsize;
-    for( kk=0; kk < INPUTS.wa_steps; kk++){    
-      cpar.wa = (INPUTS.wa_min + kk*INPUTS.wa_stepsize);
-      for(j=0; j < INPUTS.omm_steps; j++){
-	cpar.omm = INPUTS.omm_min + j*INPUTS.omm_stepsize; 
-	cpar.ome = 1 - cpar.omm;
-	
-	get_chi2wOM ( cpar.w0, cpar.wa, cpar.omm, INPUTS.sqsnrms, 
-		      &muoff_tmp, &snchi_tmp, &extchi_tmp ); 
-
-	WORKSPACE.snchi3d[i][kk][j]  = snchi_tmp ; 
-	WORKSPACE.extchi3d[i][kk][j] = extchi_tmp ;
-	  
-	// Keep track of minimum chi2 
-	if(snchi_tmp < WORKSPACE.snchi_min) 
-	  { WORKSPACE.snchi_min = snchi_tmp ; }
-	
-	if(extchi_tmp < WORKSPACE.extchi_min)  { 
-	  WORKSPACE.extchi_min = extchi_tmp ;  
-	  imin=i; jmin=j; kmin=kk; 
-	}
-
-	// stdout update with timing information
-	NB++;
-	if ( NB < 1000 ) 
-	  { UPDATE_STDOUT = ( NB % 100 == 0 ); }
-	else if ( NB < 10000 ) 
-	  { UPDATE_STDOUT = ( NB % 1000 == 0 ); }
-	else
-	  { UPDATE_STDOUT = ( NB % 10000 == 0 ); }
-
-	if ( UPDATE_STDOUT ) {
-	  time_t t_update = time(NULL);
-	  double dt = t_update - t0 ;
-	  printf("\t finished chi2 bin %8d of %8d  (%.0f sec)\n",
-		 NB, NBTOT, dt); fflush(stdout) ;
-	}
-
-
-      } // j loop
-    }  // end of k-loop
-  }  // end of i-loop
+  // Oct 2026: loop over grid is split into INPUTS.nthread threads
+  // (nthread=1 -> no pthread) 
+  int ibin_min = -9 ;
+  WORKSPACE.NBIN_EVAL_CHI2GRID = NBTOT ;
+  if ( INPUTS.nstep_coarse > 1 ) {
+    // coarse grid, then refine where prob > prob_refine
+    refine_chi2grid(&ibin_min);
+  }
+  else {
+    exec_thread_chi2grid(NBTOT, NULL, thread_chi2grid_minimize, fnam);
+    reduce_thread_chi2grid(&ibin_min);
+  }
+  if ( ibin_min >= 0 ) { get_ibin3d_chi2grid(ibin_min, &imin, &kmin, &jmin); }
 
 
   // get w,OM at min chi2 by using more refined grid
@@ -2072,29 +2896,22 @@ void wfit_normalize(void) {
 
   // Created Oct 2 2021
   // Convert chi2map to normalized probability map.
+  //
+  // Oct 16 2026: chi2 -> prob conversion and prob sums are done in
+  //   thread_chi2grid_normalize; thread sums are added in thread order.
 
-  int i, kk, j;
-  double chidif; 
+  int i, kk, j, t;
   char fnam[] = "wfit_normalize" ;
 
   // ----------- BEGIN ------------
 
   /* First, convert chi2 to likelihoods */
-  for(i=0; i< INPUTS.w0_steps; i++){
-    for(kk = 0; kk < INPUTS.wa_steps; kk++){
-      for(j=0; j < INPUTS.omm_steps; j++){
-	
-	// Probability distribution from SNe alone 
-	chidif = WORKSPACE.snchi3d[i][kk][j] - WORKSPACE.snchi_min ;
-	WORKSPACE.snprob3d[i][kk][j] = exp(-0.5*chidif);
-	WORKSPACE.snprobtot += WORKSPACE.snprob3d[i][kk][j];
-      
-	// Probability distribution of SNe + external prior
-	chidif = WORKSPACE.extchi3d[i][kk][j] - WORKSPACE.extchi_min ;
-	WORKSPACE.extprob3d[i][kk][j] = exp(-0.5*chidif);
-	WORKSPACE.extprobtot += WORKSPACE.extprob3d[i][kk][j];
-      }
-    }
+  int NBTOT = INPUTS.w0_steps * INPUTS.wa_steps * INPUTS.omm_steps;
+  exec_thread_chi2grid(NBTOT, NULL, thread_chi2grid_normalize, fnam);
+
+  for ( t = 0; t < INPUTS.nthread; t++ ) {
+    WORKSPACE.snprobtot  += THREAD_CHI2GRID[t].snprobtot ;
+    WORKSPACE.extprobtot += THREAD_CHI2GRID[t].extprobtot ;
   }
 
   /* Now normalize so that these sum to 1.  Note that if the
@@ -2637,7 +3454,7 @@ void wfit_final(void) {
   WORKSPACE.omm_ran = omm_ran ;
     
   // get final chi2 and mu-offset from final parameters.
-  get_chi2wOM ( cpar.w0, cpar.wa, cpar.omm, INPUTS.sqsnrms,  // inputs
+  get_chi2wOM ( cpar.w0, cpar.wa, cpar.omm, INPUTS.sqsnrms, 0, // inputs
 		&muoff_final, &snchi_tmp, &chi2_final );   // return args
 
   WORKSPACE.chi2_final  = chi2_final;
@@ -2655,7 +3472,7 @@ void wfit_final(void) {
     sigmu_tmp   = (double)i * sigint_binsize ;
     sqmusig_tmp = sigmu_tmp * sigmu_tmp ;
     invert_mucovar(sqmusig_tmp);
-    get_chi2wOM ( cpar.w0, cpar.wa, cpar.omm, sqmusig_tmp,  // inputs
+    get_chi2wOM ( cpar.w0, cpar.wa, cpar.omm, sqmusig_tmp, 0, // inputs
 	  	  &muoff_tmp, &snchi_tmp, &chi2_tmp );   // return args
     
     dif = chi2_tmp/(double)Ndof - 1.0 ;
@@ -2674,7 +3491,7 @@ void wfit_final(void) {
     sqmusig_tmp = sigmu_tmp * sigmu_tmp ;
     invert_mucovar(sqmusig_tmp);
     
-    get_chi2wOM ( cpar.w0, cpar.wa, cpar.omm, sqmusig_tmp,  // inputs
+    get_chi2wOM ( cpar.w0, cpar.wa, cpar.omm, sqmusig_tmp, 0, // inputs
 		  &muoff_tmp, &snchi_tmp, &chi2_tmp );   // return args
     
     dif = chi2_tmp/(double)Ndof - 1.0 ;
@@ -2799,6 +3616,8 @@ void invert_mucovar(double sqmurms_add) {
     if ( check_inverse ) 
       { check_invertMatrix(NSN,MUCOV_ORIG,WORKSPACE.MUCOV); }
 
+    // Oct 2026: projections for low-rank chi2 option
+    init_mucov_lowrank();
   }
   fflush(stdout);
 
@@ -2806,6 +3625,197 @@ void invert_mucovar(double sqmurms_add) {
 
 } // end of invert_mucovar
 
+// =========================================
+void init_mucov_lowrank(void) {
+
+  // Created Oct 16 2026
+  // Setup for low-rank chi2 with cov matrix (speed_flag_chi2 += 8).
+  // mu_cos(z) is linearly interpolated in logz between NKNOT knots,
+  //    mu_cos[k] = sum_j PHI[k][j] * mu_cos_knot[j]
+  // where PHI has 2 non-zero elements per SN. With reference 
+  // cosmology (mucos_ref_lowrank), the residual vector is split into
+  //    dmu = d0 - PHI * da
+  // where d0 = mu - PHI*mucos_ref is cosmology-independent and
+  // da = mu_cos_knot - mucos_ref is a low-dim (NKNOT) vector.
+  // With W = MUCOV^{-1}, chi2 terms for each cosmology become
+  //    chi_hat = d0^T W d0 - 2 da^T (PHI^T W d0) + da^T (PHI^T W PHI) da
+  //    Bsum    = 1^T W d0  - da^T (PHI^T W 1)
+  //    Csum    = 1^T W 1 
+  // Projections are computed here once per MUCOV inversion [O(NSN^2)],
+  // so that each grid node costs O(NKNOT^2) instead of O(NSN^2).
+  //
+  // Must be called after MUCOV is inverted.
+
+  int    NSN   = HD.NSN ;
+  int    NKNOT = WORKSPACE.NKNOT_LOWRANK ;
+  double *W    = WORKSPACE.MUCOV ;
+  double *Wd0, *W1, *d0, logz_min, logz_bin, logz, w, f0, f1;
+  double PHI0[2], PHI1[2];
+  int    k0, k1, j, j0, j1, i0, i1 ;
+  Cosparam cpar_ref ;
+  char fnam[] = "init_mucov_lowrank" ;
+
+  // ----------- BEGIN ------------
+
+  if ( !INPUTS.USE_SPEED_LOWRANK ) { return; }
+  if ( !INPUTS.use_mucov ) { INPUTS.USE_SPEED_LOWRANK = false; return; }
+
+  logz_min = log10(HD.zmin);
+
+  // one-time setup of knots
+  if ( NKNOT == 0 ) {
+    NKNOT = (int)(200.0 * (HD.zmax - HD.zmin)) ;
+    if ( NKNOT < 2 ) { NKNOT = 2; }
+    if ( NKNOT > NSN/2 ) {
+      printf("\t Disable low-rank chi2: NKNOT=%d > NSN/2=%d \n",
+	     NKNOT, NSN/2);
+      fflush(stdout);
+      INPUTS.USE_SPEED_LOWRANK = false;  return; 
+    }
+
+    WORKSPACE.NKNOT_LOWRANK     = NKNOT ;
+    WORKSPACE.z_lowrank         = (double*) malloc(NKNOT*sizeof(double));
+    WORKSPACE.mucos_ref_lowrank = (double*) malloc(NKNOT*sizeof(double));
+    WORKSPACE.b_lowrank         = (double*) malloc(NKNOT*sizeof(double));
+    WORKSPACE.u_lowrank         = (double*) malloc(NKNOT*sizeof(double));
+    WORKSPACE.A_lowrank   = (double*) malloc(NKNOT*NKNOT*sizeof(double));
+    WORKSPACE.iknot_lowrank     = (int   *) malloc(NSN*sizeof(int));
+    WORKSPACE.frac_lowrank      = (double*) malloc(NSN*sizeof(double));
+
+    logz_bin = (log10(HD.zmax) - logz_min) / (double)(NKNOT-1) ;
+    if ( logz_bin <= 0.0 ) { logz_bin = 1.0; }
+
+    cpar_ref.omm = 0.3 ;  cpar_ref.ome = 0.7 ;
+    cpar_ref.w0  = -1.0;  cpar_ref.wa  = 0.0 ;
+    for(j=0; j < NKNOT; j++ ) {
+      WORKSPACE.z_lowrank[j] = pow(10.0, logz_min + (double)j*logz_bin);
+      WORKSPACE.mucos_ref_lowrank[j] = 
+	get_mu_cos(WORKSPACE.z_lowrank[j], 
+		   codist(WORKSPACE.z_lowrank[j], &cpar_ref) );
+    }
+
+    for(k0=0; k0 < NSN; k0++ ) {
+      logz = HD.logz[k0];
+      j    = (int)((logz - logz_min)/logz_bin) ;
+      if ( j < 0       ) { j = 0; }
+      if ( j > NKNOT-2 ) { j = NKNOT-2; }
+      WORKSPACE.iknot_lowrank[k0] = j;
+      WORKSPACE.frac_lowrank[k0]  = 
+	(logz - logz_min - (double)j*logz_bin) / logz_bin ;
+    }
+
+    printf("\n# ========================================================= \n");
+    printf(" Low-rank chi2 with mucov: %d logz knots for %d SN \n",
+	   NKNOT, NSN);
+    fflush(stdout);
+  }
+
+  // - - - - - - - 
+  // projections of inverse cov matrix
+  d0  = (double*) malloc(NSN*sizeof(double));
+  Wd0 = (double*) calloc(NSN,sizeof(double));
+  W1  = (double*) calloc(NSN,sizeof(double));
+
+  for(k0=0; k0 < NSN; k0++ ) {
+    j0 = WORKSPACE.iknot_lowrank[k0];
+    f0 = WORKSPACE.frac_lowrank[k0];
+    d0[k0] = HD.mu[k0] - ( (1.0-f0)*WORKSPACE.mucos_ref_lowrank[j0] + 
+			   f0*WORKSPACE.mucos_ref_lowrank[j0+1] ) ;
+  }
+
+  for(k0=0; k0 < NSN; k0++ ) {
+    for(k1=0; k1 < NSN; k1++ ) {
+      w = W[k0*NSN+k1];
+      Wd0[k0] += w * d0[k1] ;
+      W1[k0]  += w ;
+    }
+  }
+
+  WORKSPACE.chi2_d0_lowrank = WORKSPACE.B_d0_lowrank = 0.0 ;
+  WORKSPACE.C_lowrank = 0.0 ;
+  for(j=0; j < NKNOT; j++ ) 
+    { WORKSPACE.b_lowrank[j] = WORKSPACE.u_lowrank[j] = 0.0 ; }
+  for(j=0; j < NKNOT*NKNOT; j++ )  { WORKSPACE.A_lowrank[j] = 0.0 ; }
+
+  for(k0=0; k0 < NSN; k0++ ) {
+    j0 = WORKSPACE.iknot_lowrank[k0];
+    f0 = WORKSPACE.frac_lowrank[k0];
+    WORKSPACE.chi2_d0_lowrank += d0[k0] * Wd0[k0] ;
+    WORKSPACE.B_d0_lowrank    += Wd0[k0] ;
+    WORKSPACE.C_lowrank       += W1[k0] ;
+    WORKSPACE.b_lowrank[j0]   += (1.0-f0) * Wd0[k0] ;
+    WORKSPACE.b_lowrank[j0+1] += f0       * Wd0[k0] ;
+    WORKSPACE.u_lowrank[j0]   += (1.0-f0) * W1[k0] ;
+    WORKSPACE.u_lowrank[j0+1] += f0       * W1[k0] ;
+
+    PHI0[0] = 1.0-f0;  PHI0[1] = f0;
+    for(k1=0; k1 < NSN; k1++ ) {
+      w  = W[k0*NSN+k1];
+      j1 = WORKSPACE.iknot_lowrank[k1];
+      f1 = WORKSPACE.frac_lowrank[k1];
+      PHI1[0] = 1.0-f1;  PHI1[1] = f1;
+      for(i0=0; i0 < 2; i0++ ) {
+	for(i1=0; i1 < 2; i1++ ) {
+	  WORKSPACE.A_lowrank[(j0+i0)*NKNOT + j1+i1] += 
+	    PHI0[i0] * w * PHI1[i1] ;
+	}
+      }
+    }
+  }
+
+  free(d0); free(Wd0); free(W1);
+
+  return;
+
+} // end init_mucov_lowrank
+
+
+// =========================================
+void get_chi2sums_lowrank(Cosparam *cptr, thread_chi2grid_def *thread,
+			  double *chi_hat, double *Bsum, double *Csum) {
+
+  // Created Oct 16 2026
+  // Return chi_hat, Bsum, Csum for cosmology *cptr using low-rank
+  // projections of inverse cov matrix (see init_mucov_lowrank).
+  // r(z) at the sorted knots is a cumulative Simpson sum (as in 
+  // fill_disttable), so cost is O(NKNOT^2), independent of NSN.
+
+  int    NKNOT = WORKSPACE.NKNOT_LOWRANK ;
+  double *da   = thread->dmucos_lowrank ;
+  double *A    = WORKSPACE.A_lowrank ;
+  double z, z_last = 0.0, rz = 0.0, Einv, Einv_last, chi_loc, Bsum_loc, Ada ;
+  int    j0, j1 ;
+
+  // ----------- BEGIN ------------
+
+  Einv_last = one_over_EofZ(z_last, cptr);
+  for(j0=0; j0 < NKNOT; j0++ ) {
+    z      = WORKSPACE.z_lowrank[j0];
+    Einv   = one_over_EofZ(z, cptr);
+    rz    += (z-z_last) * ( Einv_last + Einv + 
+			    4.0*one_over_EofZ(0.5*(z+z_last), cptr) ) / 6.0;
+    da[j0] = get_mu_cos(z,rz) - WORKSPACE.mucos_ref_lowrank[j0] ;
+    z_last = z;  Einv_last = Einv ;
+  }
+
+  chi_loc  = WORKSPACE.chi2_d0_lowrank ;
+  Bsum_loc = WORKSPACE.B_d0_lowrank ;
+  for(j0=0; j0 < NKNOT; j0++ ) {
+    Ada = 0.0 ;
+    for(j1=0; j1 < NKNOT; j1++ ) { Ada += A[j0*NKNOT+j1] * da[j1]; }
+    chi_loc  += da[j0] * ( Ada - 2.0*WORKSPACE.b_lowrank[j0] ) ;
+    Bsum_loc -= da[j0] * WORKSPACE.u_lowrank[j0] ;
+  }
+
+  *chi_hat = chi_loc ;
+  *Bsum    = Bsum_loc ;
+  *Csum    = WORKSPACE.C_lowrank ;
+
+  return;
+
+} // end get_chi2sums_lowrank
+
+
 
 // =========================================
 void check_invertMatrix(int N, double *COV, double *COVINV ) {
@@ -2853,6 +3863,7 @@ void get_chi2wOM (
 	      ,double wa           // (I)
 	      ,double OM           // (I) 
 	      ,double sqmurms_add  // (I) anomalous mu-error squared
+	      ,int    id_thread    // (I) thread index for private buffers
 	      ,double *mu_off      // (O) distance offset
 	      ,double *chi2sn      // (O) SN-only chi2
 	      ,double *chi2tot     // (O) SN+prior chi2
@@ -2865,11 +3876,21 @@ void get_chi2wOM (
   // Apr 22 2022:
   //   + use dmu_list to avoid redundant log10 calculations in get_DMU_chi2wOM
   //   + implement rz-interpolation option
+  //
+  // Oct 16 2026: pass id_thread and use thread-private buffers
+  //     (instead of malloc each call) so that this function can be
+  //     called from multiple threads.
+  //   + option for cumulative r(z) table (USE_SPEED_DISTTABLE)
+  //   + option for low-rank chi2 with cov matrix (USE_SPEED_LOWRANK)
 
   bool USE_SPEED_OFFDIAG = INPUTS.USE_SPEED_OFFDIAG ;
   bool USE_SPEED_INTERP  = INPUTS.USE_SPEED_INTERP ;
+  bool USE_SPEED_DISTTABLE = INPUTS.USE_SPEED_DISTTABLE ;
+  bool USE_SPEED_LOWRANK = 
+    ( INPUTS.USE_SPEED_LOWRANK && WORKSPACE.NKNOT_LOWRANK > 0 );
   int  use_mucov = INPUTS.use_mucov ;
   int  NSN       = HD.NSN;
+  int  NSN_LOOP  = NSN ;
   int  Ndof      = WORKSPACE.Ndof ;
   double sig_chi2min_naive = WORKSPACE.sig_chi2min_naive;
   double nsig_chi2min_skip = WORKSPACE.nsig_chi2min_skip;  
@@ -2880,8 +3901,9 @@ void get_chi2wOM (
   double dmu, dmu0, dmu1, mu_cos  ;
     
   double  chi2_prior = 0.0 ;
-  double *rz_list  = (double*) malloc(NSN * sizeof(double) );
-  double *dmu_list = (double*) malloc(NSN * sizeof(double) );
+  thread_chi2grid_def *thread = &THREAD_CHI2GRID[id_thread];
+  double *rz_list  = thread->rz_list ;
+  double *dmu_list = thread->dmu_list ;
   Cosparam cparloc;
   int k, k0, k1, N0, N1, k1min, n_count=0 ;
   
@@ -2901,6 +3923,14 @@ void get_chi2wOM (
 
   Bsum = Csum = chi_hat = 0.0 ;
 
+  // Oct 2026: check option for low-rank chi2 with cov matrix; 
+  // chi2 sums do not need loops over SN below.
+  if ( USE_SPEED_LOWRANK ) {
+    get_chi2sums_lowrank(&cparloc, thread, &chi_hat, &Bsum, &Csum);
+    NSN_LOOP = 0 ;
+    USE_SPEED_INTERP = USE_SPEED_DISTTABLE = false ;
+  }
+
   // Apr 2022: check option to interpolate rz(z) [speed trick]
   if ( USE_SPEED_INTERP ) {
     n_logz   = WORKSPACE.n_logz_interp;
@@ -2908,17 +3938,24 @@ void get_chi2wOM (
       z   = WORKSPACE.z_list_interp[iz];
       rz  = codist(z, &cparloc); 
       mu_cos = get_mu_cos(z,rz);  // theory mu
-      WORKSPACE.rz_list_interp[iz]    = rz;
-      WORKSPACE.mucos_list_interp[iz] = mu_cos ;
+      thread->rz_list_interp[iz]    = rz;
+      thread->mucos_list_interp[iz] = mu_cos ;
     }
   }
 
+  // Oct 2026: one cumulative r(z) integral for all SN [speed trick]
+  if ( USE_SPEED_DISTTABLE ) { fill_disttable(&cparloc, thread); }
+
   // Compute diag part first and precompute rz in each z bin to 
   // avoid redundant calculations when using covariance matrix.
-  for(k=0; k < NSN; k++ )  { 
+  for(k=0; k < NSN_LOOP; k++ )  { 
 
-    if ( USE_SPEED_INTERP )  { 
-      exec_rz_interp(k, &cparloc, &rz, &mu_cos); 
+    if ( USE_SPEED_DISTTABLE ) {
+      rz     = thread->rz_disttable[WORKSPACE.ipt_disttable[k]] ;
+      mu_cos = get_mu_cos(HD.z[k], rz) ;
+    }
+    else if ( USE_SPEED_INTERP )  { 
+      exec_rz_interp(k, &cparloc, thread, &rz, &mu_cos); 
     }
     else { 
       rz     = codist(HD.z[k], &cparloc);
@@ -2950,7 +3987,7 @@ void get_chi2wOM (
   // If chi_hat(diag) is already > 10 sigma above naive chi2 -> 
   // skip off-diag computation to save time.
   bool do_offdiag = false;
-  if ( use_mucov ) {
+  if ( use_mucov && NSN_LOOP > 0 ) {
     if ( USE_SPEED_OFFDIAG ) {
       chi_tmp     = chi_hat - Bsum*Bsum/Csum ;
       nsig_chi2  = (chi_tmp - chi_hat_naive ) / sig_chi2min_naive ;
@@ -3042,9 +4079,6 @@ void get_chi2wOM (
 
   *chi2tot += chi2_prior;
 
-  free(rz_list);
-  free(dmu_list);
-
   return ;
 
 }  // end of get_chi2wOM
@@ -3266,7 +4300,7 @@ double get_minwOM( double *w0_atchimin, double *wa_atchimin,
 	  fflush(stdout);
 	}
 
-	get_chi2wOM(w0_tmp, wa_tmp, om_tmp, INPUTS.sqsnrms, 
+	get_chi2wOM(w0_tmp, wa_tmp, om_tmp, INPUTS.sqsnrms, 0,
 		  &muoff_tmp, &snchi_tmp, &extchi_tmp );
 
 	if ( extchi_tmp < extchi_min ) 
@@ -4164,6 +5198,18 @@ void CPU_summary(void) {
   printf("# =================================== \n");
   printf(" CPU Summary \n");
   printf("\t init/fit: %.2f / %.2f minutes \n",	 dt_init, dt_fit);
+  printf("\t nthread:  %d \n", INPUTS.nthread);
+  printf("\t chi2 calc at %d of %d grid nodes \n", 
+	 WORKSPACE.NBIN_EVAL_CHI2GRID,
+	 INPUTS.w0_steps * INPUTS.wa_steps * INPUTS.omm_steps );
+
+  if ( INPUTS.USE_SPEED_DISTTABLE ) {
+    printf("\t r(z) for %d SN: %.3f msec/cosmology (codist) vs. "
+	   "%.3f msec (table)\n", 
+	   HD.NSN, WORKSPACE.t_codist_bench, WORKSPACE.t_disttable_bench);
+    printf("\t r(z) table: max|rz(table)/rz(codist)-1| = %.2le \n",
+	   WORKSPACE.rz_dif_bench);
+  }
   fflush(stdout);
 
   return;